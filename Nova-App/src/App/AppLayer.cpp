@@ -1,11 +1,19 @@
 #include "App/AppLayer.h"
 
+#include <cmath>
+#include <memory>
 #include <iostream>
 #include <filesystem>
 #include <algorithm>
+#include <chrono>
+#include <format>
 
 #include "App/GameLayer.h"
+#include "App/CoreHooks.h"
 #include "App/EditorLayer.h"
+#include "App/StartupTimer.h"
+
+#include "Core/Log.h"
 
 namespace Nova::App {
 
@@ -38,6 +46,7 @@ namespace Nova::App {
         ImGui::DockBuilderDockWindow(m_Scene.GetName().c_str(), dock_left);
         ImGui::DockBuilderDockWindow("Hierarchy", dock_right_top);
         ImGui::DockBuilderDockWindow("Inspector", dock_right_bottom);
+        ImGui::DockBuilderDockWindow("Render Stats", dock_right_bottom);
         ImGui::DockBuilderDockWindow("Asset Browser", dock_down);
 
         ImGui::DockBuilderFinish(dockspace_id);
@@ -45,15 +54,79 @@ namespace Nova::App {
     }
 
     void AppLayer::OnEvent(Event& e) {
+		// Input is queued and handled once per frame by DispatchInputEvents(), coalesced. The event is
+		// still marked handled now when the viewport will consume it, so layers below never see it.
+		std::optional<Input::InputEvent> input;
         EventDispatcher dispatcher(e);
-        dispatcher.Dispatch<MouseButtonPressedEvent>([this](MouseButtonPressedEvent& ev) { return OnMouseButtonPressed(ev); });
-		dispatcher.Dispatch<MouseButtonReleasedEvent>([this](MouseButtonReleasedEvent& ev) { return OnMouseButtonReleased(ev); });
-		dispatcher.Dispatch<MouseMovedEvent>([this](MouseMovedEvent& ev) { return OnMouseMoved(ev); });
-		dispatcher.Dispatch<MouseScrolledEvent>([this](MouseScrolledEvent& ev) { return OnMouseScrolled(ev); });
-		dispatcher.Dispatch<WindowResizeEvent>([this](WindowResizeEvent& ev) { return OnWindowResized(ev); });
-		dispatcher.Dispatch<ImGuiPanelResizeEvent>([this](ImGuiPanelResizeEvent& ev) { return OnImGuiPanelResize(ev); });
+        dispatcher.Dispatch<MouseButtonPressedEvent>([this, &input](MouseButtonPressedEvent& ev) {
+			input = Input::InputEvent{ Input::InputEventType::MouseButtonPressed, static_cast<int>(ev.GetMouseButton()) };
+			return m_ViewportHovered && ev.GetMouseButton() == 1;
+		});
+		dispatcher.Dispatch<MouseButtonReleasedEvent>([&input](MouseButtonReleasedEvent& ev) {
+			input = Input::InputEvent{ Input::InputEventType::MouseButtonReleased, static_cast<int>(ev.GetMouseButton()) };
+			return ev.GetMouseButton() == 1;
+		});
+		dispatcher.Dispatch<MouseMovedEvent>([this, &input](MouseMovedEvent& ev) {
+			input = Input::InputEvent{ Input::InputEventType::MouseMoved, 0, { static_cast<float>(ev.GetX()), static_cast<float>(ev.GetY()) } };
+			return m_Orbit.m_IsRotating;
+		});
+		dispatcher.Dispatch<MouseScrolledEvent>([this, &input](MouseScrolledEvent& ev) {
+			input = Input::InputEvent{ Input::InputEventType::MouseScrolled, 0, { 0.0f, static_cast<float>(ev.GetYOffset()) } };
+			return m_ViewportHovered;
+		});
+		dispatcher.Dispatch<WindowResizeEvent>([&input](WindowResizeEvent& ev) {
+			input = Input::InputEvent{ Input::InputEventType::WindowResized, 0,
+				{ static_cast<float>(ev.GetWidth()), static_cast<float>(ev.GetHeight()) } };
+			return false;
+		});
+		dispatcher.Dispatch<ImGuiPanelResizeEvent>([&input](ImGuiPanelResizeEvent& ev) {
+			input = Input::InputEvent{ Input::InputEventType::PanelResized, 0, { static_cast<float>(ev.GetWidth()), static_cast<float>(ev.GetHeight()) } };
+			return false;
+		});
+
+		if (!input)
+			return;
+		if (!m_EventQueue.Push(*input)) {
+			// Full: handle what is queued now rather than drop input, keeping the order.
+			DispatchInputEvents();
+			m_EventQueue.Push(*input);
+		}
     }
 
+	void AppLayer::DispatchInputEvents() {
+		NV_PROFILE_SCOPE("AppLayer::DispatchInputEvents");
+		m_EventQueue.Dispatch([this](const Input::InputEvent& event) {
+			switch (event.m_Type) {
+				case Input::InputEventType::MouseButtonPressed:  OnMouseButtonPressed(event.m_Button); break;
+				case Input::InputEventType::MouseButtonReleased: OnMouseButtonReleased(event.m_Button); break;
+				case Input::InputEventType::MouseMoved:
+					// Low latency: a drag follows SampleLatestInput(), which is newer than any queued position.
+					if (!m_FramePacer.IsLowLatency() || !m_Orbit.m_IsRotating)
+						OnMouseMoved(event.m_Value);
+					break;
+				case Input::InputEventType::MouseScrolled:       OnMouseScrolled(event.m_Value.y); break;
+				case Input::InputEventType::WindowResized:       OnWindowResized(event.m_Value); break;
+				case Input::InputEventType::PanelResized:        OnImGuiPanelResize(event.m_Value); break;
+				default: break;
+			}
+		});
+		m_InputSampleTime = std::chrono::steady_clock::now();
+	}
+
+	void AppLayer::SampleLatestInput() {
+		NV_PROFILE_SCOPE("AppLayer::SampleLatestInput");
+		if (!m_Orbit.m_IsRotating)
+			return;
+
+		// Motion that arrived during the fence wait is still in SDL's queue: pumping brings the cursor
+		// state up to date. The events themselves are delivered next frame, older than this sample.
+		SDL_PumpEvents();
+		float x = 0.0f;
+		float y = 0.0f;
+		SDL_GetMouseState(&x, &y);
+		OnMouseMoved({ x, y });
+	}
+
     void AppLayer::RequestPlay() {
         if (m_SceneState == SceneState::Play)
             return;
@@ -63,6 +136,16 @@ namespace Nova::App {
             return;
         }
 
+        m_PlaySnapshot.Capture(m_Scene.GetRegistry());
+        const World::SceneSnapshotStats& snapshot = m_PlaySnapshot.GetStats();
+        NV_LOG_INFO(std::format("Play snapshot: {} entities, {} components, {:.1f} MB in {:.2f} ms",
+            snapshot.m_Entities, snapshot.m_Components, snapshot.m_Bytes / (1024.0 * 1024.0), snapshot.m_CaptureMs).c_str());
+
+        if (m_Simulation.GetSystemCount() == 0)
+            NV_LOG_INFO("Simulation: no systems registered, ticks only extract render snapshots.");
+        m_Simulation.SubmitCamera(*m_Camera);
+        m_Simulation.Start(m_Scene.GetRegistry(), m_TransformCache, m_MaterialBlocks);
+
         // Replace the current EditorLayer with GameLayer (keep AppLayer alive for UI).
         Nova::Core::Application::Get().GetLayerStack().QueueLayerTransition<GameLayer>(m_EditorLayer);
         std::cout << "AppLayer: Transition to GameLayer requested.\n";
@@ -83,6 +166,30 @@ namespace Nova::App {
         Nova::Core::Application::Get().GetLayerStack().QueueLayerTransition<EditorLayer>(m_GameLayer);
         std::cout << "AppLayer: Transition to EditorLayer requested.\n";
 
+        // The simulation thread must be gone before the registry is restored.
+        if (m_Simulation.IsRunning()) {
+            const Simulation::SimulationStats simulation = m_Simulation.GetStats();
+            m_Simulation.Stop();
+            NV_LOG_INFO(std::format("Simulation ({}): {} ticks, {:.1f} ticks/s, {:.1f} fps, input latency {:.1f} ms avg / {:.1f} ms max",
+                simulation.m_Mode == Simulation::SimulationMode::Decoupled ? "decoupled" : "coupled",
+                simulation.m_Ticks, simulation.m_TicksPerSecond, simulation.m_FramesPerSecond,
+                simulation.m_InputLatencyMs, simulation.m_MaxInputLatencyMs).c_str());
+        }
+        m_RenderFrame.reset();
+        m_RenderCamera.reset();
+
+        if (m_PlaySnapshot.IsCaptured()) {
+            m_PlaySnapshot.Restore(m_Scene.GetRegistry());
+            m_MaterialBlocks.MarkAllDirty();   // in-place restores write materials without signals
+            const World::SceneSnapshotStats& snapshot = m_PlaySnapshot.GetStats();
+            NV_LOG_INFO(std::format("Play snapshot restored in {:.2f} ms ({} columns copied, {} reinserted, {} entities destroyed, {} recreated)",
+                snapshot.m_RestoreMs, snapshot.m_ColumnsCopied, snapshot.m_ColumnsReinserted,
+                snapshot.m_EntitiesDestroyed, snapshot.m_EntitiesRecreated).c_str());
+
+            if (!m_Scene.GetRegistry().valid(m_SelectedEntity))
+                m_SelectedEntity = entt::null;
+        }
+
         SetSceneState(SceneState::Edit);
     }
 
@@ -91,38 +198,24 @@ namespace Nova::App {
 
         GraphicsAPI api = Nova::Core::Application::Get().GetWindow().GetGraphicsAPI();
 		m_Renderer = Nova::Core::Renderer::RHI::IRenderer::Create(api);
+		ReportMissingCoreHooks();
 
-        // camera setup
-		m_Camera = std::make_shared<Renderer::Graphics::Camera>(
-            glm::vec3(5.0f, 5.0f, 5.0f),               // lookFrom
-            glm::vec3(0.0f, 0.0f, 0.0f),                // lookAt
-            glm::vec3(0.0f, 1.0f, 0.0f),                // up
-            45.0f,                                      // FOV in degree
-            16.0f / 9.0f,                               // aspect ratio
-            0.1f,                                       // near
-            100.0f,                                     // far
-            true                                        // perspective
-        );
-		m_Camera->m_IsPerspective = true;
-		m_Camera->m_FOV = 45.0f;
-		m_Camera->m_NearPlane = 0.1f;
-		m_Camera->m_FarPlane = 100.0f;
-		m_Camera->m_Up = {0.0f, 1.0f, 0.0f};
-
-        entt::entity cameraEntity = m_Scene.CreateEntity("Camera");
-
-        m_Scene.SetMainCamera(cameraEntity);
+		// Before any pipeline exists: merge last run's pipeline cache, then start building the known ones.
+		Rendering::LoadPipelineCache(*m_Renderer, m_PipelineCacheStats);
+		Rendering::BindViewportTargetAllocator(m_ViewportTargets, *m_Renderer);
+		m_FramePacer.SetSettings(s_FramePacing);
+		m_ShaderLibrary.Prewarm(*m_Renderer, { EditorLayer::GetGridShaderDesc() });
 
 		auto& registry = m_Scene.GetRegistry();
-        registry.emplace<CameraComponent>(
-            cameraEntity,
-            m_Camera,
-            true // isPrimary
-        );
+		m_TransformCache.Connect(registry);
+		m_MaterialBlocks.Connect(registry);
+		m_HierarchyIndex.Connect(registry);
 
-        auto cubeAsset = AssetManager::Get().Acquire<MeshAsset>("Engine://Primitives/Cube").GetAssetRef();
-		cubeAsset->Load();
-		entt::entity cubeEntity = m_Scene.CreateEntity("Cube");
+		CreateEditorCamera();
+
+        // Streamed: the entities are drawn as soon as their meshes finish uploading.
+        auto cubeAsset = Streaming::AssetStreamer::Get().Acquire<MeshAsset>("Engine://Primitives/Cube").GetAssetRef();
+		entt::entity cubeEntity = World::CreateNamedEntity(m_Scene, "Cube");
 
 		registry.emplace<TransformComponent>(cubeEntity,
             glm::vec3(0.0f, 0.5f, 0.0f),
@@ -135,9 +228,8 @@ namespace Nova::App {
 			registry.emplace<MeshRendererComponent>(cubeEntity, cubeAsset, mat);
 		}
 
-		auto planeAsset = AssetManager::Get().Acquire<MeshAsset>("Engine://Primitives/Plane").GetAssetRef();
-		planeAsset->Load();
-		entt::entity planeEntity = m_Scene.CreateEntity("Plane");
+		auto planeAsset = Streaming::AssetStreamer::Get().Acquire<MeshAsset>("Engine://Primitives/Plane").GetAssetRef();
+		entt::entity planeEntity = World::CreateNamedEntity(m_Scene, "Plane");
 
 		registry.emplace<TransformComponent>(planeEntity,
             glm::vec3(0.0f, 0.0f, 0.0f),
@@ -152,22 +244,98 @@ namespace Nova::App {
 
 		UpdateCameraAspectFromWindow();
     	UpdateCameraFromOrbit();
+
+		m_StartupMs = GetMillisecondsSinceStartup();
     }
 
     void AppLayer::OnDetach() {
         NV_ASSERT_MSG(m_Renderer, "Renderer is not initialized.");
+        // First: a decoupled tick may still be reading the registry, the transform cache and the meshes.
+        m_Simulation.Stop();
+		Streaming::AssetStreamer::Get().Shutdown();
+		Rendering::SavePipelineCache(*m_Renderer, m_PipelineCacheStats);
+		m_ShaderLibrary.Clear(*m_Renderer);
+		Rendering::MeshLODLibrary::Get().Clear();
+		m_ViewportTargets.Clear();
 		m_Renderer->Destroy();
 		m_Renderer.reset();
-
+		m_MaterialBinder.Invalidate();
+		m_MeshBounds.Clear();
+		m_LODSelector.Clear();
+		m_GpuScene.Clear();
+		m_GpuCulling.Clear();
+		m_DepthPyramidValid = false;
+
+        m_TransformCache.Disconnect();
+        m_MaterialBlocks.Disconnect();
+        m_HierarchyIndex.Disconnect();
+        m_PlaySnapshot.Reset();
         m_Scene.Clear();
 
         if (g_AppLayer == this)
             g_AppLayer = nullptr;
     }
 
+    void AppLayer::CreateEditorCamera() {
+        // camera setup
+		if (!m_Camera) {
+			m_Camera = std::make_shared<Renderer::Graphics::Camera>(
+				glm::vec3(5.0f, 5.0f, 5.0f),               // lookFrom
+				glm::vec3(0.0f, 0.0f, 0.0f),                // lookAt
+				glm::vec3(0.0f, 1.0f, 0.0f),                // up
+				45.0f,                                      // FOV in degree
+				16.0f / 9.0f,                               // aspect ratio
+				0.1f,                                       // near
+				100.0f,                                     // far
+				true                                        // perspective
+			);
+		}
+		m_Camera->m_IsPerspective = true;
+		m_Camera->m_FOV = 45.0f;
+		m_Camera->m_NearPlane = 0.1f;
+		m_Camera->m_FarPlane = 100.0f;
+		m_Camera->m_Up = {0.0f, 1.0f, 0.0f};
+
+        entt::entity cameraEntity = World::CreateNamedEntity(m_Scene, "Camera");
+
+        m_Scene.SetMainCamera(cameraEntity);
+
+        m_Scene.GetRegistry().emplace<CameraComponent>(
+            cameraEntity,
+            m_Camera,
+            true // isPrimary
+        );
+    }
+
     void AppLayer::OnUpdate(float dt) {
+        NV_PROFILE_SCOPE("AppLayer::OnUpdate");
         m_DeltaTime = dt;
         m_ElapsedTime += dt;
+
+        ProcessPendingSceneFile();
+        // Camera input first, so the simulation and the frame see this frame's orbit.
+        DispatchInputEvents();
+
+        if (m_Simulation.IsDecoupled())
+            m_Simulation.SubmitCamera(*m_Camera);
+
+        // Uploads and scene edits below must not overlap a decoupled simulation tick.
+        auto world = m_Simulation.LockWorld();
+
+        // Lets fire-and-forget jobs make progress when the job system runs without worker threads.
+        Jobs::JobSystem::Get().RunPending(k_MainThreadJobBudget);
+        {
+            NV_PROFILE_SCOPE("AssetStreamer::Update");
+            Streaming::AssetStreamer::Get().Update();
+        }
+        // Per-mesh caches are keyed by address: forget released meshes before one can reuse it.
+        Rendering::MeshLODLibrary::Get().Prune();
+        m_MeshBounds.Prune();
+
+        if (m_InstancingBenchmark.IsRunning())
+            m_InstancingBenchmark.OnUpdate(*this, dt);
+        if (m_GpuDrivenBenchmark.IsRunning())
+            m_GpuDrivenBenchmark.OnUpdate(*this, dt);
     }
 	
 	void AppLayer::OnBegin() {
@@ -183,42 +351,346 @@ namespace Nova::App {
 	}
 
 	void AppLayer::BeginRenderScene() {
+		NV_PROFILE_SCOPE("AppLayer::BeginRenderScene");
 		NV_ASSERT_MSG(m_Renderer, "Renderer is not initialized.");
 		NV_ASSERT_MSG(m_Camera, "Camera is not initialized.");
 
-		if (m_ViewportResizePending) {
-			m_ViewportResizePending = false;
-			if (m_PendingViewportSize.x > 0 && m_PendingViewportSize.y > 0) {
-				m_Renderer->Resize(m_PendingViewportSize.x, m_PendingViewportSize.y);
-			}
+		// Dynamic resolution: the scene renders at a scaled size. With the renderer's upscale hook the
+		// viewport texture keeps the panel size and the scene is resampled into it; otherwise the
+		// viewport texture itself is at the render size and ImGui stretches it over the panel (plain bilinear).
+		// Without GPU timestamps the CPU work time stands in: the frame delta would include the
+		// vsync wait and never drop below the refresh interval.
+		if (m_DynamicResolution.IsEnabled()) {
+			const std::optional<float> gpuMs = Rendering::ReadGpuFrameMs(*m_Renderer);
+			const auto& pacing = m_FramePacer.GetStats();
+			m_DynamicResolution.Update(gpuMs ? *gpuMs : pacing.m_CpuWorkMs, gpuMs.has_value(), pacing.m_DisplayIntervalMs);
 		}
 
-		m_Renderer->BeginFrame();
+		constexpr bool upscaleSupported = Rendering::ViewportUpscaleSupport<Nova::Core::Renderer::RHI::IRenderer>;
+		const glm::uvec2 panelSize(static_cast<uint32_t>(m_PendingViewportSize.x), static_cast<uint32_t>(m_PendingViewportSize.y));
+		const glm::uvec2 renderSize = m_DynamicResolution.GetRenderSize(m_PendingViewportSize);
+		UpdateViewportTarget(upscaleSupported ? panelSize : renderSize);
+		if constexpr (upscaleSupported) {
+			if (renderSize != m_RenderSize && renderSize.x > 0 && renderSize.y > 0)
+				Rendering::SetViewportRenderSize(*m_Renderer, renderSize.x, renderSize.y);
+			m_RenderSize = renderSize;
+		}
+		else {
+			m_RenderSize = m_TargetSize;
+		}
 
-		const glm::mat4 view = m_Camera->GetViewMatrix();
-		const glm::mat4 proj = m_Camera->GetProjectionMatrix();
+		m_RenderStats.Reset();
+
+		// Decoupled play draws the two latest simulation snapshots, camera included.
+		m_RenderFrame = m_Simulation.AcquireFrame();
+		m_RenderCamera.reset();
+		if (m_RenderFrame && m_RenderFrame->m_Previous->m_Camera && m_RenderFrame->m_Current->m_Camera)
+			m_RenderCamera = Simulation::InterpolateCamera(*m_RenderFrame->m_Previous->m_Camera, *m_RenderFrame->m_Current->m_Camera, m_RenderFrame->m_Alpha);
+
+		// Present mode and frames in flight change between frames; staging and released viewport
+		// targets must outlive the frames in flight.
+		if (m_FramePacer.Apply(*m_Renderer)) {
+			Streaming::AssetStreamer::Get().SetFramesInFlight(m_FramePacer.GetFramesInFlight());
+			m_ViewportTargets.SetFramesInFlight(m_FramePacer.GetFramesInFlight());
+		}
+
+		{
+			NV_PROFILE_SCOPE("Renderer::BeginFrame");
+			const auto waitStart = std::chrono::steady_clock::now();
+			m_Renderer->BeginFrame();   // waits on the fence of the frame slot it reuses
+			m_FramePacer.OnFrameBegin(waitStart, std::chrono::steady_clock::now());
+		}
+		if (m_FramePacer.IsLowLatency()) {
+			SampleLatestInput();
+			m_FramePacer.OnInputSampled(std::chrono::steady_clock::now());
+		}
+		else {
+			m_FramePacer.OnInputSampled(m_InputSampleTime);
+		}
+		if (m_DynamicResolution.IsEnabled())
+			Rendering::BeginGpuFrameTiming(*m_Renderer);
+
+		const Camera& camera = GetRenderCamera();
+		const glm::mat4 view = camera.GetViewMatrix();
+		const glm::mat4 proj = camera.GetProjectionMatrix();
 
 		m_Renderer->BeginScene(view, proj);
 
+		// The viewport targets are owned by the renderer: sampled by ImGui (or the upscale) at the end
+		// of the previous frame, depth discarded. The scene targets are at the render size.
+		const uint32_t width = m_RenderSize.x;
+		const uint32_t height = m_RenderSize.y;
+		m_RenderGraph.Reset();
+		m_ViewportDepth = m_RenderGraph.Import({ "Viewport Depth", width, height, Rendering::RGFormat::Depth32F }, Rendering::RGState::Undefined, Rendering::RGState::Undefined);
+		if (IsViewportUpscaled()) {
+			m_ViewportColor = m_RenderGraph.Import({ "Scene Color", width, height, Rendering::RGFormat::RGBA8 }, Rendering::RGState::ShaderRead, Rendering::RGState::ShaderRead);
+			m_ViewportOutput = m_RenderGraph.Import({ "Viewport Color", m_TargetSize.x, m_TargetSize.y, Rendering::RGFormat::RGBA8 },
+				Rendering::RGState::ShaderRead, Rendering::RGState::ShaderRead);
+		}
+		else {
+			m_ViewportColor = m_RenderGraph.Import({ "Viewport Color", width, height, Rendering::RGFormat::RGBA8 }, Rendering::RGState::ShaderRead, Rendering::RGState::ShaderRead);
+			m_ViewportOutput = m_ViewportColor;
+		}
+
 		if (auto* shader = m_Renderer->GetShader()) {
 			shader->SetParameter("iTime", m_ElapsedTime);
 			shader->SetParameter("iTimeDelta", m_DeltaTime);
 			shader->SetParameter("iFrameRate", m_DeltaTime > 0.0f ? 1.0f / m_DeltaTime : 0.0f);
 			shader->SetParameter("iFrame", static_cast<int>(m_FrameIndex++));
-			shader->SetParameter("iResolution", glm::vec3(m_ViewportSize.x, m_ViewportSize.y, 1.0f));
+			shader->SetParameter("iResolution", glm::vec3(float(width), float(height), 1.0f));
 		}
 	}
 
 	void AppLayer::RenderScene() {
+		NV_PROFILE_SCOPE("AppLayer::RenderScene");
 		NV_ASSERT_MSG(m_Renderer, "Renderer is not initialized.");
 		NV_ASSERT_MSG(m_Camera, "Camera is not initialized.");
 
+		using Clock = std::chrono::steady_clock;
+		const auto cpuStart = Clock::now();
+
+		auto* shader = m_Renderer->GetShader();
+		NV_ASSERT_MSG(shader, "Scene shader is not initialized.");
+		// Other passes and layers may have set the material parameters since the last frame.
+		m_MaterialBinder.Invalidate();
+
+		const Camera& camera = GetRenderCamera();
+		const bool useGpuDriven = m_GpuDrivenEnabled && IsGpuDrivenSupported();
+		const bool useBindless = useGpuDriven || (m_BindlessEnabled && IsBindlessSupported());
+		const bool useInstancing = !useBindless && m_InstancingEnabled && IsInstancingSupported();
+
+		// Draw-invariant parameters: uploaded once per frame instead of once per draw.
+		Rendering::UploadParameter(*shader, "u_UseInstancing", useInstancing ? 1 : 0, m_RenderStats);
+		Rendering::UploadParameter(*shader, "u_Bindless", useBindless ? 1 : 0, m_RenderStats);
+		Rendering::UploadParameter(*shader, "u_CameraPos", camera.m_LookFrom, m_RenderStats);
+
+		m_DrawCandidates.clear();
+		m_WorldBounds.Clear();
+
+		if (m_RenderFrame)
+			GatherFromSnapshots(*m_RenderFrame);
+		else
+			GatherFromRegistry();
+
+		// Frustum culling over the packed bounds, before anything reaches the renderer. In GPU-driven
+		// mode only the transparent objects are left to it.
+		m_VisibleIndices.clear();
+		if (useGpuDriven) {
+			NV_PROFILE_SCOPE("GpuCulling");
+			GatherGpuObjects(camera);
+		}
+		else {
+			NV_PROFILE_SCOPE("Cull");
+			if (m_FrustumCullingEnabled) {
+				const auto frustum = Rendering::Frustum::FromViewProjection(camera.GetProjectionMatrix() * camera.GetViewMatrix());
+				Rendering::CullAABBsParallel(frustum, m_WorldBounds, m_VisibleIndices, Jobs::JobSystem::Get());
+			}
+			else {
+				for (uint32_t i = 0; i < static_cast<uint32_t>(m_DrawCandidates.size()); ++i)
+					m_VisibleIndices.push_back(i);
+			}
+		}
+
+		m_RenderStats.m_GpuObjects = useGpuDriven ? m_GpuCulling.GetObjectCount() : 0;
+		m_RenderStats.m_Visible = static_cast<uint32_t>(m_VisibleIndices.size());
+		m_RenderStats.m_Culled = static_cast<uint32_t>(m_DrawCandidates.size() - m_RenderStats.m_GpuObjects - m_VisibleIndices.size());
+
+		{
+			NV_PROFILE_SCOPE("LOD");
+			SelectLODs(camera);
+		}
+
+		{
+			NV_PROFILE_SCOPE("Sort");
+			m_RenderQueue.Begin(camera.GetViewMatrix(), camera.m_FarPlane);
+			for (uint32_t index : m_VisibleIndices) {
+				const auto& candidate = m_DrawCandidates[index];
+				m_RenderQueue.Submit(candidate.m_Mesh, candidate.m_IndexCount, *candidate.m_Material, candidate.m_Transform, index);
+			}
+
+			// Sorted by (pass, shader, material, mesh, depth): opaque front-to-back, transparent back-to-front.
+			m_RenderQueue.Sort(m_RenderStats);
+		}
+
+		// Bindless: draw ids follow the sorted order, so a run's draws are consecutive ids (after those
+		// of the GPU-culled objects).
+		uint32_t queueFirstDraw = 0;
+		if (useBindless) {
+			NV_PROFILE_SCOPE("GpuScene");
+			if (!useGpuDriven)
+				m_GpuScene.BeginFrame();
+			queueFirstDraw = m_GpuScene.GetDrawCount();
+			for (const auto& run : m_RenderQueue.GetRuns()) {
+				for (uint32_t object : m_RenderQueue.GetObjects(run)) {
+					const auto& candidate = m_DrawCandidates[object];
+					m_GpuScene.AddDraw(m_GpuScene.AcquireTransform(candidate.m_Entity, candidate.m_Transform),
+						m_GpuScene.AcquireMaterial(*candidate.m_Material));
+				}
+			}
+			m_GpuScene.Upload<Nova::Core::Renderer::RHI::IRenderer, Nova::Core::Renderer::RHI::RHI_DrawIndexedCommand>(*m_Renderer);
+		}
+
+		m_RenderStats.m_SceneCpuTimeMs = std::chrono::duration<float, std::milli>(Clock::now() - cpuStart).count();
+
+		// Culling dispatch: compute, so recorded ahead of the scene's render pass.
+		if (useGpuDriven) {
+			const glm::mat4 proj = camera.GetProjectionMatrix();
+			const auto frustum = Rendering::Frustum::FromViewProjection(proj * camera.GetViewMatrix());
+
+			Rendering::GpuCullingParams params{};
+			std::copy(frustum.m_Planes.begin(), frustum.m_Planes.end(), params.m_Planes);
+			params.m_OcclusionViewProj = m_DepthPyramidViewProj;
+			params.m_CameraPos = glm::vec4(camera.m_LookFrom, camera.m_NearPlane);
+			params.m_PixelsPerUnit = Rendering::ProjectedPixelsPerUnit(proj, camera.m_IsPerspective, m_ViewportSize.y, 1.0f);
+			params.m_LODThreshold = m_LODSelector.GetThreshold();
+			params.m_Flags = (m_FrustumCullingEnabled ? Rendering::GpuCullingFlags::k_Frustum : 0)
+				| (m_OcclusionCullingEnabled && m_DepthPyramidValid ? Rendering::GpuCullingFlags::k_Occlusion : 0)
+				| (m_MeshLODEnabled ? Rendering::GpuCullingFlags::k_LOD : 0)
+				| (camera.m_IsPerspective ? Rendering::GpuCullingFlags::k_Perspective : 0);
+
+			m_RenderGraph.AddPass("Culling",
+				[](Rendering::RenderGraph::PassBuilder& builder) { builder.SetSideEffect(); },
+				[this, params] {
+					NV_PROFILE_SCOPE("Culling");
+					NV_PROFILE_GPU_SCOPE(m_Renderer.get(), "Culling");
+					const auto dispatchStart = Clock::now();
+					m_GpuCulling.Dispatch<Nova::Core::Renderer::RHI::IRenderer, Nova::Core::Renderer::RHI::RHI_DrawIndexedCommand>(*m_Renderer, params);
+					const float dispatchMs = std::chrono::duration<float, std::milli>(Clock::now() - dispatchStart).count();
+					m_RenderStats.m_SceneCpuTimeMs += dispatchMs;
+					m_RenderStats.m_SubmitCpuTimeMs += dispatchMs;
+				});
+		}
+		m_DepthPyramidValid = false;
+
+		// One material bind per run; one instanced draw per run when the renderer supports it.
+		m_RenderGraph.AddPass("Scene",
+			[this](Rendering::RenderGraph::PassBuilder& builder) {
+				builder.Write(m_ViewportColor, Rendering::RGState::ColorAttachment);
+				builder.Write(m_ViewportDepth, Rendering::RGState::DepthAttachment);
+			},
+			[this, shader, useInstancing, useBindless, useGpuDriven, queueFirstDraw] {
+				NV_PROFILE_SCOPE("Submit");
+				NV_PROFILE_GPU_SCOPE(m_Renderer.get(), "Scene");
+				const auto submitStart = Clock::now();
+
+				// GPU-driven: one indirect-count draw per mesh over the commands the culling pass wrote.
+				if (useGpuDriven) {
+					const auto& meshes = m_GpuCulling.GetBucketMeshes();
+					for (uint32_t bucket = 0; bucket < static_cast<uint32_t>(meshes.size()); ++bucket) {
+						Nova::Core::Renderer::RHI::RHI_DrawIndexedCommand cmd{};
+						cmd.m_Mesh = meshes[bucket];
+						cmd.m_Topology = Nova::Core::Renderer::RHI::RHI_PrimitiveTopology::Triangles;
+						cmd.m_IndexType = Nova::Core::Renderer::RHI::RHI_IndexType::UInt32;
+
+						m_GpuCulling.Draw(*m_Renderer, cmd, bucket);
+						++m_RenderStats.m_DrawCalls;
+						++m_RenderStats.m_IndirectDraws;
+					}
+				}
+
+				for (const auto& run : m_RenderQueue.GetRuns()) {
+					if (!useBindless)
+						m_MaterialBinder.Bind(*shader, m_RenderQueue.GetMaterial(run), m_RenderStats);
+
+					Nova::Core::Renderer::RHI::RHI_DrawIndexedCommand cmd{};
+					cmd.m_Mesh = m_RenderQueue.GetMesh(run);
+					cmd.m_Topology = Nova::Core::Renderer::RHI::RHI_PrimitiveTopology::Triangles;
+					cmd.m_IndexType = Nova::Core::Renderer::RHI::RHI_IndexType::UInt32;
+					cmd.m_IndexCount = m_RenderQueue.GetIndexCount(run);
+
+					m_RenderStats.m_Instances += run.m_InstanceCount;
+
+					// Mesh + draw ids: transforms and materials are already in the scene buffers.
+					if (useBindless && Rendering::DrawBindless(*m_Renderer, cmd, queueFirstDraw + run.m_FirstInstance, run.m_InstanceCount)) {
+						++m_RenderStats.m_DrawCalls;
+						++m_RenderStats.m_BindlessDraws;
+						continue;
+					}
+
+					const auto transforms = m_RenderQueue.GetTransforms(run);
+
+					if (useInstancing && Rendering::DrawInstanced(*m_Renderer, cmd, transforms)) {
+						++m_RenderStats.m_DrawCalls;
+						++m_RenderStats.m_InstancedBatches;
+						continue;
+					}
+
+					for (const glm::mat4& model : transforms) {
+						m_Renderer->SetModelMatrix(model);
+						m_Renderer->DrawIndexed(cmd);
+						++m_RenderStats.m_DrawCalls;
+					}
+				}
+
+				const float submitMs = std::chrono::duration<float, std::milli>(Clock::now() - submitStart).count();
+				m_RenderStats.m_SceneCpuTimeMs += submitMs;
+				m_RenderStats.m_SubmitCpuTimeMs += submitMs;
+			});
+
+		// Max-depth pyramid of this frame's depth, for next frame's occlusion culling.
+		if (useGpuDriven && m_OcclusionCullingEnabled && IsOcclusionCullingSupported()) {
+			m_RenderGraph.AddPass("Depth Pyramid",
+				[this](Rendering::RenderGraph::PassBuilder& builder) {
+					builder.Read(m_ViewportDepth, Rendering::RGState::ShaderRead);
+					builder.SetSideEffect();
+				},
+				[this, viewProj = camera.GetProjectionMatrix() * camera.GetViewMatrix()] {
+					NV_PROFILE_GPU_SCOPE(m_Renderer.get(), "Depth Pyramid");
+					m_DepthPyramidValid = Rendering::BuildDepthPyramid(*m_Renderer);
+					m_DepthPyramidViewProj = viewProj;
+				});
+		}
+
+		if (IsViewportUpscaled()) {
+			m_RenderGraph.AddPass("Upscale",
+				[this](Rendering::RenderGraph::PassBuilder& builder) {
+					builder.Read(m_ViewportColor, Rendering::RGState::ShaderRead);
+					builder.Write(m_ViewportOutput, Rendering::RGState::ColorAttachment);
+				},
+				[this] {
+					NV_PROFILE_GPU_SCOPE(m_Renderer.get(), "Upscale");
+					Rendering::UpscaleViewport(*m_Renderer, m_DynamicResolution.GetSettings().m_Sharpness);
+				});
+		}
+
+		// ImGui samples the viewport color.
+		m_RenderGraph.AddPass("Viewport",
+			[this](Rendering::RenderGraph::PassBuilder& builder) {
+				builder.Read(m_ViewportOutput, Rendering::RGState::ShaderRead);
+				builder.SetSideEffect();
+			},
+			[this] { m_Renderer->PrepareForImGui(); });
+
+		ExecuteRenderGraph();
+	}
+
+	void AppLayer::ExecuteRenderGraph() {
+		m_RenderGraph.Compile();
+		m_RenderGraph.Execute([this](const Rendering::RGBarrier& barrier) {
+			if (!barrier.IsTransition())
+				return;
+			const bool depth = barrier.m_Texture.m_Index == m_ViewportDepth.m_Index;
+			Rendering::TransitionViewportImage(*m_Renderer, depth, Rendering::ToVkImageLayout(barrier.m_Before), Rendering::ToVkImageLayout(barrier.m_After));
+		});
+	}
+
+	void AppLayer::GatherFromRegistry() {
 		auto& registry = m_Scene.GetRegistry();
 
-		// ECS traversal: draw all entities that have a transform and a mesh renderer.
-		auto viewMeshes = registry.view<TransformComponent, MeshRendererComponent>();
+		// Recompose only the transforms that changed since the last frame.
+		{
+			NV_PROFILE_SCOPE("Transforms");
+			m_TransformCache.Update();
+			m_RenderStats.m_TransformsUpdated = m_TransformCache.GetUpdatedCount();
+		}
+
+		// Material blocks: repacked only for the renderers whose material changed since the last frame.
+		m_RenderStats.m_MaterialBlocksUpdated = m_MaterialBlocks.Update();
+
+		// ECS traversal: gather every entity that has a transform and a mesh renderer, with its world bounds.
+		NV_PROFILE_SCOPE("Gather");
+		auto viewMeshes = registry.view<TransformComponent, MeshRendererComponent, Rendering::MaterialBlockComponent>();
 		for (auto entity : viewMeshes) {
-			auto& tc = viewMeshes.get<TransformComponent>(entity);
 			auto& mrc = viewMeshes.get<MeshRendererComponent>(entity);
 
 			if (!mrc.m_MeshAsset || !mrc.m_MeshAsset->IsLoaded())
@@ -228,65 +700,346 @@ namespace Nova::App {
 			if (!gpuMesh)
 				continue;
 
-			Nova::Core::Renderer::RHI::RHI_DrawIndexedCommand cmd{};
-			cmd.m_Mesh = gpuMesh;
-			cmd.m_Topology = Nova::Core::Renderer::RHI::RHI_PrimitiveTopology::Triangles;
-			cmd.m_IndexType = Nova::Core::Renderer::RHI::RHI_IndexType::UInt32;
-			cmd.m_IndexCount = static_cast<uint32_t>(gpuMesh->GetIndices().size());
-
-			m_Renderer->SetModelMatrix(tc.GetTransform());
-			m_Renderer->GetShader()->SetParameter("u_UseInstancing", 0);
-			m_Renderer->GetShader()->SetParameter("u_CameraPos", m_Camera->m_LookFrom);
-
-			//TODO function to set the material parameters
-
-			m_Renderer->GetShader()->SetParameter("base", mrc.m_Material.base);
-			m_Renderer->GetShader()->SetParameter("baseColor", mrc.m_Material.baseColor);
-			m_Renderer->GetShader()->SetParameter("diffuseRoughness", mrc.m_Material.diffuseRoughness);
-			m_Renderer->GetShader()->SetParameter("metalness", mrc.m_Material.metalness);
-			m_Renderer->GetShader()->SetParameter("metalColor", mrc.m_Material.metalColor);
-			m_Renderer->GetShader()->SetParameter("specular", mrc.m_Material.specular);
-			m_Renderer->GetShader()->SetParameter("specularColor", mrc.m_Material.specularColor);
-			m_Renderer->GetShader()->SetParameter("specularRoughness", mrc.m_Material.specularRoughness);
-			m_Renderer->GetShader()->SetParameter("specularIOR", mrc.m_Material.specularIOR);
-			m_Renderer->GetShader()->SetParameter("specularAnisotropy", mrc.m_Material.specularAnisotropy);
-			m_Renderer->GetShader()->SetParameter("specularRotation", mrc.m_Material.specularRotation);
-			m_Renderer->GetShader()->SetParameter("transmission", mrc.m_Material.transmission);
-			m_Renderer->GetShader()->SetParameter("transmissionColor", mrc.m_Material.transmissionColor);
-			m_Renderer->GetShader()->SetParameter("subsurface", mrc.m_Material.subsurface);
-			m_Renderer->GetShader()->SetParameter("subsurfaceColor", mrc.m_Material.subsurfaceColor);
-			m_Renderer->GetShader()->SetParameter("subsurfaceRadius", mrc.m_Material.subsurfaceRadius);
-			m_Renderer->GetShader()->SetParameter("subsurfaceScale", mrc.m_Material.subsurfaceScale);
-			m_Renderer->GetShader()->SetParameter("subsurfaceAnisotropy", mrc.m_Material.subsurfaceAnisotropy);
-			m_Renderer->GetShader()->SetParameter("sheen", mrc.m_Material.sheen);
-			m_Renderer->GetShader()->SetParameter("sheenColor", mrc.m_Material.sheenColor);
-			m_Renderer->GetShader()->SetParameter("sheenRoughness", mrc.m_Material.sheenRoughness);
-			m_Renderer->GetShader()->SetParameter("coat", mrc.m_Material.coat);
-			m_Renderer->GetShader()->SetParameter("coatColor", mrc.m_Material.coatColor);
-			m_Renderer->GetShader()->SetParameter("coatRoughness", mrc.m_Material.coatRoughness);
-			m_Renderer->GetShader()->SetParameter("coatAnisotropy", mrc.m_Material.coatAnisotropy);
-			m_Renderer->GetShader()->SetParameter("coatRotation", mrc.m_Material.coatRotation);
-			m_Renderer->GetShader()->SetParameter("coatIOR", mrc.m_Material.coatIOR);
-			m_Renderer->GetShader()->SetParameter("coatAffectColor", mrc.m_Material.coatAffectColor);
-			m_Renderer->GetShader()->SetParameter("coatAffectRoughness", mrc.m_Material.coatAffectRoughness);
-			m_Renderer->GetShader()->SetParameter("emission", mrc.m_Material.emission);
-			m_Renderer->GetShader()->SetParameter("emissionColor", mrc.m_Material.emissionColor);
-			m_Renderer->GetShader()->SetParameter("opacity", mrc.m_Material.opacity);
-			m_Renderer->GetShader()->SetParameter("thinWalled", mrc.m_Material.thinWalled);
-			m_Renderer->GetShader()->SetParameter("isOpaque", static_cast<int>(mrc.m_Material.isOpaque));
-			
-			m_Renderer->DrawIndexed(cmd);
-		}
-
-		m_Renderer->PrepareForImGui();
+			const auto& block = viewMeshes.get<Rendering::MaterialBlockComponent>(entity);
+			const glm::mat4& transform = m_TransformCache.GetWorldMatrix(entity);
+			m_WorldBounds.Add(entity, transform, m_MeshBounds.Get(gpuMesh));
+			m_DrawCandidates.push_back({ entity, gpuMesh, static_cast<uint32_t>(gpuMesh->GetIndices().size()), &block, transform });
+		}
+	}
+
+	void AppLayer::GatherFromSnapshots(const Simulation::RenderFrame& frame) {
+		NV_PROFILE_SCOPE("Gather");
+		const Simulation::RenderSnapshot& previous = *frame.m_Previous;
+		const Simulation::RenderSnapshot& current = *frame.m_Current;
+
+		// Extraction keeps the view order, so an entity present in both ticks is almost always at the
+		// same index; one that is not (created, destroyed, reordered) is drawn at its current transform.
+		for (size_t i = 0; i < current.m_Items.size(); ++i) {
+			const Simulation::RenderItem& item = current.m_Items[i];
+			const bool matched = i < previous.m_Items.size() && previous.m_Items[i].m_Entity == item.m_Entity;
+			const glm::mat4 transform = Simulation::InterpolateTransform(matched ? previous.m_Items[i] : item, item, frame.m_Alpha);
+
+			const Simulation::RenderMesh& mesh = current.m_Meshes[item.m_Mesh];
+			m_WorldBounds.Add(item.m_Entity, transform, m_MeshBounds.Get(mesh.m_Mesh));
+			m_DrawCandidates.push_back({ item.m_Entity, mesh.m_Mesh, mesh.m_IndexCount, &current.m_Materials[item.m_Material], transform });
+		}
+	}
+
+	// Swaps each visible mesh for the level of its LOD chain that fits its projected size.
+	void AppLayer::SelectLODs(const Camera& camera) {
+		const auto& library = Rendering::MeshLODLibrary::Get();
+		const glm::mat4 proj = camera.GetProjectionMatrix();
+
+		// Entities sharing a mesh are usually gathered one after the other.
+		const void* lastMesh = nullptr;
+		const Rendering::MeshLODChain* chain = nullptr;
+
+		for (uint32_t index : m_VisibleIndices) {
+			auto& candidate = m_DrawCandidates[index];
+			m_RenderStats.m_TrianglesBeforeLOD += candidate.m_IndexCount / 3;
+
+			if (m_MeshLODEnabled) {
+				if (const void* mesh = std::to_address(candidate.m_Mesh); mesh != lastMesh) {
+					lastMesh = mesh;
+					chain = library.Find(candidate.m_Mesh);
+				}
+			}
+
+			if (m_MeshLODEnabled && chain) {
+				const float worldScale = Rendering::MaxAxisScale(candidate.m_Transform);
+
+				// Nearest point of the bounding sphere, so the level never undershoots the closest surface.
+				const float distance = std::max(glm::length(m_WorldBounds.GetCenter(index) - camera.m_LookFrom) - m_WorldBounds.GetRadius(index), camera.m_NearPlane);
+				const float pixelsPerUnit = Rendering::ProjectedPixelsPerUnit(proj, camera.m_IsPerspective, m_ViewportSize.y, distance);
+
+				const uint32_t level = m_LODSelector.Select(m_WorldBounds.GetEntity(index), *chain, worldScale, pixelsPerUnit);
+				if (level > 0) {
+					candidate.m_Mesh = chain->m_Levels[level].m_Mesh;
+					candidate.m_IndexCount = chain->m_Levels[level].m_IndexCount;
+					++m_RenderStats.m_LODReduced;
+				}
+			}
+
+			m_RenderStats.m_TrianglesAfterLOD += candidate.m_IndexCount / 3;
+		}
+	}
+
+	// GPU-driven: the opaque candidates become culling objects with consecutive draw ids; the transparent
+	// ones are frustum culled here and go through the render queue, which sorts them back-to-front.
+	void AppLayer::GatherGpuObjects(const Camera& camera) {
+		const auto& library = Rendering::MeshLODLibrary::Get();
+		const auto frustum = Rendering::Frustum::FromViewProjection(camera.GetProjectionMatrix() * camera.GetViewMatrix());
+
+		m_GpuScene.BeginFrame();
+		m_GpuCulling.BeginFrame();
+
+		const void* lastMesh = nullptr;
+		const Rendering::MeshLODChain* chain = nullptr;
+
+		for (uint32_t index = 0; index < static_cast<uint32_t>(m_DrawCandidates.size()); ++index) {
+			const auto& candidate = m_DrawCandidates[index];
+			if (!candidate.m_Material->m_Source.isOpaque) {
+				if (!m_FrustumCullingEnabled || Rendering::IsAABBVisible(frustum, m_WorldBounds, index))
+					m_VisibleIndices.push_back(index);
+				continue;
+			}
+
+			if (m_MeshLODEnabled) {
+				if (const void* mesh = std::to_address(candidate.m_Mesh); mesh != lastMesh) {
+					lastMesh = mesh;
+					chain = library.Find(candidate.m_Mesh);
+				}
+			}
+
+			const uint32_t draw = m_GpuScene.AddDraw(m_GpuScene.AcquireTransform(candidate.m_Entity, candidate.m_Transform),
+				m_GpuScene.AcquireMaterial(*candidate.m_Material));
+			const Rendering::MeshLODChain* levels = m_MeshLODEnabled ? chain : nullptr;
+			m_GpuCulling.AddObject(draw, m_WorldBounds, index, levels ? Rendering::MaxAxisScale(candidate.m_Transform) : 1.0f,
+				candidate.m_Mesh, candidate.m_IndexCount, levels);
+		}
+	}
+
+	bool AppLayer::IsViewportUpscaled() const {
+		return Rendering::ViewportUpscaleSupport<Nova::Core::Renderer::RHI::IRenderer>
+			&& m_RenderSize.x > 0
+			&& m_RenderSize != m_TargetSize;
+	}
+
+	void AppLayer::UpdateViewportTarget(const glm::uvec2& size) {
+		if (size.x == 0 || size.y == 0)
+			return;
+
+		const auto now = Rendering::ViewportTargetPool::Clock::now();
+		if constexpr (Rendering::ViewportTargetPoolSupport<Nova::Core::Renderer::RHI::IRenderer>) {
+			// Pooled, size-bucketed targets rendered through a sub-rect: dragging the panel allocates
+			// only when the size outgrows the pool, and the final reallocation waits for it to settle.
+			if (const auto* target = m_ViewportTargets.Acquire(size, now)) {
+				Rendering::BindViewportTarget(*m_Renderer, *target, size);
+				m_TargetSize = size;
+				m_ViewportUV = glm::vec2(float(size.x) / float(target->m_Width), float(size.y) / float(target->m_Height));
+			}
+		}
+		else {
+			// The renderer's one target is resized once the size has settled; until then ImGui
+			// stretches the previous one over the panel.
+			const bool settled = m_ViewportTargets.IsSettled(size, now);
+			if (size != m_TargetSize && (settled || m_TargetSize.x == 0)) {
+				m_Renderer->Resize(size.x, size.y);
+				m_TargetSize = size;
+			}
+		}
+	}
+
+	bool AppLayer::IsViewportUpscaleSupported() const {
+		return Rendering::ViewportUpscaleSupport<Nova::Core::Renderer::RHI::IRenderer>;
+	}
+
+	bool AppLayer::IsBindlessSupported() const {
+		return Rendering::BindlessDrawSupport<Nova::Core::Renderer::RHI::IRenderer, Nova::Core::Renderer::RHI::RHI_DrawIndexedCommand>;
+	}
+
+	bool AppLayer::IsGpuDrivenSupported() const {
+		return Rendering::GpuCullingSupport<Nova::Core::Renderer::RHI::IRenderer, Nova::Core::Renderer::RHI::RHI_DrawIndexedCommand>;
+	}
+
+	bool AppLayer::IsOcclusionCullingSupported() const {
+		return IsGpuDrivenSupported() && Rendering::DepthPyramidSupport<Nova::Core::Renderer::RHI::IRenderer>;
+	}
+
+	bool AppLayer::IsInstancingSupported() const {
+		return Rendering::InstancedDrawSupport<Nova::Core::Renderer::RHI::IRenderer, Nova::Core::Renderer::RHI::RHI_DrawIndexedCommand>;
+	}
+
+	void AppLayer::StartInstancingBenchmark(uint32_t cubeCount) {
+		auto world = m_Simulation.LockWorld();
+		m_InstancingBenchmark.Start(*this, cubeCount);
+	}
+
+	void AppLayer::StartGpuDrivenBenchmark(uint32_t objectCount) {
+		auto world = m_Simulation.LockWorld();
+		m_GpuDrivenBenchmark.Start(*this, objectCount);
 	}
 
 	void AppLayer::EndRenderScene() {
 		NV_ASSERT_MSG(m_Renderer, "Renderer is not initialized.");
-		m_Renderer->EndFrame();
+		if (m_DynamicResolution.IsEnabled())
+			Rendering::EndGpuFrameTiming(*m_Renderer);
+		const auto presentStart = std::chrono::steady_clock::now();
+		{
+			NV_PROFILE_SCOPE("Renderer::EndFrame");
+			m_Renderer->EndFrame();
+		}
+		m_FramePacer.OnFramePresented(presentStart, std::chrono::steady_clock::now());
+
+		if (m_Simulation.IsRunning())
+			m_Simulation.OnFramePresented();
+
+		// Frame boundary for the profiler: GPU zones resolved by now belong to an earlier frame
+		// and are shown against this one.
+		Profiling::CollectGpuZones(*m_Renderer);
+		Profiling::Profiler::Get().EndFrame();
+
+		++m_PresentedFrames;
+		if (m_PresentedFrames == 1) {
+			m_FirstFrameMs = GetMillisecondsSinceStartup();
+			NV_LOG_INFO(std::format("Startup {:.1f} ms, first frame {:.1f} ms (pipeline cache {})",
+				m_StartupMs, m_FirstFrameMs, m_PipelineCacheStats.m_Status));
+		}
+		else if (m_PresentedFrames == k_PipelineCacheSaveFrame) {
+			// Pipelines created lazily during the first frames are in by now; saving early means a
+			// crash later in the session still leaves a warm cache.
+			Rendering::SavePipelineCache(*m_Renderer, m_PipelineCacheStats);
+		}
 	}
 
+    void AppLayer::SetProfilerVisible(bool visible) {
+        m_ProfilerVisible = visible;
+        Profiling::Profiler::Get().SetEnabled(visible);
+    }
+
+    void AppLayer::FocusCamera(const glm::vec3& target, float distance) {
+        m_Orbit.m_Target = target;
+        m_Orbit.m_Distance = distance;
+        m_Camera->m_FarPlane = std::max(m_Camera->m_FarPlane, distance * 4.0f);
+        UpdateCameraFromOrbit();
+    }
+
+    namespace {
+
+        // Camera of a loaded CameraComponent; the component layout is only known through its members.
+        template <typename Component>
+        std::shared_ptr<Renderer::Graphics::Camera> GetPrimaryCamera(const Component& component) {
+            if constexpr (requires { component.m_Camera; component.m_IsPrimary; }) {
+                if (component.m_IsPrimary)
+                    return component.m_Camera;
+            }
+            return nullptr;
+        }
+
+    } // namespace
+
+    bool AppLayer::OpenScene(const std::filesystem::path& path) {
+        if (m_SceneState == SceneState::Play) {
+            NV_LOG_ERROR("Stop the game before opening a scene.");
+            return false;
+        }
+        if (!World::ProbeSceneFile(path)) {
+            NV_LOG_ERROR(std::format("'{}' is not a Nova scene file.", path.string()));
+            return false;
+        }
+
+        // The current scene is only cleared once the whole file has been validated: a corrupt file
+        // leaves it untouched.
+        World::SceneLoadOptions options;
+        options.m_BeforeInsert = [this]() {
+            m_Scene.Clear();
+            m_MaterialBinder.Invalidate();
+            m_SelectedEntity = entt::null;
+        };
+
+        auto& registry = m_Scene.GetRegistry();
+        if (!World::LoadScene(registry, path, options, &m_LastSceneIOStats))
+            return false;
+
+        // The scene's primary camera becomes the editor camera; without one, the default editor camera is recreated.
+        entt::entity cameraEntity = entt::null;
+        std::shared_ptr<Renderer::Graphics::Camera> camera;
+        for (auto [entity, component] : registry.view<CameraComponent>().each()) {
+            if ((camera = GetPrimaryCamera(component))) {
+                cameraEntity = entity;
+                break;
+            }
+        }
+
+        if (camera) {
+            m_Camera = camera;
+            m_Scene.SetMainCamera(cameraEntity);
+            SetOrbitFromCamera();
+        }
+        else {
+            CreateEditorCamera();
+            UpdateCameraFromOrbit();
+        }
+        UpdateCameraAspectFromWindow();
+        if (m_ViewportSize.x > 0.0f && m_ViewportSize.y > 0.0f)
+            m_Camera->m_AspectRatio = m_ViewportSize.x / m_ViewportSize.y;
+
+        m_ScenePath = path;
+        NV_LOG_INFO(std::format("Opened scene '{}': {} entities, {:.2f} ms (decode {:.2f} ms, insert {:.2f} ms).",
+            path.string(), m_LastSceneIOStats.m_Entities, m_LastSceneIOStats.m_TotalMs,
+            m_LastSceneIOStats.m_DecodeMs, m_LastSceneIOStats.m_InsertMs));
+        return true;
+    }
+
+    bool AppLayer::SaveScene(const std::filesystem::path& path) {
+        // The registry holds play state until Stop restores the snapshot taken at Play.
+        if (m_SceneState == SceneState::Play) {
+            NV_LOG_ERROR("Stop the game before saving the scene.");
+            return false;
+        }
+
+        auto world = m_Simulation.LockWorld();
+        if (!World::SaveScene(m_Scene.GetRegistry(), path, &m_LastSceneIOStats))
+            return false;
+
+        m_ScenePath = path;
+        NV_LOG_INFO(std::format("Saved scene '{}': {} entities, {} bytes, {:.2f} ms.",
+            path.string(), m_LastSceneIOStats.m_Entities, m_LastSceneIOStats.m_Bytes, m_LastSceneIOStats.m_TotalMs));
+        return true;
+    }
+
+    void AppLayer::ShowSceneFileDialog(SceneFileAction action) {
+        static const SDL_DialogFileFilter k_Filters[] = { { "Nova scene", "nova" } };
+
+        // May be called on another thread; the file is handled by the next OnUpdate.
+        auto onOpen = [](void* userdata, const char* const* files, int) {
+            if (files && files[0]) {
+                auto* app = static_cast<AppLayer*>(userdata);
+                std::lock_guard lock(app->m_SceneFileMutex);
+                app->m_PendingSceneFile.emplace(SceneFileAction::Open, files[0]);
+            }
+        };
+        auto onSave = [](void* userdata, const char* const* files, int) {
+            if (files && files[0]) {
+                auto* app = static_cast<AppLayer*>(userdata);
+                std::lock_guard lock(app->m_SceneFileMutex);
+                app->m_PendingSceneFile.emplace(SceneFileAction::Save, files[0]);
+            }
+        };
+
+        SDL_Window* window = Nova::Core::Application::Get().GetWindow().GetSDLWindow();
+        const std::string location = m_ScenePath.string();
+        if (action == SceneFileAction::Open)
+            SDL_ShowOpenFileDialog(onOpen, this, window, k_Filters, 1, location.c_str(), false);
+        else
+            SDL_ShowSaveFileDialog(onSave, this, window, k_Filters, 1, location.c_str());
+    }
+
+    void AppLayer::ProcessPendingSceneFile() {
+        std::optional<std::pair<SceneFileAction, std::filesystem::path>> pending;
+        {
+            std::lock_guard lock(m_SceneFileMutex);
+            pending.swap(m_PendingSceneFile);
+        }
+        if (!pending)
+            return;
+
+        auto& [action, path] = *pending;
+        if (action == SceneFileAction::Open) {
+            OpenScene(path);
+        }
+        else {
+            if (!path.has_extension())
+                path.replace_extension(".nova");
+            SaveScene(path);
+        }
+    }
+
     void AppLayer::OnImGuiRender() {
+        NV_PROFILE_SCOPE("AppLayer::OnImGuiRender");
+        if (!m_EditorUIEnabled)
+            return;
+
         UI::Panels::MainMenuBar::Render();
 
         ImGuiViewport* viewport = ImGui::GetMainViewport();
@@ -318,36 +1071,46 @@ namespace Nova::App {
 
         // Docked windows
         UI::Panels::ScenePanel::Render(m_Scene.GetName());
-        UI::Panels::HierarchyPanel::Render();
+        {
+            auto world = m_Simulation.LockWorld();
+            UI::Panels::HierarchyPanel::Render();
+        }
         UI::Panels::InspectorPanel::Render();
         UI::Panels::AssetBrowserPanel::Render();
+        UI::Panels::RenderStatsPanel::Render(m_RenderStats, m_InstancingBenchmark);
+
+        if (m_ProfilerVisible) {
+            bool open = true;
+            UI::Panels::ProfilerPanel::Render(&open);
+            if (!open)
+                SetProfilerVisible(false);
+        }
     }
 
-    bool AppLayer::OnMouseButtonPressed(MouseButtonPressedEvent& e) {
+    bool AppLayer::OnMouseButtonPressed(int button) {
 		// Only start orbit rotation when the mouse is inside the rendered viewport.
 		if (!m_ViewportHovered)
 			return false;
 
-		if (e.GetMouseButton() == 1) {
+		if (button == 1) {
+			// The cursor is tracked continuously: the drag rotates from where the button went down,
+			// even when the rest of the frame's motion is coalesced into one event.
 			m_Orbit.m_IsRotating = true;
-			m_Orbit.m_HasLastMousePos = false;
 			return true;
 		}
 		return false;
 	}
 
-	bool AppLayer::OnMouseButtonReleased(MouseButtonReleasedEvent& e) {
+	bool AppLayer::OnMouseButtonReleased(int button) {
 		// Always stop rotation, even if the mouse left the viewport while dragging.
-		if (e.GetMouseButton() == 1) {
+		if (button == 1) {
 			m_Orbit.m_IsRotating = false;
 			return true;
 		}
 		return false;
 	}
 
-	bool AppLayer::OnMouseMoved(MouseMovedEvent& e) {
-		const glm::vec2 mousePos{ e.GetX(), e.GetY() };
-
+	bool AppLayer::OnMouseMoved(const glm::vec2& mousePos) {
 		if (!m_Orbit.m_IsRotating) {
 			// Track position continuously so there is no jump when rotation starts.
 			m_Orbit.m_LastMousePos = mousePos;
@@ -368,29 +1131,32 @@ namespace Nova::App {
 		m_Orbit.m_Yaw   -= delta.x * m_Orbit.m_RotateSensitivity;
 		m_Orbit.m_Pitch += delta.y * m_Orbit.m_RotateSensitivity;
 
+		// Camera input is what the play-mode input latency is measured on.
+		m_Simulation.RecordInput();
 		UpdateCameraFromOrbit();
 		return true;
 	}
 
-	bool AppLayer::OnMouseScrolled(MouseScrolledEvent& e) {
+	bool AppLayer::OnMouseScrolled(float yOffset) {
 		// Only zoom when the mouse is inside the rendered viewport.
 		if (!m_ViewportHovered)
 			return false;
 
-		m_Orbit.m_Distance -= e.GetYOffset() * m_Orbit.m_ZoomSensitivity;
+		m_Orbit.m_Distance -= yOffset * m_Orbit.m_ZoomSensitivity;
+		m_Simulation.RecordInput();
 		UpdateCameraFromOrbit();
 		return true;
 	}
 
-	bool AppLayer::OnWindowResized(WindowResizeEvent& e) {
-		if (e.GetWidth() <= 0 || e.GetHeight() <= 0) return false;
-		m_Camera->m_AspectRatio = static_cast<float>(e.GetWidth()) / static_cast<float>(e.GetHeight());
+	bool AppLayer::OnWindowResized(const glm::vec2& size) {
+		if (size.x <= 0.0f || size.y <= 0.0f) return false;
+		m_Camera->m_AspectRatio = size.x / size.y;
 		return false;
 	}
 
-    bool AppLayer::OnImGuiPanelResize(ImGuiPanelResizeEvent& e) {
-		const float w = e.GetWidth();
-		const float h = e.GetHeight();
+    bool AppLayer::OnImGuiPanelResize(const glm::vec2& size) {
+		const float w = size.x;
+		const float h = size.y;
 		if (w <= 0.0f || h <= 0.0f) return false;
 
 		m_ViewportSize = { w, h };
@@ -399,7 +1165,6 @@ namespace Nova::App {
 			m_Camera->m_AspectRatio = w / h;
 
 		m_PendingViewportSize   = { w, h };
-		m_ViewportResizePending = true;
 		return false;
 	}
 
@@ -422,6 +1187,16 @@ namespace Nova::App {
 		m_Camera->m_Up = {0.0f, 1.0f, 0.0f};
 	}
 
+	void AppLayer::SetOrbitFromCamera() {
+		// Inverse of UpdateCameraFromOrbit.
+		const glm::vec3 offset = m_Camera->m_LookFrom - m_Camera->m_LookAt;
+		m_Orbit.m_Target = m_Camera->m_LookAt;
+		m_Orbit.m_Distance = std::max(0.2f, glm::length(offset));
+		m_Orbit.m_Yaw = std::atan2(offset.x, offset.z);
+		m_Orbit.m_Pitch = std::asin(std::clamp(offset.y / m_Orbit.m_Distance, -1.0f, 1.0f));
+		UpdateCameraFromOrbit();
+	}
+
 	void AppLayer::UpdateCameraAspectFromWindow() {
 		SDL_Window* window = Nova::Core::Application::Get().GetWindow().GetSDLWindow();
 		int w = 0, h = 0;
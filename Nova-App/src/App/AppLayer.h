@@ -1,7 +1,10 @@
 #ifndef APPLAYER_H
 #define APPLAYER_H
 
+#include <mutex>
 #include <memory>
+#include <optional>
+#include <filesystem>
 #include <entt/entt.hpp>
 #include <SDL3/SDL.h>
 
@@ -35,6 +38,41 @@
 #include "UI/Panels/AssetBrowserPanel.h"
 #include "UI/Panels/MainMenuBar.h"
 #include "UI/Panels/ScenePanel.h"
+#include "UI/Panels/RenderStatsPanel.h"
+#include "UI/Panels/ProfilerPanel.h"
+
+#include "Rendering/RenderStats.h"
+#include "Rendering/MaterialBlock.h"
+#include "Rendering/RenderQueue.h"
+#include "Rendering/MeshBounds.h"
+#include "Rendering/FrustumCulling.h"
+#include "Rendering/MeshLOD.h"
+#include "Rendering/RHICompat.h"
+#include "Rendering/DynamicResolution.h"
+#include "Rendering/ViewportTargetPool.h"
+#include "Rendering/FramePacing.h"
+#include "Rendering/GpuScene.h"
+#include "Rendering/GpuCulling.h"
+#include "Rendering/ShaderLibrary.h"
+#include "Rendering/PipelineCache.h"
+#include "Rendering/RenderGraph.h"
+
+#include "World/TransformCache.h"
+#include "World/HierarchyIndex.h"
+#include "World/NameComponent.h"
+#include "World/SceneSerializer.h"
+#include "World/SceneSnapshot.h"
+
+#include "Simulation/Simulation.h"
+
+#include "Input/EventQueue.h"
+
+#include "Jobs/JobSystem.h"
+#include "Streaming/AssetStreamer.h"
+#include "Profiling/Profiler.h"
+
+#include "Bench/InstancingBenchmark.h"
+#include "Bench/GpuDrivenBenchmark.h"
 
 using namespace Nova::Core;
 using namespace Nova::Core::Events;
@@ -56,6 +94,9 @@ namespace Nova::App {
         explicit AppLayer(): Layer("AppLayer") {}
         ~AppLayer() override;
 
+        // Frame pacing the layer starts with. Set before the layer is pushed, matching WindowDesc::m_VSync.
+        static void ConfigureFramePacing(const Rendering::FramePacingSettings& settings) { s_FramePacing = settings; }
+
         void OnAttach() override;
         void OnDetach() override;
         void OnUpdate(float dt) override;
@@ -77,32 +118,165 @@ namespace Nova::App {
         void SetSceneState(SceneState state) { m_SceneState = state; }
 
         Nova::Core::Renderer::RHI::IRenderer* GetRenderer() const { return m_Renderer.get(); }
+        Rendering::ShaderLibrary& GetShaderLibrary() { return m_ShaderLibrary; }
+
+        // ---- Startup ----
+        const Rendering::PipelineCacheStats& GetPipelineCacheStats() const { return m_PipelineCacheStats; }
+        double GetStartupMs() const    { return m_StartupMs; }
+        double GetFirstFrameMs() const { return m_FirstFrameMs; }
 
         // Called each frame by ScenePanel to indicate whether the mouse hovers the rendered viewport.
         void SetViewportHovered(bool hovered) { m_ViewportHovered = hovered; }
         bool IsViewportHovered() const        { return m_ViewportHovered; }
 
+        // Play captures the edit-mode scene; Stop puts it back.
         void RequestPlay();
         void RequestStop();
+        const World::SceneSnapshotStats& GetPlaySnapshotStats() const { return m_PlaySnapshot.GetStats(); }
+        Simulation::Simulation& GetSimulation() { return m_Simulation; }
 
         void RegisterEditorLayer(EditorLayer* layer) { m_EditorLayer = layer; }
         void RegisterGameLayer(GameLayer* layer) { m_GameLayer = layer; }
 
+        const Rendering::RenderStats& GetRenderStats() const { return m_RenderStats; }
+
+        // ---- Render graph ----
+        // Rebuilt every frame: layers add their passes between BeginRenderScene() and RenderScene(),
+        // which compiles and runs the graph.
+        Rendering::RenderGraph& GetRenderGraph()            { return m_RenderGraph; }
+        const Rendering::RenderGraphStats& GetRenderGraphStats() const { return m_RenderGraph.GetStats(); }
+        // The scene's color target, at the render size.
+        Rendering::RGTexture GetViewportColor() const       { return m_ViewportColor; }
+        Rendering::RGTexture GetViewportDepth() const       { return m_ViewportDepth; }
+
+        // ---- Instancing ----
+        bool IsInstancingSupported() const;
+        bool IsInstancingEnabled() const         { return m_InstancingEnabled; }
+        void SetInstancingEnabled(bool enabled)  { m_InstancingEnabled = enabled; }
+
+        // ---- Bindless ----
+        // Materials and world transforms live in storage buffers indexed by draw id; a draw binds no state.
+        bool IsBindlessSupported() const;
+        bool IsBindlessEnabled() const         { return m_BindlessEnabled; }
+        void SetBindlessEnabled(bool enabled)  { m_BindlessEnabled = enabled; }
+        const Rendering::GpuSceneStats& GetGpuSceneStats() const { return m_GpuScene.GetStats(); }
+
+        // ---- GPU-driven culling ----
+        // Opaque objects are culled, LOD-selected and compacted into indirect draws by a compute pass,
+        // one indirect-count draw per mesh; transparent ones keep the CPU path. Draws bindless.
+        bool IsGpuDrivenSupported() const;
+        bool IsGpuDrivenEnabled() const         { return m_GpuDrivenEnabled; }
+        void SetGpuDrivenEnabled(bool enabled)  { m_GpuDrivenEnabled = enabled; }
+        // Against the previous frame's depth pyramid, in GPU-driven mode.
+        bool IsOcclusionCullingSupported() const;
+        bool IsOcclusionCullingEnabled() const        { return m_OcclusionCullingEnabled; }
+        void SetOcclusionCullingEnabled(bool enabled) { m_OcclusionCullingEnabled = enabled; }
+        const Rendering::GpuCullingStats& GetGpuCullingStats() const { return m_GpuCulling.GetStats(); }
+
+        // ---- Culling ----
+        bool IsFrustumCullingEnabled() const        { return m_FrustumCullingEnabled; }
+        void SetFrustumCullingEnabled(bool enabled) { m_FrustumCullingEnabled = enabled; }
+
+        // ---- LOD ----
+        bool IsMeshLODEnabled() const        { return m_MeshLODEnabled; }
+        void SetMeshLODEnabled(bool enabled) { m_MeshLODEnabled = enabled; }
+        Rendering::MeshLODSelector& GetLODSelector() { return m_LODSelector; }
+
+        // ---- Dynamic resolution ----
+        Rendering::DynamicResolution& GetDynamicResolution()             { return m_DynamicResolution; }
+        const Rendering::DynamicResolution& GetDynamicResolution() const { return m_DynamicResolution; }
+        // Size the scene is rendered at this frame (the viewport's own size unless scaled).
+        glm::uvec2 GetRenderSize() const { return m_RenderSize; }
+        // Sharpened upscale through the renderer's hook. Without it the scaled viewport texture is
+        // stretched by ImGui with plain bilinear sampling, and the sharpness setting has no effect.
+        bool IsViewportUpscaleSupported() const;
+
+        // ---- Viewport targets ----
+        // Part of GetViewportTextureID() holding the image: a pooled target is larger than the panel.
+        glm::vec2 GetViewportUV() const { return m_ViewportUV; }
+        const Rendering::ViewportTargetPool& GetViewportTargets() const { return m_ViewportTargets; }
+
+        // ---- Input ----
+        // Events are buffered and handled once per frame, at the start of OnUpdate(). Other threads
+        // may push into the queue directly.
+        Input::EventQueue& GetEventQueue()             { return m_EventQueue; }
+        const Input::EventQueue& GetEventQueue() const { return m_EventQueue; }
+
+        // ---- Presentation ----
+        // Present mode and frames in flight apply at the start of the next frame.
+        Rendering::FramePacer& GetFramePacer()             { return m_FramePacer; }
+        const Rendering::FramePacer& GetFramePacer() const { return m_FramePacer; }
+
+        // ---- Headless runs ----
+        // Without the editor UI only the scene is rendered (the ImGui frame itself still runs).
+        bool IsEditorUIEnabled() const        { return m_EditorUIEnabled; }
+        void SetEditorUIEnabled(bool enabled) { m_EditorUIEnabled = enabled; }
+
+        // Orbits the camera around `target` at `distance`, pushing the far plane out to keep it in view.
+        void FocusCamera(const glm::vec3& target, float distance);
+
+        // ---- Profiler ----
+        // Zones are only recorded while the panel is open.
+        bool IsProfilerVisible() const { return m_ProfilerVisible; }
+        void SetProfilerVisible(bool visible);
+
+        void StartInstancingBenchmark(uint32_t cubeCount);
+        const Bench::InstancingBenchmark& GetInstancingBenchmark() const { return m_InstancingBenchmark; }
+        void StartGpuDrivenBenchmark(uint32_t objectCount);
+        const Bench::GpuDrivenBenchmark& GetGpuDrivenBenchmark() const { return m_GpuDrivenBenchmark; }
+
+        // ---- Scene files ----
+        // Open replaces the current scene and Save writes the registry; both are refused while playing.
+        bool OpenScene(const std::filesystem::path& path);
+        bool SaveScene(const std::filesystem::path& path);
+        const std::filesystem::path& GetScenePath() const { return m_ScenePath; }
+        const World::SceneIOStats& GetLastSceneIOStats() const { return m_LastSceneIOStats; }
+
+        // Native file dialog; the chosen file is opened or saved at the start of the next update.
+        enum class SceneFileAction { Open, Save };
+        void ShowSceneFileDialog(SceneFileAction action);
+
+        // ---- Hierarchy ----
+        World::HierarchyIndex& GetHierarchyIndex() { return m_HierarchyIndex; }
+        entt::entity GetSelectedEntity() const        { return m_SelectedEntity; }
+        void SetSelectedEntity(entt::entity entity)   { m_SelectedEntity = entity; }
+
         const Nova::Core::Scene::Scene& GetScene() const { return m_Scene; }
         Nova::Core::Scene::Scene& GetScene() { return m_Scene; }
     
     private:
+        // Camera the frame is rendered with: the interpolated snapshot camera when decoupled.
+        const Camera& GetRenderCamera() const { return m_RenderCamera ? *m_RenderCamera : *m_Camera; }
+        void GatherFromRegistry();
+        void GatherFromSnapshots(const Simulation::RenderFrame& frame);
+        void SelectLODs(const Camera& camera);
+        void GatherGpuObjects(const Camera& camera);
+        void ExecuteRenderGraph();
+        // True when the scene renders below the viewport's size into the renderer's internal target.
+        bool IsViewportUpscaled() const;
+        // Picks (or resizes) the viewport texture for `size`.
+        void UpdateViewportTarget(const glm::uvec2& size);
+
+        // Creates the editor camera entity around m_Camera (created when null) and makes it the main camera.
+        void CreateEditorCamera();
+        void ProcessPendingSceneFile();
+
         // ---- Orbit camera helpers ----
+		void SetOrbitFromCamera();
 		void UpdateCameraFromOrbit();
 		void UpdateCameraAspectFromWindow();
 
-        // ---- Mouse event handlers ----
-        bool OnMouseButtonPressed(MouseButtonPressedEvent& e);
-		bool OnMouseButtonReleased(MouseButtonReleasedEvent& e);
-		bool OnMouseMoved(MouseMovedEvent& e);
-		bool OnMouseScrolled(MouseScrolledEvent& e);
-		bool OnWindowResized(WindowResizeEvent& e);
-		bool OnImGuiPanelResize(ImGuiPanelResizeEvent& e);
+        // ---- Input event handlers ----
+        // Called with the frame's coalesced events (see Input::EventQueue).
+        void DispatchInputEvents();
+        // Low-latency mode, after the frame fence wait: the orbit follows the current cursor.
+        void SampleLatestInput();
+        bool OnMouseButtonPressed(int button);
+		bool OnMouseButtonReleased(int button);
+		bool OnMouseMoved(const glm::vec2& mousePos);
+		bool OnMouseScrolled(float yOffset);
+		bool OnWindowResized(const glm::vec2& size);
+		bool OnImGuiPanelResize(const glm::vec2& size);
 
     private: 
         std::unique_ptr<Nova::Core::Renderer::RHI::IRenderer> m_Renderer;
@@ -113,6 +287,82 @@ namespace Nova::App {
         float m_ElapsedTime{0.0f};
 		uint32_t m_FrameIndex{0};
 
+        // ---- Per-frame render state ----
+        World::TransformCache     m_TransformCache;
+        Rendering::MaterialBlockTracker m_MaterialBlocks;
+        World::HierarchyIndex     m_HierarchyIndex;
+        Rendering::RenderStats    m_RenderStats;
+        Rendering::MaterialBinder m_MaterialBinder;
+        Rendering::RenderQueue    m_RenderQueue;
+        Rendering::ShaderLibrary  m_ShaderLibrary;
+        Rendering::RenderGraph    m_RenderGraph;
+        Rendering::RGTexture      m_ViewportColor;
+        Rendering::RGTexture      m_ViewportDepth;
+        Rendering::RGTexture      m_ViewportOutput;   // what ImGui samples: m_ViewportColor unless upscaled
+
+        Rendering::DynamicResolution m_DynamicResolution;
+        glm::uvec2 m_RenderSize{ 0, 0 };
+
+        Rendering::ViewportTargetPool m_ViewportTargets;
+        glm::uvec2 m_TargetSize{ 0, 0 };    // of the viewport texture's image
+        glm::vec2  m_ViewportUV{ 1.0f, 1.0f };
+
+        Rendering::PipelineCacheStats m_PipelineCacheStats;
+        double   m_StartupMs{ 0.0 };
+        double   m_FirstFrameMs{ 0.0 };
+        uint64_t m_PresentedFrames{ 0 };
+        static constexpr uint64_t k_PipelineCacheSaveFrame = 120;
+
+        struct DrawCandidate {
+            entt::entity m_Entity{ entt::null };
+            Rendering::GPUMeshRef m_Mesh{};
+            uint32_t m_IndexCount{ 0 };
+            const Rendering::MaterialBlockComponent* m_Material{ nullptr };
+            glm::mat4 m_Transform{ 1.0f };
+        };
+        std::vector<DrawCandidate>  m_DrawCandidates;   // indexed like m_WorldBounds
+        Rendering::MeshBoundsCache  m_MeshBounds;
+        Rendering::WorldBoundsArray m_WorldBounds;
+        std::vector<uint32_t>       m_VisibleIndices;
+        Rendering::MeshLODSelector  m_LODSelector;
+        Rendering::GpuScene         m_GpuScene;
+        Rendering::GpuCulling       m_GpuCulling;
+        glm::mat4                   m_DepthPyramidViewProj{ 1.0f };
+        bool m_DepthPyramidValid{ false };   // built by the last frame
+        bool m_FrustumCullingEnabled{ true };
+        bool m_MeshLODEnabled{ true };
+        bool m_InstancingEnabled{ true };
+        bool m_BindlessEnabled{ true };
+        bool m_GpuDrivenEnabled{ false };
+        bool m_OcclusionCullingEnabled{ true };
+        bool m_ProfilerVisible{ false };
+        bool m_EditorUIEnabled{ true };
+
+        Bench::InstancingBenchmark m_InstancingBenchmark;
+        Bench::GpuDrivenBenchmark  m_GpuDrivenBenchmark;
+
+        Input::EventQueue m_EventQueue;
+
+        static inline Rendering::FramePacingSettings s_FramePacing{};
+        Rendering::FramePacer m_FramePacer;
+        std::chrono::steady_clock::time_point m_InputSampleTime{};   // of the last DispatchInputEvents()
+
+        entt::entity m_SelectedEntity{ entt::null };
+
+        // ---- Scene files ----
+        std::filesystem::path m_ScenePath{ "Assets/Scenes/Untitled.nova" };
+        World::SceneIOStats   m_LastSceneIOStats;
+        std::mutex m_SceneFileMutex;   // dialog callbacks may run on another thread
+        std::optional<std::pair<SceneFileAction, std::filesystem::path>> m_PendingSceneFile;
+
+        // ---- Play ----
+        World::SceneSnapshot   m_PlaySnapshot;
+        Simulation::Simulation m_Simulation;
+        std::optional<Simulation::RenderFrame> m_RenderFrame;   // decoupled: snapshots drawn this frame
+        std::optional<Camera> m_RenderCamera;                   // decoupled: interpolated snapshot camera
+
+        static constexpr uint32_t k_MainThreadJobBudget = 64;
+
         // ---- Camera ----
         std::shared_ptr<Camera> m_Camera;
 
@@ -136,7 +386,6 @@ namespace Nova::App {
 
         glm::vec2 m_ViewportSize{ 0.0f, 0.0f };
         glm::vec2 m_PendingViewportSize{ 0.0f, 0.0f };
-        bool      m_ViewportResizePending{ false };
         bool      m_ViewportHovered{ false };
 
         EditorLayer* m_EditorLayer{ nullptr };
@@ -0,0 +1,161 @@
+#include "App/CoreHooks.h"
+
+#include <format>
+#include <string>
+#include <utility>
+#include <iterator>
+
+#include "Core/Log.h"
+#include "Asset/Assets/MeshAsset.h"
+#include "Renderer/RHI/RHI_Renderer.h"
+#include "Renderer/RHI/RHI_ShaderCompiler.h"
+
+#include "Profiling/Profiler.h"
+#include "Rendering/RHICompat.h"
+#include "Rendering/GpuScene.h"
+#include "Rendering/GpuCulling.h"
+#include "Rendering/FramePacing.h"
+#include "Rendering/ShaderCache.h"
+#include "Rendering/ShaderLibrary.h"
+#include "Rendering/PipelineCache.h"
+#include "Rendering/ViewportTargetPool.h"
+#include "Streaming/AssetStreamer.h"
+
+namespace Nova::App {
+
+    namespace {
+
+        using Renderer = Nova::Core::Renderer::RHI::IRenderer;
+        using DrawCommand = Nova::Core::Renderer::RHI::RHI_DrawIndexedCommand;
+        using ShaderCompiler = Nova::Core::Renderer::RHI::RHI_ShaderCompiler;
+        using ShaderCompileInput = Nova::Core::Renderer::RHI::RHI_ShaderCompileInput;
+        using MeshAsset = Nova::Core::Asset::Assets::MeshAsset;
+
+        constexpr CoreHook k_Hooks[] = {
+            { "InstancedDrawSupport", "Rendering/RHICompat.h", "one draw per entity",
+                Rendering::InstancedDrawSupport<Renderer, DrawCommand> },
+            { "ViewportUpscaleSupport", "Rendering/RHICompat.h", "render scale has no effect",
+                Rendering::ViewportUpscaleSupport<Renderer> },
+            { "ViewportBarrierSupport", "Rendering/RHICompat.h", "the renderer transitions the viewport targets itself",
+                Rendering::ViewportBarrierSupport<Renderer> },
+            { "ViewportTargetPoolSupport", "Rendering/ViewportTargetPool.h", "one viewport target, resized once the size settles",
+                Rendering::ViewportTargetPoolSupport<Renderer> },
+            { "BindlessDrawSupport", "Rendering/GpuScene.h", "per-draw material uniforms",
+                Rendering::BindlessDrawSupport<Renderer, DrawCommand> },
+            { "GpuCullingSupport", "Rendering/GpuCulling.h", "CPU culling and submission",
+                Rendering::GpuCullingSupport<Renderer, DrawCommand> },
+            { "DepthPyramidSupport", "Rendering/GpuCulling.h", "no occlusion culling",
+                Rendering::DepthPyramidSupport<Renderer> },
+            { "GpuTimestampSupport", "Profiling/Profiler.h", "no GPU zones, dynamic resolution follows CPU frame time",
+                Profiling::GpuTimestampSupport<Renderer> },
+            { "PipelineCacheSupport", "Rendering/PipelineCache.h", "pipelines are not cached across runs",
+                Rendering::PipelineCacheSupport<Renderer> },
+            { "ShaderBinaryCompileSupport", "Rendering/ShaderLibrary.h", "the renderer compiles shaders from source",
+                Rendering::ShaderBinaryCompileSupport<ShaderCompiler, ShaderCompileInput> },
+            { "FullscreenShaderFromBinarySupport", "Rendering/ShaderLibrary.h", "the renderer compiles shaders from source",
+                Rendering::FullscreenShaderFromBinarySupport<Renderer> },
+            { "FullscreenPipelinePrewarmSupport", "Rendering/ShaderLibrary.h", "pipelines are built on first use",
+                Rendering::FullscreenPipelinePrewarmSupport<Renderer> },
+            { "ShaderCompilerVersionSupport", "Rendering/ShaderCache.h", "cache keys use NOVA_APP_SHADER_COMPILER_VERSION",
+                Rendering::ShaderCompilerVersionSupport<ShaderCompiler> },
+            { "PresentModeSupport", "Rendering/FramePacing.h", "the renderer's own present mode",
+                Rendering::PresentModeSupport<Renderer> },
+            { "FramesInFlightSupport", "Rendering/FramePacing.h", "the renderer's own frames in flight",
+                Rendering::FramesInFlightSupport<Renderer> },
+            { "StagedAssetLoad", "Streaming/AssetStreamer.h", "uncooked meshes load on the main thread",
+                Streaming::StagedAssetLoad<MeshAsset> },
+            { "CookedMeshUpload", "Streaming/AssetStreamer.h", "cooked .nvmesh files are not used",
+                Streaming::CookedMeshUpload<MeshAsset> },
+            { "CookableMesh", "Streaming/AssetStreamer.h", "meshes are not cooked",
+                Streaming::CookableMesh<MeshAsset> },
+        };
+
+    } // namespace
+
+    // Opt-in: a hook whose signature drifted fails the build instead of silently falling back.
+    // NV_REQUIRE_HOOK_<name> comes from the NOVA_APP_REQUIRE_CORE_HOOKS list (CMakeLists.txt).
+#define NV_REQUIRE_CORE_HOOK(name, ...) \
+    static_assert(__VA_ARGS__, "Nova-Core does not match " #name " (required by NOVA_APP_REQUIRE_CORE_HOOKS)")
+
+#if NV_REQUIRE_HOOK_ALL || NV_REQUIRE_HOOK_InstancedDrawSupport
+    NV_REQUIRE_CORE_HOOK(InstancedDrawSupport, Rendering::InstancedDrawSupport<Renderer, DrawCommand>);
+#endif
+#if NV_REQUIRE_HOOK_ALL || NV_REQUIRE_HOOK_ViewportUpscaleSupport
+    NV_REQUIRE_CORE_HOOK(ViewportUpscaleSupport, Rendering::ViewportUpscaleSupport<Renderer>);
+#endif
+#if NV_REQUIRE_HOOK_ALL || NV_REQUIRE_HOOK_ViewportBarrierSupport
+    NV_REQUIRE_CORE_HOOK(ViewportBarrierSupport, Rendering::ViewportBarrierSupport<Renderer>);
+#endif
+#if NV_REQUIRE_HOOK_ALL || NV_REQUIRE_HOOK_ViewportTargetPoolSupport
+    NV_REQUIRE_CORE_HOOK(ViewportTargetPoolSupport, Rendering::ViewportTargetPoolSupport<Renderer>);
+#endif
+#if NV_REQUIRE_GPU_DRIVEN || NV_REQUIRE_HOOK_ALL || NV_REQUIRE_HOOK_BindlessDrawSupport
+    NV_REQUIRE_CORE_HOOK(BindlessDrawSupport, Rendering::BindlessDrawSupport<Renderer, DrawCommand>);
+#endif
+#if NV_REQUIRE_GPU_DRIVEN || NV_REQUIRE_HOOK_ALL || NV_REQUIRE_HOOK_GpuCullingSupport
+    NV_REQUIRE_CORE_HOOK(GpuCullingSupport, Rendering::GpuCullingSupport<Renderer, DrawCommand>);
+#endif
+#if NV_REQUIRE_HOOK_ALL || NV_REQUIRE_HOOK_DepthPyramidSupport
+    NV_REQUIRE_CORE_HOOK(DepthPyramidSupport, Rendering::DepthPyramidSupport<Renderer>);
+#endif
+#if NV_REQUIRE_HOOK_ALL || NV_REQUIRE_HOOK_GpuTimestampSupport
+    NV_REQUIRE_CORE_HOOK(GpuTimestampSupport, Profiling::GpuTimestampSupport<Renderer>);
+#endif
+#if NV_REQUIRE_HOOK_ALL || NV_REQUIRE_HOOK_PipelineCacheSupport
+    NV_REQUIRE_CORE_HOOK(PipelineCacheSupport, Rendering::PipelineCacheSupport<Renderer>);
+#endif
+#if NV_REQUIRE_HOOK_ALL || NV_REQUIRE_HOOK_ShaderBinaryCompileSupport
+    NV_REQUIRE_CORE_HOOK(ShaderBinaryCompileSupport, Rendering::ShaderBinaryCompileSupport<ShaderCompiler, ShaderCompileInput>);
+#endif
+#if NV_REQUIRE_HOOK_ALL || NV_REQUIRE_HOOK_FullscreenShaderFromBinarySupport
+    NV_REQUIRE_CORE_HOOK(FullscreenShaderFromBinarySupport, Rendering::FullscreenShaderFromBinarySupport<Renderer>);
+#endif
+#if NV_REQUIRE_HOOK_ALL || NV_REQUIRE_HOOK_FullscreenPipelinePrewarmSupport
+    NV_REQUIRE_CORE_HOOK(FullscreenPipelinePrewarmSupport, Rendering::FullscreenPipelinePrewarmSupport<Renderer>);
+#endif
+#if NV_REQUIRE_HOOK_ALL || NV_REQUIRE_HOOK_ShaderCompilerVersionSupport
+    NV_REQUIRE_CORE_HOOK(ShaderCompilerVersionSupport, Rendering::ShaderCompilerVersionSupport<ShaderCompiler>);
+#endif
+#if NV_REQUIRE_HOOK_ALL || NV_REQUIRE_HOOK_PresentModeSupport
+    NV_REQUIRE_CORE_HOOK(PresentModeSupport, Rendering::PresentModeSupport<Renderer>);
+#endif
+#if NV_REQUIRE_HOOK_ALL || NV_REQUIRE_HOOK_FramesInFlightSupport
+    NV_REQUIRE_CORE_HOOK(FramesInFlightSupport, Rendering::FramesInFlightSupport<Renderer>);
+#endif
+#if NV_REQUIRE_HOOK_ALL || NV_REQUIRE_HOOK_StagedAssetLoad
+    NV_REQUIRE_CORE_HOOK(StagedAssetLoad, Streaming::StagedAssetLoad<MeshAsset>);
+#endif
+#if NV_REQUIRE_HOOK_ALL || NV_REQUIRE_HOOK_CookedMeshUpload
+    NV_REQUIRE_CORE_HOOK(CookedMeshUpload, Streaming::CookedMeshUpload<MeshAsset>);
+#endif
+#if NV_REQUIRE_HOOK_ALL || NV_REQUIRE_HOOK_CookableMesh
+    NV_REQUIRE_CORE_HOOK(CookableMesh, Streaming::CookableMesh<MeshAsset>);
+#endif
+
+#undef NV_REQUIRE_CORE_HOOK
+
+    std::span<const CoreHook> GetCoreHooks() {
+        return k_Hooks;
+    }
+
+    void ReportMissingCoreHooks() {
+        static bool s_Reported = false;
+        if (std::exchange(s_Reported, true))
+            return;
+
+        std::string missing;
+        size_t count = 0;
+        for (const CoreHook& hook : k_Hooks) {
+            if (hook.m_Present)
+                continue;
+            missing += std::format("{}{} ({}: {})", count == 0 ? "" : "; ", hook.m_Name, hook.m_Header, hook.m_Fallback);
+            ++count;
+        }
+        if (count == 0)
+            return;
+
+        NV_LOG_ERROR(std::format("{} of {} optional Nova-Core hooks are missing, using fallbacks: {}",
+            count, std::size(k_Hooks), missing).c_str());
+    }
+
+} // namespace Nova::App
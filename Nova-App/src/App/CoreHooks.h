@@ -0,0 +1,27 @@
+#ifndef COREHOOKS_H
+#define COREHOOKS_H
+
+#include <span>
+
+namespace Nova::App {
+
+    // Optional Nova-Core entry points the app detects at compile time: the *Support concepts next to
+    // each feature and the mesh asset concepts of Streaming/AssetStreamer.h. A missing one selects a
+    // fallback path. The hooks named in the NOVA_APP_REQUIRE_CORE_HOOKS CMake list (ALL for every
+    // one) fail the build instead; NOVA_APP_REQUIRE_GPU_DRIVEN requires the bindless and GPU
+    // culling ones.
+    struct CoreHook {
+        const char* m_Name;
+        const char* m_Header;     // where the expected signatures are documented
+        const char* m_Fallback;   // what runs without the hook
+        bool        m_Present;
+    };
+
+    std::span<const CoreHook> GetCoreHooks();
+
+    // Logs one message naming every missing hook and its fallback. Only the first call logs.
+    void ReportMissingCoreHooks();
+
+} // namespace Nova::App
+
+#endif // COREHOOKS_H
@@ -7,11 +7,15 @@
 
 #include "Renderer/RHI/RHI_ShaderCompiler.h"
 
+#include "Rendering/ShaderCache.h"
+#include "Rendering/ShaderLibrary.h"
+
+#include <format>
 #include <filesystem>
 
 namespace Nova::App {
 
-    void EditorLayer::CompileGridShaders() {
+    Rendering::ShaderLibrary::FullscreenShaderDesc EditorLayer::GetGridShaderDesc() {
         namespace fs = std::filesystem;
         using namespace Nova::Core::Renderer::RHI;
 
@@ -19,27 +23,43 @@ namespace Nova::App {
         fs::path editorShaders  = cwd / "Nova-App" / "Resources" / "Editor" / "Shaders";
         fs::path engineShaders  = cwd / "Nova-Core" / "Resources" / "Engine" / "Shaders";
 
-        RHI_ShaderCompileInput vertIn{};
+        Rendering::ShaderLibrary::FullscreenShaderDesc desc{};
+
+        RHI_ShaderCompileInput& vertIn = desc.m_Vertex;
         vertIn.m_File         = editorShaders / "Grid.vert.slang";
         vertIn.m_Stage        = RHI_ShaderStage::Vertex;
         vertIn.m_IncludeDirs.push_back(engineShaders);
 
-        RHI_ShaderCompileInput fragIn{};
+        RHI_ShaderCompileInput& fragIn = desc.m_Fragment;
         fragIn.m_File         = editorShaders / "Grid.frag.slang";
         fragIn.m_Stage        = RHI_ShaderStage::Fragment;
         fragIn.m_IncludeDirs.push_back(engineShaders);
 
+        return desc;
+    }
+
+    void EditorLayer::CompileGridShaders() {
+        const auto desc = GetGridShaderDesc();
+
         auto* renderer = g_AppLayer ? g_AppLayer->GetRenderer() : nullptr;
         if (!renderer) {
             NV_LOG_ERROR("EditorLayer: renderer not available for grid shader creation");
             return;
         }
 
-        m_GridShader = renderer->CreateFullscreenShader(vertIn, fragIn);
+        // Shared through the library: a layer recreated on Play -> Stop gets the same shader back.
+        m_GridShader = g_AppLayer->GetShaderLibrary().AcquireFullscreen(*renderer, desc.m_Vertex, desc.m_Fragment);
         if (m_GridShader)
             NV_LOG_INFO("Editor grid shader ready.");
         else
             NV_LOG_ERROR("Editor grid shader creation failed.");
+
+        const auto stats = Rendering::ShaderCache::Get().GetStats();
+        if (!Rendering::ShaderLibrary::IsBinaryCacheSupported())
+            NV_LOG_INFO(std::format("Shader cache: unavailable, {} shaders compiled from source in {:.1f} ms", stats.m_Uncached, stats.m_UncachedMs));
+        else
+            NV_LOG_INFO(std::format("Shader cache: {} memory hits, {} disk hits, {} misses, {:.1f} ms compiling, {:.1f} ms saved",
+                stats.m_MemoryHits, stats.m_DiskHits, stats.m_Misses, stats.m_CompileMs, stats.m_SavedMs));
     }
 
     void EditorLayer::OnAttach() {
@@ -50,8 +70,8 @@ namespace Nova::App {
     }
 
     void EditorLayer::OnDetach() {
-        if (m_GridShader && g_AppLayer && g_AppLayer->GetRenderer()) {
-            g_AppLayer->GetRenderer()->DestroyFullscreenShader(m_GridShader);
+        if (m_GridShader && g_AppLayer) {
+            g_AppLayer->GetShaderLibrary().Release(m_GridShader);
             m_GridShader = nullptr;
         }
 
@@ -66,8 +86,18 @@ namespace Nova::App {
     void EditorLayer::OnRender() {
         if (!g_AppLayer) return;
 
-        if (m_GridShader && g_AppLayer->GetRenderer())
-            g_AppLayer->GetRenderer()->DrawFullscreen(m_GridShader);
+        // Drawn under the scene into the viewport color; runs when RenderScene() executes the graph.
+        if (m_GridShader && g_AppLayer->GetRenderer()) {
+            g_AppLayer->GetRenderGraph().AddPass("Grid",
+                [](Rendering::RenderGraph::PassBuilder& builder) {
+                    builder.Write(g_AppLayer->GetViewportColor(), Rendering::RGState::ColorAttachment);
+                },
+                [this] {
+                    NV_PROFILE_SCOPE("Grid");
+                    NV_PROFILE_GPU_SCOPE(g_AppLayer->GetRenderer(), "Grid");
+                    g_AppLayer->GetRenderer()->DrawFullscreen(m_GridShader);
+                });
+        }
 
         g_AppLayer->RenderScene();
     }
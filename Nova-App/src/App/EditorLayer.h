@@ -5,6 +5,8 @@
 #include "Events/Event.h"
 #include "Renderer/RHI/RHI_Shaders.h"
 
+#include "Rendering/ShaderLibrary.h"
+
 namespace Nova::App {
 
     class AppLayer;
@@ -23,6 +25,9 @@ namespace Nova::App {
         void OnImGuiRender() override;
         void OnEvent(Nova::Core::Events::Event& e) override;
 
+        // Compile inputs of the editor grid, also prewarmed by AppLayer at startup.
+        static Rendering::ShaderLibrary::FullscreenShaderDesc GetGridShaderDesc();
+
     private:
         void CompileGridShaders();
 
@@ -15,7 +15,11 @@ namespace Nova::App {
             g_AppLayer->RegisterGameLayer(nullptr);
     }
 
-    void GameLayer::OnUpdate(float) {}
+    // Coupled mode only; decoupled ticks run on the simulation thread.
+    void GameLayer::OnUpdate(float dt) {
+        if (g_AppLayer)
+            g_AppLayer->GetSimulation().Advance(dt);
+    }
 
     void GameLayer::OnBegin() {}
 
@@ -0,0 +1,206 @@
+#include "App/HeadlessBenchmarkLayer.h"
+
+#include <map>
+#include <cmath>
+#include <format>
+#include <random>
+#include <string>
+
+#include <SDL3/SDL.h>
+
+#include "App/AppLayer.h"
+#include "Core/Application.h"
+#include "Core/Log.h"
+#include "Events/ApplicationEvents.h"
+
+namespace Nova::App {
+
+    void HeadlessBenchmarkLayer::OnAttach() {
+        s_ExitCode = 1;
+        if (!g_AppLayer) {
+            NV_LOG_ERROR("HeadlessBenchmark: AppLayer is not attached.");
+            return;
+        }
+
+        AppLayer& app = *g_AppLayer;
+        app.SetEditorUIEnabled(false);
+
+        m_Result = {};
+        m_Result.m_Desc = s_Desc;
+        m_Result.m_JobThreads = Jobs::JobSystem::Get().GetThreadCount();
+        m_Result.m_StartupMs = app.GetStartupMs();
+        m_Result.m_ResidentStartBytes = Bench::GetCurrentResidentBytes();
+
+        // Nothing sizes the viewport without the Scene panel: render at the window size.
+        using namespace Nova::Core::Events;
+        ImGuiPanelResizeEvent resize("Viewport", static_cast<float>(s_Desc.m_Width), static_cast<float>(s_Desc.m_Height));
+        Nova::Core::Application::Get().OnEvent(resize);
+
+        const auto start = std::chrono::steady_clock::now();
+        BuildScene(app);
+        m_Result.m_SceneBuildMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+        // Zones feed the CPU/GPU breakdown; the panel stays closed.
+        Profiling::Profiler::Get().SetEnabled(true);
+
+        NV_LOG_INFO(std::format("HeadlessBenchmark: {} entities, {} materials, {}x{} {}, {} + {} frames.",
+            s_Desc.m_EntityCount, s_Desc.m_MaterialCount, s_Desc.m_Width, s_Desc.m_Height, s_Desc.m_GraphicsAPI,
+            s_Desc.m_WarmupFrames, s_Desc.m_Frames));
+        m_StartTime = std::chrono::steady_clock::now();
+    }
+
+    void HeadlessBenchmarkLayer::OnDetach() {
+        if (g_AppLayer && !m_Entities.empty())
+            g_AppLayer->GetScene().GetRegistry().destroy(m_Entities.begin(), m_Entities.end());
+        m_Entities.clear();
+        Profiling::Profiler::Get().SetEnabled(false);
+    }
+
+    void HeadlessBenchmarkLayer::BuildScene(AppLayer& app) {
+        using namespace Nova::Core::Asset;
+        using namespace Nova::Core::Asset::Assets;
+        using namespace Nova::Core::Scene::ECS::Components;
+
+        // One blocking load per primitive in the mix; the benchmark measures rendering, not streaming.
+        std::vector<Streaming::AssetRef<MeshAsset>> meshes;
+        std::vector<uint32_t> weights;
+        for (const auto& [name, weight] : s_Desc.m_MeshMix) {
+            auto mesh = Streaming::AssetStreamer::Get().AcquireBlocking<MeshAsset>("Engine://Primitives/" + name);
+            if (!mesh || !mesh->IsLoaded()) {
+                NV_LOG_ERROR(std::format("HeadlessBenchmark: unknown primitive '{}', skipped.", name));
+                continue;
+            }
+            meshes.push_back(mesh);
+            weights.push_back(weight);
+        }
+        if (meshes.empty())
+            return;
+
+        // Evenly spread hues, one material per variant.
+        std::vector<Nova::Core::Renderer::RHI::Material> materials(s_Desc.m_MaterialCount);
+        for (uint32_t i = 0; i < s_Desc.m_MaterialCount; ++i) {
+            const float hue = static_cast<float>(i) / static_cast<float>(s_Desc.m_MaterialCount);
+            float r = 0.0f, g = 0.0f, b = 0.0f;
+            ImGui::ColorConvertHSVtoRGB(hue, 0.65f, 0.9f, r, g, b);
+            materials[i].baseColor = glm::vec3(r, g, b);
+        }
+
+        std::mt19937 random(s_Desc.m_Seed);
+        std::discrete_distribution<uint32_t> pickMesh(weights.begin(), weights.end());
+        std::uniform_int_distribution<uint32_t> pickMaterial(0, s_Desc.m_MaterialCount - 1);
+
+        auto& scene = app.GetScene();
+        auto& registry = scene.GetRegistry();
+
+        // Same cubic lattice as the instancing benchmark, centred on the origin.
+        const uint32_t count = s_Desc.m_EntityCount;
+        const uint32_t side = std::max(1u, static_cast<uint32_t>(std::ceil(std::cbrt(static_cast<double>(count)))));
+        const float spacing = 1.5f;
+        const float half = 0.5f * spacing * static_cast<float>(side - 1);
+
+        m_Entities.reserve(count);
+        for (uint32_t i = 0; i < count; ++i) {
+            const uint32_t x = i % side;
+            const uint32_t y = (i / side) % side;
+            const uint32_t z = i / (side * side);
+
+            entt::entity entity = World::CreateNamedEntity(scene, "BenchEntity");
+            registry.emplace<TransformComponent>(entity,
+                glm::vec3(x * spacing - half, 0.5f + y * spacing, z * spacing - half),
+                glm::vec3(0.0f, 0.0f, 0.0f),
+                glm::vec3(0.5f, 0.5f, 0.5f)
+            );
+            registry.emplace<MeshRendererComponent>(entity, meshes[pickMesh(random)], materials[pickMaterial(random)]);
+
+            m_Entities.push_back(entity);
+        }
+
+        // Frame the whole lattice.
+        const float extent = spacing * static_cast<float>(side);
+        app.FocusCamera(glm::vec3(0.0f, half, 0.0f), std::max(10.0f, extent * 2.5f));
+    }
+
+    void HeadlessBenchmarkLayer::OnUpdate(float dt) {
+        if (m_Done || !g_AppLayer)
+            return;
+
+        // OnUpdate runs before the frame is rendered: dt, render stats and the last profiler
+        // capture describe the previous frame.
+        ++m_Frame;
+        if (m_Frame > s_Desc.m_WarmupFrames + 1)
+            RecordFrame(*g_AppLayer, dt);
+
+        if (m_Result.m_FrameMs.size() >= s_Desc.m_Frames)
+            Finish();
+    }
+
+    void HeadlessBenchmarkLayer::RecordFrame(AppLayer& app, float dt) {
+        const auto& stats = app.GetRenderStats();
+        m_Result.m_FrameMs.push_back(dt * 1000.0);
+        m_Result.m_SceneCpuMs.push_back(stats.m_SceneCpuTimeMs);
+        m_Result.m_DrawCalls = stats.m_DrawCalls;
+        m_Result.m_Instances = stats.m_Instances;
+        m_Result.m_Visible = stats.m_Visible;
+        m_Result.m_Culled = stats.m_Culled;
+
+        const auto& streaming = Streaming::AssetStreamer::Get().GetStats();
+        m_Result.m_StagingPeakBytes = std::max<uint64_t>(m_Result.m_StagingPeakBytes, streaming.m_StagingUsed);
+
+        const auto& history = Profiling::Profiler::Get().GetHistory();
+        if (history.empty() || history.back().m_Frame == m_LastProfiledFrame)
+            return;
+
+        const Profiling::FrameCapture& frame = history.back();
+        m_LastProfiledFrame = frame.m_Frame;
+
+        // Summed per name across threads: "Job" is the total time spent in jobs that frame.
+        std::map<std::string, double> cpu;
+        for (const auto& track : frame.m_Threads)
+            for (const auto& event : track.m_Events)
+                cpu[event.m_Name] += (event.m_EndNs - event.m_StartNs) * 1e-6;
+        for (const auto& [name, ms] : cpu)
+            m_Result.m_CpuZonesMs[name].push_back(ms);
+
+        std::map<std::string, double> gpu;
+        for (const auto& event : frame.m_Gpu)
+            gpu[event.m_Name] += (event.m_EndNs - event.m_StartNs) * 1e-6;
+        for (const auto& [name, ms] : gpu)
+            m_Result.m_GpuZonesMs[name].push_back(ms);
+    }
+
+    void HeadlessBenchmarkLayer::Finish() {
+        m_Done = true;
+
+        m_Result.m_ResidentEndBytes = Bench::GetCurrentResidentBytes();
+        m_Result.m_ResidentPeakBytes = Bench::GetPeakResidentBytes();
+        m_Result.m_TotalSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - m_StartTime).count();
+
+        const auto frame = Bench::Summarize(m_Result.m_FrameMs);
+        NV_LOG_INFO(std::format("HeadlessBenchmark: frame p50 {:.3f} ms, p95 {:.3f} ms, p99 {:.3f} ms, peak RSS {:.1f} MB",
+            frame.m_P50, frame.m_P95, frame.m_P99, m_Result.m_ResidentPeakBytes / (1024.0 * 1024.0)));
+
+        if (Bench::WriteHeadlessBenchmarkJson(m_Result, s_Desc.m_OutputPath)) {
+            NV_LOG_INFO(std::format("HeadlessBenchmark: results written to '{}'", s_Desc.m_OutputPath.string()));
+            s_ExitCode = 0;
+        }
+
+        // Leaves Application::Run through the same path as closing the window.
+        SDL_Event quit{};
+        quit.type = SDL_EVENT_QUIT;
+        SDL_PushEvent(&quit);
+    }
+
+    void HeadlessBenchmarkLayer::OnBegin() {}
+
+    void HeadlessBenchmarkLayer::OnRender() {
+        if (g_AppLayer)
+            g_AppLayer->RenderScene();
+    }
+
+    void HeadlessBenchmarkLayer::OnEnd() {}
+
+    void HeadlessBenchmarkLayer::OnImGuiRender() {}
+
+    void HeadlessBenchmarkLayer::OnEvent(Nova::Core::Events::Event&) {}
+
+} // namespace Nova::App
@@ -0,0 +1,59 @@
+#ifndef HEADLESSBENCHMARKLAYER_H
+#define HEADLESSBENCHMARKLAYER_H
+
+#include <vector>
+#include <chrono>
+#include <cstdint>
+
+#include <entt/entt.hpp>
+
+#include "Core/Layer.h"
+#include "Events/Event.h"
+
+#include "Bench/HeadlessBenchmark.h"
+
+namespace Nova::App {
+
+    class AppLayer;
+
+    // Replaces EditorLayer in --benchmark runs: builds the synthetic scene, renders it for the
+    // configured number of frames, writes the JSON report and quits the application.
+    class HeadlessBenchmarkLayer : public Nova::Core::Layer {
+    public:
+        explicit HeadlessBenchmarkLayer(): Layer("HeadlessBenchmarkLayer") {}
+        ~HeadlessBenchmarkLayer() override = default;
+
+        // Set before the layer is pushed.
+        static void Configure(const Bench::HeadlessBenchmarkDesc& desc) { s_Desc = desc; }
+        // Non-zero when the run did not complete or the report could not be written.
+        static int GetExitCode() { return s_ExitCode; }
+
+        void OnAttach() override;
+        void OnDetach() override;
+        void OnUpdate(float dt) override;
+        void OnBegin() override;
+        void OnRender() override;
+        void OnEnd() override;
+        void OnImGuiRender() override;
+        void OnEvent(Nova::Core::Events::Event& e) override;
+
+    private:
+        void BuildScene(AppLayer& app);
+        void RecordFrame(AppLayer& app, float dt);
+        void Finish();
+
+        static inline Bench::HeadlessBenchmarkDesc s_Desc{};
+        static inline int s_ExitCode{ 1 };
+
+        uint32_t m_Frame{ 0 };
+        uint64_t m_LastProfiledFrame{ UINT64_MAX };
+        bool     m_Done{ false };
+        std::chrono::steady_clock::time_point m_StartTime;
+
+        std::vector<entt::entity> m_Entities;
+        Bench::HeadlessBenchmarkResult m_Result;
+    };
+
+} // namespace Nova::App
+
+#endif // HEADLESSBENCHMARKLAYER_H
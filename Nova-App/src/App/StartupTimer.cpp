@@ -0,0 +1,17 @@
+#include "App/StartupTimer.h"
+
+#include <chrono>
+
+namespace Nova::App {
+
+    namespace {
+
+        const auto s_ProcessStart = std::chrono::steady_clock::now();
+
+    } // namespace
+
+    double GetMillisecondsSinceStartup() {
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - s_ProcessStart).count();
+    }
+
+} // namespace Nova::App
@@ -0,0 +1,11 @@
+#ifndef STARTUPTIMER_H
+#define STARTUPTIMER_H
+
+namespace Nova::App {
+
+    // Milliseconds since the process started (static initialization of the executable).
+    double GetMillisecondsSinceStartup();
+
+} // namespace Nova::App
+
+#endif // STARTUPTIMER_H
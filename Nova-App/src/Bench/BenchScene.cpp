@@ -0,0 +1,61 @@
+#include "Bench/BenchScene.h"
+
+#include <cmath>
+#include <iterator>
+
+#include "App/AppLayer.h"
+
+namespace Nova::App::Bench {
+
+    std::vector<entt::entity> SpawnCubeLattice(AppLayer& app, uint32_t count) {
+        using namespace Nova::Core::Asset;
+        using namespace Nova::Core::Asset::Assets;
+        using namespace Nova::Core::Scene::ECS::Components;
+
+        auto cubeAsset = Streaming::AssetStreamer::Get().AcquireBlocking<MeshAsset>("Engine://Primitives/Cube");
+
+        // A few material variants so the benchmarks exercise more than a single group.
+        const glm::vec3 colors[] = {
+            { 0.90f, 0.30f, 0.25f },
+            { 0.25f, 0.80f, 0.35f },
+            { 0.25f, 0.45f, 0.90f },
+            { 0.90f, 0.80f, 0.25f },
+        };
+
+        auto& scene = app.GetScene();
+        auto& registry = scene.GetRegistry();
+
+        const uint32_t side = static_cast<uint32_t>(std::ceil(std::cbrt(static_cast<double>(count))));
+        const float spacing = 1.5f;
+        const float half = 0.5f * spacing * static_cast<float>(side - 1);
+
+        std::vector<entt::entity> entities;
+        entities.reserve(count);
+        for (uint32_t i = 0; i < count; ++i) {
+            const uint32_t x = i % side;
+            const uint32_t y = (i / side) % side;
+            const uint32_t z = i / (side * side);
+
+            entt::entity entity = World::CreateNamedEntity(scene, "BenchCube");
+            registry.emplace<TransformComponent>(entity,
+                glm::vec3(x * spacing - half, 0.5f + y * spacing, z * spacing - half),
+                glm::vec3(0.0f, 0.0f, 0.0f),
+                glm::vec3(0.5f, 0.5f, 0.5f)
+            );
+
+            Nova::Core::Renderer::RHI::Material mat{};
+            mat.baseColor = colors[i % std::size(colors)];
+            registry.emplace<MeshRendererComponent>(entity, cubeAsset, mat);
+
+            entities.push_back(entity);
+        }
+        return entities;
+    }
+
+    void DespawnEntities(AppLayer& app, std::vector<entt::entity>& entities) {
+        auto& registry = app.GetScene().GetRegistry();
+        registry.destroy(entities.begin(), entities.end());
+        entities.clear();
+    }
+
+} // namespace Nova::App::Bench
@@ -0,0 +1,22 @@
+#ifndef BENCHSCENE_H
+#define BENCHSCENE_H
+
+#include <vector>
+#include <cstdint>
+
+#include <entt/entt.hpp>
+
+namespace Nova::App {
+    class AppLayer;
+}
+
+namespace Nova::App::Bench {
+
+    // Fills the scene with a cubic lattice of `count` unit cubes centred on the origin, resting on
+    // the grid, in a few material variants. Returns the created entities.
+    std::vector<entt::entity> SpawnCubeLattice(AppLayer& app, uint32_t count);
+    void DespawnEntities(AppLayer& app, std::vector<entt::entity>& entities);
+
+} // namespace Nova::App::Bench
+
+#endif // BENCHSCENE_H
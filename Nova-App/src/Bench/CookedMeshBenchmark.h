@@ -0,0 +1,12 @@
+#ifndef COOKEDMESHBENCHMARK_H
+#define COOKEDMESHBENCHMARK_H
+
+namespace Nova::App::Bench {
+
+    // Cold and warm load of a 1M-vertex cooked mesh: mapped .nvmesh versus reading the same
+    // blobs into memory with stream I/O.
+    void RunCookedMeshBenchmark();
+
+} // namespace Nova::App::Bench
+
+#endif // COOKEDMESHBENCHMARK_H
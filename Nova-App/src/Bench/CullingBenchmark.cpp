@@ -0,0 +1,63 @@
+#include "Bench/CullingBenchmark.h"
+
+#include <random>
+#include <format>
+
+#include <glm/gtc/matrix_transform.hpp>
+
+#include "Bench/MicroBenchmark.h"
+#include "Rendering/FrustumCulling.h"
+
+namespace Nova::App::Bench {
+
+    using namespace Nova::App::Rendering;
+
+    void RunCullingBenchmark() {
+        constexpr uint32_t k_Repetitions = 10;
+        const uint32_t counts[] = { 100'000, 1'000'000 };
+
+        // Camera in the middle of the cloud: roughly a quarter of the bounds end up visible.
+        const glm::mat4 view = glm::lookAt(glm::vec3(0.0f, 0.0f, 0.0f), glm::vec3(0.0f, 0.0f, -1.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+        const glm::mat4 proj = glm::perspective(glm::radians(60.0f), 16.0f / 9.0f, 0.1f, 500.0f);
+        const Frustum frustum = Frustum::FromViewProjection(proj * view);
+
+        MeshBounds unitCube{};
+        unitCube.m_Extents = glm::vec3(0.5f);
+        unitCube.m_Radius = glm::length(unitCube.m_Extents);
+
+        std::vector<CullingKernel> kernels = { CullingKernel::Scalar };
+        if (GetBestCullingKernel() != CullingKernel::Scalar)
+            kernels.push_back(CullingKernel::SSE);
+        if (GetBestCullingKernel() == CullingKernel::AVX)
+            kernels.push_back(CullingKernel::AVX);
+
+        for (uint32_t count : counts) {
+            std::mt19937 rng(1234);
+            std::uniform_real_distribution<float> position(-250.0f, 250.0f);
+            std::uniform_real_distribution<float> scale(0.5f, 4.0f);
+
+            WorldBoundsArray bounds;
+            bounds.Reserve(count);
+            for (uint32_t i = 0; i < count; ++i) {
+                glm::mat4 transform = glm::translate(glm::mat4(1.0f), glm::vec3(position(rng), position(rng), position(rng)));
+                transform = glm::scale(transform, glm::vec3(scale(rng)));
+                bounds.Add(static_cast<entt::entity>(i), transform, unitCube);
+            }
+
+            std::vector<uint32_t> visible;
+            visible.reserve(count);
+
+            for (CullingKernel kernel : kernels) {
+                MicroBenchmarkResult result;
+                result.m_Items = count;
+                result.m_Milliseconds = MeasureBestMs(k_Repetitions, [&]() {
+                    visible.clear();
+                    CullAABBs(frustum, bounds, visible, kernel);
+                });
+                result.m_Name = std::format("Frustum culling {} ({} bounds, {} visible)", GetCullingKernelName(kernel), count, visible.size());
+                Report(result);
+            }
+        }
+    }
+
+} // namespace Nova::App::Bench
@@ -0,0 +1,11 @@
+#ifndef CULLINGBENCHMARK_H
+#define CULLINGBENCHMARK_H
+
+namespace Nova::App::Bench {
+
+    // Culling throughput of every compiled kernel over 100k and 1M random world bounds.
+    void RunCullingBenchmark();
+
+} // namespace Nova::App::Bench
+
+#endif // CULLINGBENCHMARK_H
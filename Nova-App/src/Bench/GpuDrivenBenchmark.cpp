@@ -0,0 +1,97 @@
+#include "Bench/GpuDrivenBenchmark.h"
+
+#include <format>
+
+#include "App/AppLayer.h"
+#include "Bench/BenchScene.h"
+#include "Core/Log.h"
+
+namespace Nova::App::Bench {
+
+    void GpuDrivenBenchmark::Start(AppLayer& app, uint32_t objectCount) {
+        if (IsRunning() || objectCount == 0)
+            return;
+
+        m_Result = Result{};
+        m_Result.m_ObjectCount = objectCount;
+        m_Result.m_GpuSupported = app.IsGpuDrivenSupported();
+        m_PreviousGpuDriven = app.IsGpuDrivenEnabled();
+
+        if (!m_Result.m_GpuSupported)
+            NV_LOG_INFO("GpuDrivenBenchmark: renderer has no indirect-count path, both runs will use CPU submission.");
+
+        m_Entities = SpawnCubeLattice(app, objectCount);
+
+        app.SetGpuDrivenEnabled(false);
+        m_Phase = Phase::WarmupCpu;
+        m_PhaseFrame = 0;
+
+        NV_LOG_INFO(std::format("GpuDrivenBenchmark: started with {} objects.", objectCount));
+    }
+
+    void GpuDrivenBenchmark::OnUpdate(AppLayer& app, float dt) {
+        // OnUpdate runs before the frame is rendered: dt and the render stats describe the previous frame.
+        const auto& stats = app.GetRenderStats();
+        ++m_PhaseFrame;
+
+        switch (m_Phase) {
+            case Phase::WarmupCpu:
+            case Phase::WarmupGpu:
+                if (m_PhaseFrame >= k_WarmupFrames) {
+                    m_Phase = (m_Phase == Phase::WarmupCpu) ? Phase::Cpu : Phase::Gpu;
+                    m_PhaseFrame = 0;
+                    m_FrameMsSum = 0.0;
+                    m_SceneCpuMsSum = 0.0;
+                    m_SubmitCpuMsSum = 0.0;
+                }
+                break;
+
+            case Phase::Cpu:
+            case Phase::Gpu: {
+                m_FrameMsSum += dt * 1000.0;
+                m_SceneCpuMsSum += stats.m_SceneCpuTimeMs;
+                m_SubmitCpuMsSum += stats.m_SubmitCpuTimeMs;
+                m_DrawCalls = stats.m_DrawCalls;
+
+                if (m_PhaseFrame < k_MeasureFrames)
+                    break;
+
+                Mode& mode = (m_Phase == Phase::Cpu) ? m_Result.m_Cpu : m_Result.m_Gpu;
+                mode.m_FrameMs = static_cast<float>(m_FrameMsSum / k_MeasureFrames);
+                mode.m_SceneCpuMs = static_cast<float>(m_SceneCpuMsSum / k_MeasureFrames);
+                mode.m_SubmitCpuMs = static_cast<float>(m_SubmitCpuMsSum / k_MeasureFrames);
+                mode.m_DrawCalls = m_DrawCalls;
+
+                if (m_Phase == Phase::Cpu) {
+                    app.SetGpuDrivenEnabled(true);
+                    m_Phase = Phase::WarmupGpu;
+                    m_PhaseFrame = 0;
+                }
+                else {
+                    Finish(app);
+                }
+                break;
+            }
+
+            case Phase::Idle:
+                break;
+        }
+    }
+
+    void GpuDrivenBenchmark::Finish(AppLayer& app) {
+        DespawnEntities(app, m_Entities);
+        app.SetGpuDrivenEnabled(m_PreviousGpuDriven);
+
+        m_Result.m_Valid = true;
+        m_Phase = Phase::Idle;
+
+        NV_LOG_INFO(std::format(
+            "GpuDrivenBenchmark ({} objects): CPU submission {:.3f} ms submit, {:.2f} ms scene CPU, {:.2f} ms/frame, {} draws | "
+            "GPU-driven {:.3f} ms submit, {:.2f} ms scene CPU, {:.2f} ms/frame, {} draws{}",
+            m_Result.m_ObjectCount,
+            m_Result.m_Cpu.m_SubmitCpuMs, m_Result.m_Cpu.m_SceneCpuMs, m_Result.m_Cpu.m_FrameMs, m_Result.m_Cpu.m_DrawCalls,
+            m_Result.m_Gpu.m_SubmitCpuMs, m_Result.m_Gpu.m_SceneCpuMs, m_Result.m_Gpu.m_FrameMs, m_Result.m_Gpu.m_DrawCalls,
+            m_Result.m_GpuSupported ? "" : " (unsupported, CPU path)"));
+    }
+
+} // namespace Nova::App::Bench
@@ -0,0 +1,65 @@
+#ifndef GPUDRIVENBENCHMARK_H
+#define GPUDRIVENBENCHMARK_H
+
+#include <vector>
+#include <cstdint>
+
+#include <entt/entt.hpp>
+
+namespace Nova::App {
+    class AppLayer;
+}
+
+namespace Nova::App::Bench {
+
+    // Frame benchmark: fills the scene with a lattice of cubes and renders it for a fixed number of
+    // frames with the CPU submission path (the current bindless/instancing settings), then with
+    // GPU-driven culling, and reports the CPU time spent recording draws next to the scene CPU and
+    // frame times. Driven from AppLayer::OnUpdate, like InstancingBenchmark.
+    class GpuDrivenBenchmark {
+    public:
+        struct Mode {
+            float    m_FrameMs{ 0.0f };
+            float    m_SceneCpuMs{ 0.0f };
+            float    m_SubmitCpuMs{ 0.0f };
+            uint32_t m_DrawCalls{ 0 };
+        };
+
+        struct Result {
+            uint32_t m_ObjectCount{ 0 };
+            Mode m_Cpu;
+            Mode m_Gpu;
+            bool m_GpuSupported{ false };
+            bool m_Valid{ false };
+        };
+
+        void Start(AppLayer& app, uint32_t objectCount);
+        void OnUpdate(AppLayer& app, float dt);
+
+        bool IsRunning() const { return m_Phase != Phase::Idle; }
+        const Result& GetResult() const { return m_Result; }
+
+    private:
+        enum class Phase { Idle, WarmupCpu, Cpu, WarmupGpu, Gpu };
+
+        void Finish(AppLayer& app);
+
+        static constexpr uint32_t k_WarmupFrames  = 30;
+        static constexpr uint32_t k_MeasureFrames = 240;
+
+        Phase    m_Phase{ Phase::Idle };
+        uint32_t m_PhaseFrame{ 0 };
+        bool     m_PreviousGpuDriven{ false };
+
+        double   m_FrameMsSum{ 0.0 };
+        double   m_SceneCpuMsSum{ 0.0 };
+        double   m_SubmitCpuMsSum{ 0.0 };
+        uint32_t m_DrawCalls{ 0 };
+
+        std::vector<entt::entity> m_Entities;
+        Result m_Result;
+    };
+
+} // namespace Nova::App::Bench
+
+#endif // GPUDRIVENBENCHMARK_H
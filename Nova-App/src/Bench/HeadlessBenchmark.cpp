@@ -0,0 +1,242 @@
+#include "Bench/HeadlessBenchmark.h"
+
+#include <cmath>
+#include <format>
+#include <fstream>
+#include <charconv>
+#include <iterator>
+#include <algorithm>
+#include <string_view>
+
+#include <SDL3/SDL.h>
+
+#include "Core/Log.h"
+
+#if defined(_WIN32)
+    #ifndef NOMINMAX
+        #define NOMINMAX
+    #endif
+    #include <windows.h>
+    #include <psapi.h>
+#else
+    #include <unistd.h>
+    #include <sys/resource.h>
+#endif
+
+namespace Nova::App::Bench {
+
+    namespace {
+
+        bool ParseUInt(std::string_view text, uint32_t& value) {
+            const auto [end, ec] = std::from_chars(text.data(), text.data() + text.size(), value);
+            return ec == std::errc() && end == text.data() + text.size();
+        }
+
+        // "Cube:3,Plane:1" or "Cube,Plane" (weight 1).
+        bool ParseMeshMix(std::string_view text, std::vector<std::pair<std::string, uint32_t>>& mix) {
+            mix.clear();
+            while (!text.empty()) {
+                const size_t comma = text.find(',');
+                std::string_view item = text.substr(0, comma);
+                text = comma == std::string_view::npos ? std::string_view{} : text.substr(comma + 1);
+
+                uint32_t weight = 1;
+                if (const size_t colon = item.find(':'); colon != std::string_view::npos) {
+                    if (!ParseUInt(item.substr(colon + 1), weight))
+                        return false;
+                    item = item.substr(0, colon);
+                }
+                if (item.empty())
+                    return false;
+                if (weight > 0)
+                    mix.emplace_back(std::string(item), weight);
+            }
+            return !mix.empty();
+        }
+
+        void WriteSummary(std::ofstream& out, const PercentileSummary& summary) {
+            out << std::format("{{\"mean\": {:.4f}, \"min\": {:.4f}, \"p50\": {:.4f}, \"p95\": {:.4f}, \"p99\": {:.4f}, \"max\": {:.4f}}}",
+                summary.m_Mean, summary.m_Min, summary.m_P50, summary.m_P95, summary.m_P99, summary.m_Max);
+        }
+
+        void WriteZones(std::ofstream& out, const std::map<std::string, std::vector<double>>& zones) {
+            out << "{";
+            bool first = true;
+            for (const auto& [name, samples] : zones) {
+                std::string escaped;
+                for (char c : name) {
+                    if (c == '"' || c == '\\')
+                        escaped += '\\';
+                    escaped += c;
+                }
+                out << (first ? "\n      \"" : ",\n      \"") << escaped << "\": ";
+                WriteSummary(out, Summarize(samples));
+                first = false;
+            }
+            out << (first ? "}" : "\n    }");
+        }
+
+    } // namespace
+
+    bool ParseHeadlessBenchmarkArgs(int argc, char** argv, HeadlessBenchmarkDesc& desc, std::string& error) {
+        bool enabled = false;
+
+        for (int i = 1; i < argc; ++i) {
+            const std::string_view arg = argv[i];
+            if (arg == "--benchmark") {
+                enabled = true;
+                continue;
+            }
+
+            if (!arg.starts_with("--"))
+                continue;
+
+            constexpr std::string_view k_Options[] = { "--frames", "--warmup", "--entities", "--materials", "--seed", "--mesh-mix", "--output", "--api", "--size" };
+            if (std::find(std::begin(k_Options), std::end(k_Options), arg) == std::end(k_Options)) {
+                error = std::format("Unknown option {}", arg);
+                continue;
+            }
+
+            if (i + 1 >= argc) {
+                error = std::format("Missing value for {}", arg);
+                return enabled;
+            }
+            const std::string_view value = argv[++i];
+
+            bool valid = true;
+            if (arg == "--frames")            valid = ParseUInt(value, desc.m_Frames) && desc.m_Frames > 0;
+            else if (arg == "--warmup")       valid = ParseUInt(value, desc.m_WarmupFrames);
+            else if (arg == "--entities")     valid = ParseUInt(value, desc.m_EntityCount);
+            else if (arg == "--materials")    valid = ParseUInt(value, desc.m_MaterialCount) && desc.m_MaterialCount > 0;
+            else if (arg == "--seed")         valid = ParseUInt(value, desc.m_Seed);
+            else if (arg == "--mesh-mix")     valid = ParseMeshMix(value, desc.m_MeshMix);
+            else if (arg == "--output")       desc.m_OutputPath = std::filesystem::path(value);
+            else if (arg == "--api") {
+                desc.m_GraphicsAPI = std::string(value);
+                valid = value == "vulkan" || value == "opengl";
+            }
+            else if (arg == "--size") {
+                const size_t x = value.find('x');
+                valid = x != std::string_view::npos && ParseUInt(value.substr(0, x), desc.m_Width) && ParseUInt(value.substr(x + 1), desc.m_Height)
+                    && desc.m_Width > 0 && desc.m_Height > 0;
+            }
+
+            if (!valid)
+                error = std::format("Invalid value '{}' for {}", value, arg);
+        }
+
+        return enabled;
+    }
+
+    void UseOffscreenVideoDriver() {
+        // Normal priority: an SDL_VIDEO_DRIVER environment variable still wins.
+        SDL_SetHint(SDL_HINT_VIDEO_DRIVER, "offscreen");
+    }
+
+    PercentileSummary Summarize(std::vector<double> samples) {
+        PercentileSummary summary;
+        if (samples.empty())
+            return summary;
+
+        std::sort(samples.begin(), samples.end());
+        auto rank = [&](double percentile) {
+            const size_t index = static_cast<size_t>(std::ceil(percentile / 100.0 * samples.size()));
+            return samples[std::clamp<size_t>(index, 1, samples.size()) - 1];
+        };
+
+        double sum = 0.0;
+        for (double sample : samples)
+            sum += sample;
+
+        summary.m_Mean = sum / samples.size();
+        summary.m_Min = samples.front();
+        summary.m_P50 = rank(50.0);
+        summary.m_P95 = rank(95.0);
+        summary.m_P99 = rank(99.0);
+        summary.m_Max = samples.back();
+        return summary;
+    }
+
+    uint64_t GetCurrentResidentBytes() {
+#if defined(_WIN32)
+        PROCESS_MEMORY_COUNTERS counters{};
+        if (K32GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+            return counters.WorkingSetSize;
+        return 0;
+#else
+        // Second field of statm: resident pages.
+        std::ifstream statm("/proc/self/statm");
+        uint64_t size = 0, resident = 0;
+        if (statm >> size >> resident)
+            return resident * static_cast<uint64_t>(sysconf(_SC_PAGESIZE));
+        return 0;
+#endif
+    }
+
+    uint64_t GetPeakResidentBytes() {
+#if defined(_WIN32)
+        PROCESS_MEMORY_COUNTERS counters{};
+        if (K32GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+            return counters.PeakWorkingSetSize;
+        return 0;
+#else
+        rusage usage{};
+        if (getrusage(RUSAGE_SELF, &usage) != 0)
+            return 0;
+    #if defined(__APPLE__)
+        return static_cast<uint64_t>(usage.ru_maxrss);          // bytes
+    #else
+        return static_cast<uint64_t>(usage.ru_maxrss) * 1024;   // kilobytes
+    #endif
+#endif
+    }
+
+    bool WriteHeadlessBenchmarkJson(const HeadlessBenchmarkResult& result, const std::filesystem::path& path) {
+        std::error_code error;
+        if (path.has_parent_path())
+            std::filesystem::create_directories(path.parent_path(), error);
+
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        if (!out) {
+            NV_LOG_ERROR(std::format("Failed to write benchmark results '{}'", path.string()));
+            return false;
+        }
+
+        const HeadlessBenchmarkDesc& desc = result.m_Desc;
+
+        out << "{\n  \"config\": {\n";
+        out << std::format("    \"frames\": {},\n    \"warmup_frames\": {},\n    \"entities\": {},\n    \"materials\": {},\n    \"seed\": {},\n",
+            desc.m_Frames, desc.m_WarmupFrames, desc.m_EntityCount, desc.m_MaterialCount, desc.m_Seed);
+        out << "    \"mesh_mix\": {";
+        for (size_t i = 0; i < desc.m_MeshMix.size(); ++i)
+            out << std::format("{}\"{}\": {}", i == 0 ? "" : ", ", desc.m_MeshMix[i].first, desc.m_MeshMix[i].second);
+        out << "},\n";
+        out << std::format("    \"width\": {},\n    \"height\": {},\n    \"api\": \"{}\",\n    \"job_threads\": {}\n  }},\n",
+            desc.m_Width, desc.m_Height, desc.m_GraphicsAPI, result.m_JobThreads);
+
+        out << "  \"frame_ms\": ";
+        WriteSummary(out, Summarize(result.m_FrameMs));
+        out << ",\n  \"cpu_ms\": {\n    \"render_scene\": ";
+        WriteSummary(out, Summarize(result.m_SceneCpuMs));
+        out << ",\n    \"zones\": ";
+        WriteZones(out, result.m_CpuZonesMs);
+        out << "\n  },\n  \"gpu_ms\": {\n";
+        out << std::format("    \"available\": {},\n    \"zones\": ", result.m_GpuZonesMs.empty() ? "false" : "true");
+        WriteZones(out, result.m_GpuZonesMs);
+        out << "\n  },\n";
+
+        out << std::format("  \"render\": {{\"draw_calls\": {}, \"instances\": {}, \"visible\": {}, \"culled\": {}}},\n",
+            result.m_DrawCalls, result.m_Instances, result.m_Visible, result.m_Culled);
+        out << std::format("  \"memory\": {{\"resident_start_bytes\": {}, \"resident_end_bytes\": {}, \"resident_peak_bytes\": {}, \"staging_peak_bytes\": {}}},\n",
+            result.m_ResidentStartBytes, result.m_ResidentEndBytes, result.m_ResidentPeakBytes, result.m_StagingPeakBytes);
+        out << std::format("  \"startup_ms\": {:.2f},\n  \"scene_build_ms\": {:.2f},\n  \"total_seconds\": {:.3f}\n}}\n",
+            result.m_StartupMs, result.m_SceneBuildMs, result.m_TotalSeconds);
+
+        if (!out) {
+            NV_LOG_ERROR(std::format("Failed to write benchmark results '{}'", path.string()));
+            return false;
+        }
+        return true;
+    }
+
+} // namespace Nova::App::Bench
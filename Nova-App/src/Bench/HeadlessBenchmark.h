@@ -0,0 +1,102 @@
+#ifndef HEADLESSBENCHMARK_H
+#define HEADLESSBENCHMARK_H
+
+#include <map>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <utility>
+#include <filesystem>
+
+namespace Nova::App::Bench {
+
+    // Command line of the headless benchmark mode:
+    //
+    //   Nova-App --benchmark [--frames N] [--warmup N] [--entities N] [--mesh-mix Cube:3,Plane:1]
+    //            [--materials N] [--size 1280x720] [--api vulkan|opengl] [--seed N] [--output file.json]
+    //
+    // The window is created on SDL's offscreen video driver (no display needed) with VSync off, so the
+    // run works on software implementations such as lavapipe / llvmpipe. SDL_VIDEO_DRIVER overrides it.
+    struct HeadlessBenchmarkDesc {
+        uint32_t m_Frames{ 600 };
+        uint32_t m_WarmupFrames{ 60 };
+
+        // Synthetic scene
+        uint32_t m_EntityCount{ 10'000 };
+        std::vector<std::pair<std::string, uint32_t>> m_MeshMix{ { "Cube", 1 } };   // primitive name, weight
+        uint32_t m_MaterialCount{ 8 };
+        uint32_t m_Seed{ 1 };
+
+        uint32_t m_Width{ 1280 };
+        uint32_t m_Height{ 720 };
+        std::string m_GraphicsAPI{ "vulkan" };
+
+        std::filesystem::path m_OutputPath{ "benchmark.json" };
+    };
+
+    // True when --benchmark is on the command line. Unknown or malformed options are reported in `error`.
+    bool ParseHeadlessBenchmarkArgs(int argc, char** argv, HeadlessBenchmarkDesc& desc, std::string& error);
+
+    // Window setup for the headless run: offscreen video driver, requested size, VSync off, hidden when
+    // the window description has a flag for it.
+    template <typename WindowDesc>
+    void ApplyHeadlessWindowDesc(const HeadlessBenchmarkDesc& desc, WindowDesc& windowDesc) {
+        windowDesc.m_Title = "Nova Benchmark";
+        windowDesc.m_Width = desc.m_Width;
+        windowDesc.m_Height = desc.m_Height;
+        windowDesc.m_Resizable = false;
+        windowDesc.m_VSync = false;
+
+        if constexpr (requires { windowDesc.m_Hidden = true; })
+            windowDesc.m_Hidden = true;
+        else if constexpr (requires { windowDesc.m_Visible = false; })
+            windowDesc.m_Visible = false;
+    }
+
+    // Selects SDL's offscreen video driver unless SDL_VIDEO_DRIVER is set. Call before the window exists.
+    void UseOffscreenVideoDriver();
+
+    struct PercentileSummary {
+        double m_Mean{ 0.0 };
+        double m_Min{ 0.0 };
+        double m_P50{ 0.0 };
+        double m_P95{ 0.0 };
+        double m_P99{ 0.0 };
+        double m_Max{ 0.0 };
+    };
+
+    // Nearest-rank percentiles.
+    PercentileSummary Summarize(std::vector<double> samples);
+
+    uint64_t GetCurrentResidentBytes();
+    uint64_t GetPeakResidentBytes();
+
+    struct HeadlessBenchmarkResult {
+        HeadlessBenchmarkDesc m_Desc;
+        uint32_t m_JobThreads{ 0 };
+
+        std::vector<double> m_FrameMs;                      // wall time per measured frame
+        std::vector<double> m_SceneCpuMs;                   // AppLayer::RenderScene
+        std::map<std::string, std::vector<double>> m_CpuZonesMs;   // profiler zones summed over threads, per frame
+        std::map<std::string, std::vector<double>> m_GpuZonesMs;   // empty without GPU timestamps
+
+        uint32_t m_DrawCalls{ 0 };
+        uint32_t m_Instances{ 0 };
+        uint32_t m_Visible{ 0 };
+        uint32_t m_Culled{ 0 };
+
+        uint64_t m_ResidentStartBytes{ 0 };
+        uint64_t m_ResidentEndBytes{ 0 };
+        uint64_t m_ResidentPeakBytes{ 0 };
+        uint64_t m_StagingPeakBytes{ 0 };
+
+        double m_StartupMs{ 0.0 };
+        double m_SceneBuildMs{ 0.0 };
+        double m_TotalSeconds{ 0.0 };
+    };
+
+    bool WriteHeadlessBenchmarkJson(const HeadlessBenchmarkResult& result, const std::filesystem::path& path);
+
+} // namespace Nova::App::Bench
+
+#endif // HEADLESSBENCHMARK_H
@@ -0,0 +1,87 @@
+#include "Bench/HierarchyIndexBenchmark.h"
+
+#include <random>
+#include <format>
+#include <string>
+#include <vector>
+#include <iterator>
+#include <algorithm>
+
+#include <entt/entt.hpp>
+
+#include "Bench/MicroBenchmark.h"
+#include "World/HierarchyIndex.h"
+#include "World/NameComponent.h"
+
+namespace Nova::App::Bench {
+
+    namespace {
+
+        constexpr uint32_t k_EntityCount = 1'000'000;
+        constexpr uint32_t k_Repetitions = 10;
+
+        constexpr const char* k_Prefixes[] = { "BenchCube", "PointLight", "Plane", "Camera", "SpawnPoint" };
+
+    } // namespace
+
+    void RunHierarchyIndexBenchmark() {
+        std::mt19937 rng(11);
+        std::uniform_int_distribution<uint32_t> pickPrefix(0, static_cast<uint32_t>(std::size(k_Prefixes)) - 1);
+        std::uniform_int_distribution<uint32_t> pickNumber(0, 99'999);
+
+        entt::registry registry;
+        std::vector<entt::entity> entities(k_EntityCount);
+        registry.create(entities.begin(), entities.end());
+        for (const entt::entity entity : entities)
+            registry.emplace<World::NameComponent>(entity, std::format("{} {}", k_Prefixes[pickPrefix(rng)], pickNumber(rng)));
+
+        World::HierarchyIndex index;
+
+        MicroBenchmarkResult build;
+        build.m_Items = k_EntityCount;
+        build.m_Milliseconds = MeasureBestMs(1, [&]() {
+            index.Connect(registry);
+            index.Update();
+        });
+        build.m_Name = "Hierarchy index 1M: build";
+        Report(build);
+
+        // Each burst is drained one budgeted Update() per frame; the result is the slowest frame.
+        std::uniform_int_distribution<uint32_t> pickEntity(0, k_EntityCount - 1);
+        uint32_t renamed = 0;
+        for (const uint32_t renames : { 1u, 100u, 10'000u }) {
+            for (uint32_t i = 0; i < renames; ++i) {
+                registry.patch<World::NameComponent>(entities[pickEntity(rng)], [&](World::NameComponent& name) {
+                    name.m_Name = std::format("Renamed {}", renamed++);
+                });
+            }
+
+            uint32_t frames = 0;
+            double worstMs = 0.0;
+            do {
+                index.Update();
+                worstMs = std::max(worstMs, index.GetLastUpdateMs());
+                ++frames;
+            } while (index.GetPendingCount() > 0);
+
+            MicroBenchmarkResult update;
+            update.m_Items = renames;
+            update.m_Milliseconds = worstMs;
+            update.m_Name = std::format("Hierarchy index 1M: {} rename(s), slowest of {} frame(s) ({:.1f} ms budget)",
+                renames, frames, World::HierarchyIndex::k_FrameBudgetMs);
+            Report(update);
+        }
+
+        std::vector<entt::entity> matches;
+        for (const char* query : { "p", "light", "cube 123", "renamed 1" }) {
+            MicroBenchmarkResult search;
+            search.m_Items = k_EntityCount;
+            search.m_Milliseconds = MeasureBestMs(k_Repetitions, [&]() { index.Search(query, matches); });
+            search.m_Name = std::format("Hierarchy index 1M: filter \"{}\" ({} matches)", query, matches.size());
+            Report(search);
+        }
+
+        index.Disconnect();
+    }
+
+} // namespace Nova::App::Bench
@@ -0,0 +1,12 @@
+#ifndef HIERARCHYINDEXBENCHMARK_H
+#define HIERARCHYINDEXBENCHMARK_H
+
+namespace Nova::App::Bench {
+
+    // Hierarchy index over 1M named entities: full build, per-frame cost of 1 and 100 renames, and
+    // filter queries of different selectivity.
+    void RunHierarchyIndexBenchmark();
+
+} // namespace Nova::App::Bench
+
+#endif // HIERARCHYINDEXBENCHMARK_H
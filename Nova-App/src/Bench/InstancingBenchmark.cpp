@@ -0,0 +1,112 @@
+#include "Bench/InstancingBenchmark.h"
+
+#include <format>
+
+#include "App/AppLayer.h"
+#include "Bench/BenchScene.h"
+#include "Core/Log.h"
+
+namespace Nova::App::Bench {
+
+    void InstancingBenchmark::Start(AppLayer& app, uint32_t cubeCount) {
+        if (IsRunning() || cubeCount == 0)
+            return;
+
+        m_Result = Result{};
+        m_Result.m_CubeCount = cubeCount;
+        m_PreviousInstancing = app.IsInstancingEnabled();
+        m_PreviousBindless = app.IsBindlessEnabled();
+        m_PreviousGpuDriven = app.IsGpuDrivenEnabled();
+
+        if (!app.IsInstancingSupported())
+            NV_LOG_INFO("InstancingBenchmark: renderer has no instanced draw path, both runs will use per-instance draws.");
+
+        SpawnCubes(app, cubeCount);
+
+        // Either would draw both phases through the same path.
+        app.SetBindlessEnabled(false);
+        app.SetGpuDrivenEnabled(false);
+        app.SetInstancingEnabled(true);
+        m_Phase = Phase::WarmupInstanced;
+        m_PhaseFrame = 0;
+
+        NV_LOG_INFO(std::format("InstancingBenchmark: started with {} cubes.", cubeCount));
+    }
+
+    void InstancingBenchmark::OnUpdate(AppLayer& app, float dt) {
+        // OnUpdate runs before the frame is rendered: dt and the render stats describe the previous frame.
+        const auto& stats = app.GetRenderStats();
+        ++m_PhaseFrame;
+
+        switch (m_Phase) {
+            case Phase::WarmupInstanced:
+            case Phase::WarmupBatched:
+                if (m_PhaseFrame >= k_WarmupFrames) {
+                    m_Phase = (m_Phase == Phase::WarmupInstanced) ? Phase::Instanced : Phase::Batched;
+                    m_PhaseFrame = 0;
+                    m_FrameMsSum = 0.0;
+                    m_SceneCpuMsSum = 0.0;
+                }
+                break;
+
+            case Phase::Instanced:
+            case Phase::Batched: {
+                m_FrameMsSum += dt * 1000.0;
+                m_SceneCpuMsSum += stats.m_SceneCpuTimeMs;
+                m_DrawCalls = stats.m_DrawCalls;
+
+                if (m_PhaseFrame < k_MeasureFrames)
+                    break;
+
+                const float frameMs = static_cast<float>(m_FrameMsSum / k_MeasureFrames);
+                const float sceneMs = static_cast<float>(m_SceneCpuMsSum / k_MeasureFrames);
+
+                if (m_Phase == Phase::Instanced) {
+                    m_Result.m_InstancedFrameMs = frameMs;
+                    m_Result.m_InstancedSceneCpuMs = sceneMs;
+                    m_Result.m_InstancedDrawCalls = m_DrawCalls;
+
+                    app.SetInstancingEnabled(false);
+                    m_Phase = Phase::WarmupBatched;
+                    m_PhaseFrame = 0;
+                }
+                else {
+                    m_Result.m_BatchedFrameMs = frameMs;
+                    m_Result.m_BatchedSceneCpuMs = sceneMs;
+                    m_Result.m_BatchedDrawCalls = m_DrawCalls;
+                    Finish(app);
+                }
+                break;
+            }
+
+            case Phase::Idle:
+                break;
+        }
+    }
+
+    void InstancingBenchmark::Finish(AppLayer& app) {
+        DespawnCubes(app);
+        app.SetInstancingEnabled(m_PreviousInstancing);
+        app.SetBindlessEnabled(m_PreviousBindless);
+        app.SetGpuDrivenEnabled(m_PreviousGpuDriven);
+
+        m_Result.m_Valid = true;
+        m_Phase = Phase::Idle;
+
+        NV_LOG_INFO(std::format(
+            "InstancingBenchmark ({} cubes): instanced {:.2f} ms/frame ({:.2f} ms scene CPU, {} draws) | "
+            "non-instanced {:.2f} ms/frame ({:.2f} ms scene CPU, {} draws)",
+            m_Result.m_CubeCount,
+            m_Result.m_InstancedFrameMs, m_Result.m_InstancedSceneCpuMs, m_Result.m_InstancedDrawCalls,
+            m_Result.m_BatchedFrameMs, m_Result.m_BatchedSceneCpuMs, m_Result.m_BatchedDrawCalls));
+    }
+
+    void InstancingBenchmark::SpawnCubes(AppLayer& app, uint32_t cubeCount) {
+        m_Entities = SpawnCubeLattice(app, cubeCount);
+    }
+
+    void InstancingBenchmark::DespawnCubes(AppLayer& app) {
+        DespawnEntities(app, m_Entities);
+    }
+
+} // namespace Nova::App::Bench
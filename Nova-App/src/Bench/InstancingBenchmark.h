@@ -0,0 +1,67 @@
+#ifndef INSTANCINGBENCHMARK_H
+#define INSTANCINGBENCHMARK_H
+
+#include <vector>
+#include <cstdint>
+
+#include <entt/entt.hpp>
+
+namespace Nova::App {
+    class AppLayer;
+}
+
+namespace Nova::App::Bench {
+
+    // Frame benchmark: fills the scene with a lattice of cubes, renders it for a fixed number of
+    // frames with instancing on, then off, and reports the average frame and RenderScene CPU times.
+    // Bindless and GPU-driven submission take precedence over instancing, so both are off for the
+    // run. Driven from AppLayer::OnUpdate, so it measures the real editor frame.
+    class InstancingBenchmark {
+    public:
+        struct Result {
+            uint32_t m_CubeCount{ 0 };
+
+            float    m_InstancedFrameMs{ 0.0f };
+            float    m_InstancedSceneCpuMs{ 0.0f };
+            uint32_t m_InstancedDrawCalls{ 0 };
+
+            float    m_BatchedFrameMs{ 0.0f };
+            float    m_BatchedSceneCpuMs{ 0.0f };
+            uint32_t m_BatchedDrawCalls{ 0 };
+
+            bool m_Valid{ false };
+        };
+
+        void Start(AppLayer& app, uint32_t cubeCount);
+        void OnUpdate(AppLayer& app, float dt);
+
+        bool IsRunning() const { return m_Phase != Phase::Idle; }
+        const Result& GetResult() const { return m_Result; }
+
+    private:
+        enum class Phase { Idle, WarmupInstanced, Instanced, WarmupBatched, Batched };
+
+        void SpawnCubes(AppLayer& app, uint32_t cubeCount);
+        void DespawnCubes(AppLayer& app);
+        void Finish(AppLayer& app);
+
+        static constexpr uint32_t k_WarmupFrames  = 30;
+        static constexpr uint32_t k_MeasureFrames = 240;
+
+        Phase    m_Phase{ Phase::Idle };
+        uint32_t m_PhaseFrame{ 0 };
+        bool     m_PreviousInstancing{ true };
+        bool     m_PreviousBindless{ true };
+        bool     m_PreviousGpuDriven{ false };
+
+        double   m_FrameMsSum{ 0.0 };
+        double   m_SceneCpuMsSum{ 0.0 };
+        uint32_t m_DrawCalls{ 0 };
+
+        std::vector<entt::entity> m_Entities;
+        Result m_Result;
+    };
+
+} // namespace Nova::App::Bench
+
+#endif // INSTANCINGBENCHMARK_H
@@ -0,0 +1,101 @@
+#include "Bench/JobSystemBenchmark.h"
+
+#include <random>
+#include <format>
+#include <thread>
+
+#include <glm/gtc/matrix_transform.hpp>
+
+#include "Bench/MicroBenchmark.h"
+#include "Jobs/JobSystem.h"
+#include "Rendering/FrustumCulling.h"
+#include "World/TransformMath.h"
+
+namespace Nova::App::Bench {
+
+    using namespace Nova::App::Rendering;
+    using namespace Nova::App::World;
+
+    namespace {
+
+        std::vector<uint32_t> GetThreadCounts() {
+            const uint32_t hardware = std::max(1u, std::thread::hardware_concurrency());
+
+            std::vector<uint32_t> counts;
+            for (uint32_t threads = 1; threads < hardware; threads *= 2)
+                counts.push_back(threads);
+            counts.push_back(hardware);
+            return counts;
+        }
+
+    } // namespace
+
+    void RunJobSystemBenchmark() {
+        constexpr uint32_t k_Count = 1'000'000;
+        constexpr uint32_t k_Repetitions = 10;
+        constexpr uint32_t k_ComposeGrain = 8 * 1024;
+
+        std::mt19937 rng(1234);
+        std::uniform_real_distribution<float> position(-250.0f, 250.0f);
+        std::uniform_real_distribution<float> angle(-3.14f, 3.14f);
+        std::uniform_real_distribution<float> scale(0.5f, 4.0f);
+
+        const glm::mat4 view = glm::lookAt(glm::vec3(0.0f, 0.0f, 0.0f), glm::vec3(0.0f, 0.0f, -1.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+        const glm::mat4 proj = glm::perspective(glm::radians(60.0f), 16.0f / 9.0f, 0.1f, 500.0f);
+        const Frustum frustum = Frustum::FromViewProjection(proj * view);
+
+        MeshBounds unitCube{};
+        unitCube.m_Extents = glm::vec3(0.5f);
+        unitCube.m_Radius = glm::length(unitCube.m_Extents);
+
+        std::vector<TRS> trs(k_Count);
+        WorldBoundsArray bounds;
+        bounds.Reserve(k_Count);
+        for (uint32_t i = 0; i < k_Count; ++i) {
+            trs[i] = { glm::vec3(position(rng), position(rng), position(rng)), glm::vec3(angle(rng), angle(rng), angle(rng)), glm::vec3(scale(rng)) };
+            bounds.Add(static_cast<entt::entity>(i), ComposeTRS(trs[i]), unitCube);
+        }
+
+        std::vector<uint32_t> slots(k_Count);
+        for (uint32_t i = 0; i < k_Count; ++i)
+            slots[i] = i;
+
+        std::vector<glm::mat4> local(k_Count);
+        std::vector<uint32_t> visible;
+        visible.reserve(k_Count);
+
+        double cullBaseline = 0.0;
+        double composeBaseline = 0.0;
+
+        for (uint32_t threads : GetThreadCounts()) {
+            Jobs::JobSystem jobs;
+            jobs.Init({ threads });
+
+            MicroBenchmarkResult cull;
+            cull.m_Items = k_Count;
+            cull.m_Milliseconds = MeasureBestMs(k_Repetitions, [&]() {
+                visible.clear();
+                CullAABBsParallel(frustum, bounds, visible, jobs);
+            });
+            if (threads == 1)
+                cullBaseline = cull.m_Milliseconds;
+            cull.m_Name = std::format("Jobs: parallel culling, {} thread(s) ({:.2f}x)", threads, cullBaseline / cull.m_Milliseconds);
+            Report(cull);
+
+            MicroBenchmarkResult compose;
+            compose.m_Items = k_Count;
+            compose.m_Milliseconds = MeasureBestMs(k_Repetitions, [&]() {
+                jobs.ParallelFor(k_Count, k_ComposeGrain, [&](uint32_t begin, uint32_t end) {
+                    ComposeTRS(std::span<const TRS>(trs.data() + begin, end - begin), local.data(), slots.data() + begin);
+                });
+            });
+            if (threads == 1)
+                composeBaseline = compose.m_Milliseconds;
+            compose.m_Name = std::format("Jobs: compose transforms, {} thread(s) ({:.2f}x)", threads, composeBaseline / compose.m_Milliseconds);
+            Report(compose);
+
+            jobs.Shutdown();
+        }
+    }
+
+} // namespace Nova::App::Bench
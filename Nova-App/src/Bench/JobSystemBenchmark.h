@@ -0,0 +1,12 @@
+#ifndef JOBSYSTEMBENCHMARK_H
+#define JOBSYSTEMBENCHMARK_H
+
+namespace Nova::App::Bench {
+
+    // Scaling of the job system from 1 thread to every hardware thread, on parallel culling
+    // of 1M bounds and composing 1M local transforms.
+    void RunJobSystemBenchmark();
+
+} // namespace Nova::App::Bench
+
+#endif // JOBSYSTEMBENCHMARK_H
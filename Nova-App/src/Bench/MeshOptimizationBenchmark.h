@@ -0,0 +1,13 @@
+#ifndef MESHOPTIMIZATIONBENCHMARK_H
+#define MESHOPTIMIZATIONBENCHMARK_H
+
+namespace Nova::App::Bench {
+
+    // Cook-time mesh optimization on a ~1M-triangle sphere in shuffled triangle and vertex order:
+    // vertex cache miss ratio, vertex fetch overhead and vertex memory (full vs. PackedVertex)
+    // before and after, with the time each step takes.
+    void RunMeshOptimizationBenchmark();
+
+} // namespace Nova::App::Bench
+
+#endif // MESHOPTIMIZATIONBENCHMARK_H
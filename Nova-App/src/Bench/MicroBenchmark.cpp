@@ -0,0 +1,25 @@
+#include "Bench/MicroBenchmark.h"
+
+#include <format>
+
+#include "Core/Log.h"
+
+namespace Nova::App::Bench {
+
+    static std::vector<MicroBenchmarkResult> s_Results;
+
+    void Report(const MicroBenchmarkResult& result) {
+        NV_LOG_INFO(std::format("[Bench] {}: {:.3f} ms ({} items, {:.1f} M items/s)",
+            result.m_Name, result.m_Milliseconds, result.m_Items, result.ItemsPerSecond() * 1e-6));
+        s_Results.push_back(result);
+    }
+
+    const std::vector<MicroBenchmarkResult>& GetReportedResults() {
+        return s_Results;
+    }
+
+    void ClearReportedResults() {
+        s_Results.clear();
+    }
+
+} // namespace Nova::App::Bench
@@ -0,0 +1,42 @@
+#ifndef MICROBENCHMARK_H
+#define MICROBENCHMARK_H
+
+#include <string>
+#include <vector>
+#include <chrono>
+#include <cstdint>
+#include <algorithm>
+
+namespace Nova::App::Bench {
+
+    struct MicroBenchmarkResult {
+        std::string m_Name;
+        uint64_t    m_Items{ 0 };          // work items processed per repetition
+        double      m_Milliseconds{ 0.0 }; // best repetition
+
+        double ItemsPerSecond() const { return m_Milliseconds > 0.0 ? m_Items / (m_Milliseconds * 1e-3) : 0.0; }
+    };
+
+    // Runs `fn` `repetitions` times and returns the fastest wall time in milliseconds.
+    template <typename Fn>
+    double MeasureBestMs(uint32_t repetitions, Fn&& fn) {
+        using Clock = std::chrono::steady_clock;
+
+        double best = 0.0;
+        for (uint32_t i = 0; i < repetitions; ++i) {
+            const auto start = Clock::now();
+            fn();
+            const double ms = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+            best = (i == 0) ? ms : std::min(best, ms);
+        }
+        return best;
+    }
+
+    // Logs the result and keeps it for the Render Stats panel.
+    void Report(const MicroBenchmarkResult& result);
+    const std::vector<MicroBenchmarkResult>& GetReportedResults();
+    void ClearReportedResults();
+
+} // namespace Nova::App::Bench
+
+#endif // MICROBENCHMARK_H
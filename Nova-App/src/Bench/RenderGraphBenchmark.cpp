@@ -0,0 +1,116 @@
+#include "Bench/RenderGraphBenchmark.h"
+
+#include <format>
+
+#include "Bench/MicroBenchmark.h"
+#include "Rendering/RenderGraph.h"
+
+namespace Nova::App::Bench {
+
+    using namespace Nova::App::Rendering;
+
+    namespace {
+
+        constexpr uint32_t k_Repetitions = 200;
+        constexpr uint32_t k_Width = 1920;
+        constexpr uint32_t k_Height = 1080;
+        constexpr uint32_t k_BloomLevels = 5;
+
+        void BuildDeferredFrame(RenderGraph& graph) {
+            graph.Reset();
+            const RGTexture color = graph.Import({ "Viewport Color", k_Width, k_Height, RGFormat::RGBA8 }, RGState::ShaderRead, RGState::ShaderRead);
+            const RGTexture depth = graph.Import({ "Viewport Depth", k_Width, k_Height, RGFormat::Depth32F }, RGState::Undefined, RGState::Undefined);
+
+            RGTexture shadow, albedo, normal, ao, hdr;
+            graph.AddPass("Shadow", [&](RenderGraph::PassBuilder& builder) {
+                shadow = builder.Create({ "Shadow Map", 2048, 2048, RGFormat::Depth32F });
+                builder.Write(shadow, RGState::DepthAttachment);
+            }, {});
+            graph.AddPass("GBuffer", [&](RenderGraph::PassBuilder& builder) {
+                albedo = builder.Create({ "Albedo", k_Width, k_Height, RGFormat::RGBA8 });
+                normal = builder.Create({ "Normal", k_Width, k_Height, RGFormat::RGBA16F });
+                builder.Write(albedo);
+                builder.Write(normal);
+                builder.Write(depth, RGState::DepthAttachment);
+            }, {});
+            // Nothing reads the ids this frame: culled.
+            graph.AddPass("Picking", [&](RenderGraph::PassBuilder& builder) {
+                builder.Write(builder.Create({ "Entity Ids", k_Width, k_Height, RGFormat::R32UI }));
+                builder.Read(depth, RGState::DepthRead);
+            }, {});
+            graph.AddPass("SSAO", [&](RenderGraph::PassBuilder& builder) {
+                ao = builder.Create({ "AO", k_Width, k_Height, RGFormat::R8 });
+                builder.Read(normal);
+                builder.Read(depth, RGState::DepthRead);
+                builder.Write(ao);
+            }, {});
+            graph.AddPass("Lighting", [&](RenderGraph::PassBuilder& builder) {
+                hdr = builder.Create({ "HDR", k_Width, k_Height, RGFormat::RGBA16F });
+                builder.Read(albedo);
+                builder.Read(normal);
+                builder.Read(ao);
+                builder.Read(shadow);
+                builder.Read(depth, RGState::DepthRead);
+                builder.Write(hdr);
+            }, {});
+
+            RGTexture source = hdr;
+            uint32_t width = k_Width / 2;
+            uint32_t height = k_Height / 2;
+            for (uint32_t level = 0; level < k_BloomLevels; ++level) {
+                graph.AddPass("Bloom", [&](RenderGraph::PassBuilder& builder) {
+                    const RGTexture target = builder.Create({ "Bloom", width, height, RGFormat::R11G11B10F });
+                    builder.Read(source);
+                    builder.Write(target);
+                    source = target;
+                }, {});
+                width /= 2;
+                height /= 2;
+            }
+
+            graph.AddPass("Tonemap", [&](RenderGraph::PassBuilder& builder) {
+                builder.Read(hdr);
+                builder.Read(source);
+                builder.Write(color);
+            }, {});
+            graph.AddPass("UI", [&](RenderGraph::PassBuilder& builder) {
+                builder.Read(color);
+                builder.SetSideEffect();
+            }, {});
+        }
+
+    } // namespace
+
+    void RunRenderGraphBenchmark() {
+        RenderGraph graph;
+
+        MicroBenchmarkResult build;
+        build.m_Items = k_Repetitions;
+        build.m_Milliseconds = MeasureBestMs(3, [&]() {
+            for (uint32_t i = 0; i < k_Repetitions; ++i) {
+                BuildDeferredFrame(graph);
+                graph.Compile();
+            }
+        });
+
+        const RenderGraphStats& stats = graph.GetStats();
+        build.m_Name = std::format("Render graph: build + compile ({} passes, {} culled)", stats.m_Passes, stats.m_CulledPasses);
+        Report(build);
+
+        MicroBenchmarkResult barriers;
+        barriers.m_Items = stats.m_Barriers;
+        barriers.m_Milliseconds = stats.m_CompileMs;
+        barriers.m_Name = std::format("Render graph: {} barriers, {} layout transitions", stats.m_Barriers, stats.m_LayoutTransitions);
+        Report(barriers);
+
+        const double transientMB = stats.m_TransientBytes / (1024.0 * 1024.0);
+        const double aliasedMB = stats.m_AliasedBytes / (1024.0 * 1024.0);
+        MicroBenchmarkResult memory;
+        memory.m_Items = stats.m_TransientTextures;
+        memory.m_Milliseconds = stats.m_CompileMs;
+        memory.m_Name = std::format("Render graph: {} transients, {:.1f} MB -> {:.1f} MB aliased ({:.0f}% saved)",
+            stats.m_TransientTextures, transientMB, aliasedMB, transientMB > 0.0 ? 100.0 * (1.0 - aliasedMB / transientMB) : 0.0);
+        Report(memory);
+    }
+
+} // namespace Nova::App::Bench
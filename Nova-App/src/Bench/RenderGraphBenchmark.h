@@ -0,0 +1,13 @@
+#ifndef RENDERGRAPHBENCHMARK_H
+#define RENDERGRAPHBENCHMARK_H
+
+namespace Nova::App::Bench {
+
+    // Render graph of a deferred 1080p frame (shadow, G-buffer, SSAO, lighting, bloom chain, tonemap,
+    // UI, plus an unused picking pass): build and compile time, culled passes, barrier counts and the
+    // transient memory saved by aliasing.
+    void RunRenderGraphBenchmark();
+
+} // namespace Nova::App::Bench
+
+#endif // RENDERGRAPHBENCHMARK_H
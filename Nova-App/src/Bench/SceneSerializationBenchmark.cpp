@@ -0,0 +1,101 @@
+#include "Bench/SceneSerializationBenchmark.h"
+
+#include <random>
+#include <format>
+#include <string>
+#include <filesystem>
+
+#include <entt/entt.hpp>
+
+#include "Asset/Assets/MeshAsset.h"
+#include "Scene/ECS/Components/TransformComponent.h"
+#include "Scene/ECS/Components/MeshRendererComponent.h"
+
+#include "Bench/MicroBenchmark.h"
+#include "Streaming/AssetStreamer.h"
+#include "World/HierarchyComponent.h"
+#include "World/NameComponent.h"
+#include "World/SceneSerializer.h"
+
+namespace Nova::App::Bench {
+
+    using Nova::Core::Scene::ECS::Components::TransformComponent;
+    using Nova::Core::Scene::ECS::Components::MeshRendererComponent;
+    using Nova::Core::Asset::Assets::MeshAsset;
+
+    namespace {
+
+        constexpr uint32_t k_Repetitions = 3;
+
+        void BuildScene(entt::registry& registry, uint32_t count) {
+            std::mt19937 rng(7);
+            std::uniform_real_distribution<float> position(-500.0f, 500.0f);
+            std::uniform_real_distribution<float> color(0.0f, 1.0f);
+
+            auto& streamer = Streaming::AssetStreamer::Get();
+            const auto cube = streamer.AcquireBlocking<MeshAsset>("Engine://Primitives/Cube");
+            const auto plane = streamer.AcquireBlocking<MeshAsset>("Engine://Primitives/Plane");
+
+            std::vector<entt::entity> entities(count);
+            registry.create(entities.begin(), entities.end());
+            for (uint32_t i = 0; i < count; ++i) {
+                const entt::entity entity = entities[i];
+                registry.emplace<TransformComponent>(entity,
+                    glm::vec3(position(rng), position(rng), position(rng)),
+                    glm::vec3(0.0f, 0.0f, 0.0f),
+                    glm::vec3(1.0f, 1.0f, 1.0f));
+
+                Nova::Core::Renderer::RHI::Material material{};
+                material.baseColor = glm::vec3(color(rng), color(rng), color(rng));
+                registry.emplace<MeshRendererComponent>(entity, (i % 4 == 0) ? plane : cube, material);
+                registry.emplace<World::NameComponent>(entity, std::format("Entity {}", i));
+
+                if (i % 10 == 9)
+                    registry.emplace<World::HierarchyComponent>(entity, entities[i - 1]);
+            }
+        }
+
+        void RunCase(uint32_t count) {
+            entt::registry source;
+            BuildScene(source, count);
+
+            const std::filesystem::path path = std::filesystem::temp_directory_path() / "NovaSceneBenchmark.nova";
+
+            World::SceneIOStats stats;
+            MicroBenchmarkResult save;
+            save.m_Items = count;
+            save.m_Milliseconds = MeasureBestMs(k_Repetitions, [&]() { World::SaveScene(source, path, &stats); });
+            save.m_Name = std::format("Scene {}k: save ({:.1f} MB, {} chunks)", count / 1000, stats.m_Bytes / (1024.0 * 1024.0), stats.m_Chunks);
+            Report(save);
+
+            for (const bool parallel : { false, true }) {
+                double decodeMs = 0.0;
+                double insertMs = 0.0;
+
+                MicroBenchmarkResult load;
+                load.m_Items = count;
+                load.m_Milliseconds = MeasureBestMs(k_Repetitions, [&]() {
+                    entt::registry target;
+                    World::SceneLoadOptions options;
+                    options.m_ParallelDecode = parallel;
+                    World::LoadScene(target, path, options, &stats);
+                    decodeMs = stats.m_DecodeMs;
+                    insertMs = stats.m_InsertMs;
+                });
+                load.m_Name = std::format("Scene {}k: load, {} decode ({:.1f} ms decode, {:.1f} ms insert)",
+                    count / 1000, parallel ? "parallel" : "serial", decodeMs, insertMs);
+                Report(load);
+            }
+
+            std::error_code error;
+            std::filesystem::remove(path, error);
+        }
+
+    } // namespace
+
+    void RunSceneSerializationBenchmark() {
+        for (const uint32_t count : { 10'000u, 100'000u, 1'000'000u })
+            RunCase(count);
+    }
+
+} // namespace Nova::App::Bench
@@ -0,0 +1,12 @@
+#ifndef SCENESERIALIZATIONBENCHMARK_H
+#define SCENESERIALIZATIONBENCHMARK_H
+
+namespace Nova::App::Bench {
+
+    // Save and load of 10k / 100k / 1M entity scenes (transform, mesh renderer, name, 10% parented):
+    // file size, save time, and load time with serial and parallel chunk decode.
+    void RunSceneSerializationBenchmark();
+
+} // namespace Nova::App::Bench
+
+#endif // SCENESERIALIZATIONBENCHMARK_H
@@ -0,0 +1,122 @@
+#include "Bench/SceneSnapshotBenchmark.h"
+
+#include <random>
+#include <format>
+#include <string>
+#include <algorithm>
+#include <functional>
+
+#include <entt/entt.hpp>
+
+#include "Asset/Assets/MeshAsset.h"
+#include "Scene/ECS/Components/TransformComponent.h"
+#include "Scene/ECS/Components/MeshRendererComponent.h"
+
+#include "Bench/MicroBenchmark.h"
+#include "Streaming/AssetStreamer.h"
+#include "World/HierarchyComponent.h"
+#include "World/NameComponent.h"
+#include "World/SceneSnapshot.h"
+
+namespace Nova::App::Bench {
+
+    using Nova::Core::Scene::ECS::Components::TransformComponent;
+    using Nova::Core::Scene::ECS::Components::MeshRendererComponent;
+    using Nova::Core::Asset::Assets::MeshAsset;
+
+    namespace {
+
+        constexpr uint32_t k_Repetitions = 3;
+
+        void BuildScene(entt::registry& registry, uint32_t count) {
+            std::mt19937 rng(11);
+            std::uniform_real_distribution<float> position(-500.0f, 500.0f);
+
+            const auto cube = Streaming::AssetStreamer::Get().AcquireBlocking<MeshAsset>("Engine://Primitives/Cube");
+
+            std::vector<entt::entity> entities(count);
+            registry.create(entities.begin(), entities.end());
+            for (uint32_t i = 0; i < count; ++i) {
+                const entt::entity entity = entities[i];
+                registry.emplace<TransformComponent>(entity,
+                    glm::vec3(position(rng), position(rng), position(rng)),
+                    glm::vec3(0.0f, 0.0f, 0.0f),
+                    glm::vec3(1.0f, 1.0f, 1.0f));
+                registry.emplace<MeshRendererComponent>(entity, cube, Nova::Core::Renderer::RHI::Material{});
+                registry.emplace<World::NameComponent>(entity, std::format("Entity {}", i));
+
+                if (i % 10 == 9)
+                    registry.emplace<World::HierarchyComponent>(entity, entities[i - 1]);
+            }
+        }
+
+        // Best restore time over the repetitions, `play` running between capture and restore.
+        void ReportRestore(entt::registry& registry, World::SceneSnapshot& snapshot, uint32_t count,
+                           const char* label, const std::function<void()>& play) {
+            World::SceneSnapshotStats best;
+            for (uint32_t i = 0; i < k_Repetitions; ++i) {
+                snapshot.Capture(registry);
+                play();
+                snapshot.Restore(registry);
+                if (i == 0 || snapshot.GetStats().m_RestoreMs < best.m_RestoreMs)
+                    best = snapshot.GetStats();
+            }
+
+            MicroBenchmarkResult result;
+            result.m_Items = count;
+            result.m_Milliseconds = best.m_RestoreMs;
+            result.m_Name = std::format("Snapshot {}k: restore, {} ({} copied, {} reinserted columns)",
+                count / 1000, label, best.m_ColumnsCopied, best.m_ColumnsReinserted);
+            Report(result);
+        }
+
+        void RunCase(uint32_t count) {
+            entt::registry registry;
+            BuildScene(registry, count);
+
+            World::SceneSnapshot snapshot;
+
+            World::SceneSnapshotStats captured;
+            MicroBenchmarkResult capture;
+            capture.m_Items = count;
+            capture.m_Milliseconds = MeasureBestMs(k_Repetitions, [&]() {
+                snapshot.Capture(registry);
+                captured = snapshot.GetStats();
+                snapshot.Reset();
+            });
+            capture.m_Name = std::format("Snapshot {}k: capture ({:.1f} MB, {} components)",
+                count / 1000, captured.m_Bytes / (1024.0 * 1024.0), captured.m_Components);
+            Report(capture);
+
+            ReportRestore(registry, snapshot, count, "untouched", []() {});
+
+            std::vector<entt::entity> entities;
+            entities.reserve(count);
+            for (const entt::entity entity : registry.view<TransformComponent>())
+                entities.push_back(entity);
+
+            const uint32_t touched = std::max(1u, count / 100);
+            ReportRestore(registry, snapshot, count, "1% transforms patched", [&]() {
+                for (uint32_t i = 0; i < touched; ++i)
+                    registry.patch<TransformComponent>(entities[(i * 97u) % count], [](TransformComponent& transform) {
+                        transform.m_Position.y += 1.0f;
+                    });
+            });
+
+            ReportRestore(registry, snapshot, count, "1% entities destroyed and created", [&]() {
+                for (uint32_t i = 0; i < touched; ++i)
+                    registry.destroy(entities[(i * 97u) % count]);
+                for (uint32_t i = 0; i < touched; ++i)
+                    registry.emplace<TransformComponent>(registry.create(),
+                        glm::vec3(0.0f, 0.0f, 0.0f), glm::vec3(0.0f, 0.0f, 0.0f), glm::vec3(1.0f, 1.0f, 1.0f));
+            });
+        }
+
+    } // namespace
+
+    void RunSceneSnapshotBenchmark() {
+        for (const uint32_t count : { 100'000u, 1'000'000u })
+            RunCase(count);
+    }
+
+} // namespace Nova::App::Bench
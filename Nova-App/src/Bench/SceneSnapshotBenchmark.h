@@ -0,0 +1,13 @@
+#ifndef SCENESNAPSHOTBENCHMARK_H
+#define SCENESNAPSHOTBENCHMARK_H
+
+namespace Nova::App::Bench {
+
+    // Play-mode scene snapshot at 100k and 1M entities: capture, restore of an untouched scene,
+    // restore after 1% of the transforms were patched, and restore after 1% of the entities were
+    // destroyed and as many created.
+    void RunSceneSnapshotBenchmark();
+
+} // namespace Nova::App::Bench
+
+#endif // SCENESNAPSHOTBENCHMARK_H
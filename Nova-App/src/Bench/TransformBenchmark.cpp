@@ -0,0 +1,158 @@
+#include "Bench/TransformBenchmark.h"
+
+#include <cmath>
+#include <random>
+#include <format>
+#include <algorithm>
+
+#include <entt/entt.hpp>
+
+#include "Scene/ECS/Components/TransformComponent.h"
+
+#include "Core/Log.h"
+
+#include "Bench/MicroBenchmark.h"
+#include "World/HierarchyComponent.h"
+#include "World/TransformCache.h"
+#include "World/TransformMath.h"
+
+namespace Nova::App::Bench {
+
+    using Nova::Core::Scene::ECS::Components::TransformComponent;
+
+    namespace {
+
+        constexpr uint32_t k_TransformCount = 100'000;
+        constexpr uint32_t k_DirtyPerFrame  = k_TransformCount / 100;
+        constexpr uint32_t k_Repetitions    = 20;
+        constexpr float    k_Tolerance      = 1e-4f;   // relative to the element's magnitude
+
+        // Largest element difference between `a` and `b`, relative to max(1, |element|).
+        float MatrixError(const glm::mat4& a, const glm::mat4& b) {
+            float error = 0.0f;
+            for (int column = 0; column < 4; ++column)
+                for (int row = 0; row < 4; ++row)
+                    error = std::max(error, std::abs(a[column][row] - b[column][row]) / std::max(1.0f, std::abs(b[column][row])));
+            return error;
+        }
+
+        // ComposeTRS, scalar and batched, must match TransformComponent::GetTransform(), which the
+        // cache replaces. Non-uniform scale under rotation is the case a wrong multiplication order breaks.
+        bool VerifyComposition() {
+            std::mt19937 rng(7);
+            std::uniform_real_distribution<float> position(-100.0f, 100.0f);
+            std::uniform_real_distribution<float> angle(-3.14f, 3.14f);
+            std::uniform_real_distribution<float> scale(0.25f, 4.0f);
+
+            // Not a multiple of 4, so the batched path's scalar tail is covered too.
+            constexpr uint32_t k_Count = 1023;
+            std::vector<World::TRS> trs(k_Count);
+            std::vector<uint32_t> slots(k_Count);
+            for (uint32_t i = 0; i < k_Count; ++i) {
+                trs[i] = { glm::vec3(position(rng), position(rng), position(rng)),
+                           glm::vec3(angle(rng), angle(rng), angle(rng)),
+                           glm::vec3(scale(rng), scale(rng), scale(rng)) };
+                slots[i] = k_Count - 1 - i;
+            }
+
+            std::vector<glm::mat4> batched(k_Count);
+            World::ComposeTRS(trs, batched.data(), slots.data());
+
+            float error = 0.0f;
+            for (uint32_t i = 0; i < k_Count; ++i) {
+                const glm::mat4 expected = TransformComponent(trs[i].m_Position, trs[i].m_Rotation, trs[i].m_Scale).GetTransform();
+                error = std::max({ error, MatrixError(World::ComposeTRS(trs[i]), expected), MatrixError(batched[slots[i]], expected) });
+            }
+
+            if (error > k_Tolerance) {
+                NV_LOG_ERROR(std::format("TransformBenchmark: ComposeTRS differs from GetTransform() by {:.2e}", error));
+                return false;
+            }
+            return true;
+        }
+
+        // Today's path: every draw recomposes its matrix, parents included.
+        glm::mat4 RecomputeWorld(entt::registry& registry, entt::entity entity) {
+            glm::mat4 world = registry.get<TransformComponent>(entity).GetTransform();
+            const auto* hierarchy = registry.try_get<World::HierarchyComponent>(entity);
+            while (hierarchy && hierarchy->m_Parent != entt::null) {
+                world = registry.get<TransformComponent>(hierarchy->m_Parent).GetTransform() * world;
+                hierarchy = registry.try_get<World::HierarchyComponent>(hierarchy->m_Parent);
+            }
+            return world;
+        }
+
+        void RunCase(const char* label, bool withHierarchy) {
+            std::mt19937 rng(42);
+            std::uniform_real_distribution<float> position(-100.0f, 100.0f);
+            std::uniform_real_distribution<float> angle(-3.14f, 3.14f);
+            std::uniform_real_distribution<float> scale(0.5f, 2.0f);
+
+            entt::registry registry;
+            World::TransformCache cache;
+            cache.Connect(registry);
+
+            std::vector<entt::entity> entities(k_TransformCount);
+            registry.create(entities.begin(), entities.end());
+            for (auto entity : entities) {
+                registry.emplace<TransformComponent>(entity,
+                    glm::vec3(position(rng), position(rng), position(rng)),
+                    glm::vec3(angle(rng), angle(rng), angle(rng)),
+                    glm::vec3(scale(rng), scale(rng), scale(rng)));
+            }
+
+            // One level of hierarchy: the first 1000 entities are roots, every other one has a root parent.
+            if (withHierarchy) {
+                std::uniform_int_distribution<uint32_t> root(0, 999);
+                for (uint32_t i = 1000; i < k_TransformCount; ++i)
+                    World::SetParent(registry, entities[i], entities[root(rng)]);
+            }
+
+            cache.Update();
+
+            std::uniform_int_distribution<uint32_t> pick(0, k_TransformCount - 1);
+            uint32_t updated = 0;
+
+            MicroBenchmarkResult cached;
+            cached.m_Items = k_TransformCount;
+            cached.m_Milliseconds = MeasureBestMs(k_Repetitions, [&]() {
+                for (uint32_t i = 0; i < k_DirtyPerFrame; ++i) {
+                    registry.patch<TransformComponent>(entities[pick(rng)], [&](TransformComponent& tc) {
+                        tc.m_Position.x += 0.01f;
+                    });
+                }
+                cache.Update();
+                updated = cache.GetUpdatedCount();
+            });
+            cached.m_Name = std::format("Transforms {}: cached, 1% dirty ({} world matrices updated)", label, updated);
+            Report(cached);
+
+            std::vector<glm::mat4> worlds(k_TransformCount);
+            MicroBenchmarkResult baseline;
+            baseline.m_Items = k_TransformCount;
+            baseline.m_Milliseconds = MeasureBestMs(k_Repetitions, [&]() {
+                for (uint32_t i = 0; i < k_TransformCount; ++i)
+                    worlds[i] = RecomputeWorld(registry, entities[i]);
+            });
+            baseline.m_Name = std::format("Transforms {}: recompute everything", label);
+            Report(baseline);
+
+            // The cached world matrices have to be the ones the baseline recomposes.
+            cache.Update();
+            float error = 0.0f;
+            for (uint32_t i = 0; i < k_TransformCount; ++i)
+                error = std::max(error, MatrixError(cache.GetWorldMatrix(entities[i]), worlds[i]));
+            if (error > k_Tolerance)
+                NV_LOG_ERROR(std::format("TransformBenchmark: cached world matrices ({}) differ from recomposed ones by {:.2e}", label, error));
+        }
+
+    } // namespace
+
+    void RunTransformBenchmark() {
+        if (!VerifyComposition())
+            return;
+        RunCase("flat", false);
+        RunCase("hierarchy", true);
+    }
+
+} // namespace Nova::App::Bench
@@ -0,0 +1,12 @@
+#ifndef TRANSFORMBENCHMARK_H
+#define TRANSFORMBENCHMARK_H
+
+namespace Nova::App::Bench {
+
+    // 100k transforms with 1% dirtied per frame: TransformCache::Update vs. recomputing every
+    // TransformComponent::GetTransform(), for a flat scene and a one-level hierarchy.
+    void RunTransformBenchmark();
+
+} // namespace Nova::App::Bench
+
+#endif // TRANSFORMBENCHMARK_H
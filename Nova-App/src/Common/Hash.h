@@ -0,0 +1,40 @@
+#ifndef HASH_H
+#define HASH_H
+
+#include <span>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <type_traits>
+
+namespace Nova::App {
+
+    // 64-bit FNV-1a. Used for content keys that are written to disk (cooked mesh names and source
+    // hashes, shader and pipeline cache keys), so the results must never change.
+    inline constexpr uint64_t k_Fnv1aOffset = 14695981039346656037ull;
+    inline constexpr uint64_t k_Fnv1aPrime = 1099511628211ull;
+
+    // Hash of `bytes`, continued from `seed`; the default seed starts a new hash.
+    inline uint64_t Fnv1a(std::span<const std::byte> bytes, uint64_t seed = k_Fnv1aOffset) {
+        uint64_t hash = seed;
+        for (std::byte b : bytes) {
+            hash ^= static_cast<uint64_t>(b);
+            hash *= k_Fnv1aPrime;
+        }
+        return hash;
+    }
+
+    inline uint64_t Fnv1a(std::string_view text, uint64_t seed = k_Fnv1aOffset) {
+        return Fnv1a(std::as_bytes(std::span(text.data(), text.size())), seed);
+    }
+
+    // Over the object representation of `value`.
+    template <typename T>
+    uint64_t Fnv1aOf(const T& value, uint64_t seed = k_Fnv1aOffset) {
+        static_assert(std::is_trivially_copyable_v<T>);
+        return Fnv1a(std::as_bytes(std::span(&value, 1)), seed);
+    }
+
+} // namespace Nova::App
+
+#endif // HASH_H
@@ -0,0 +1,117 @@
+#include "Input/EventQueue.h"
+
+#include <array>
+#include <limits>
+#include <algorithm>
+
+#include "Profiling/Profiler.h"
+
+namespace Nova::App::Input {
+
+    namespace {
+
+        constexpr uint64_t k_Mask = EventQueue::k_Capacity - 1;
+        static_assert((EventQueue::k_Capacity & k_Mask) == 0, "EventQueue capacity must be a power of two.");
+
+        constexpr size_t k_NoEvent = std::numeric_limits<size_t>::max();
+
+    } // namespace
+
+    EventQueue::EventQueue()
+        : m_Slots(std::make_unique<Slot[]>(k_Capacity)) {
+        // A slot is free for position p while its sequence is p, and holds p's event once it is p + 1.
+        for (uint32_t i = 0; i < k_Capacity; ++i)
+            m_Slots[i].m_Sequence.store(i, std::memory_order_relaxed);
+        m_Frame.reserve(256);
+    }
+
+    bool EventQueue::Push(const InputEvent& event) {
+        uint64_t position = m_Tail.load(std::memory_order_relaxed);
+        for (;;) {
+            Slot& slot = m_Slots[position & k_Mask];
+            const uint64_t sequence = slot.m_Sequence.load(std::memory_order_acquire);
+            const int64_t diff = static_cast<int64_t>(sequence) - static_cast<int64_t>(position);
+            if (diff == 0) {
+                if (m_Tail.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                    break;
+            }
+            else if (diff < 0) {
+                // The consumer has not freed this slot since the previous lap: full.
+                m_Rejected.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            }
+            else {
+                position = m_Tail.load(std::memory_order_relaxed);
+            }
+        }
+
+        Slot& slot = m_Slots[position & k_Mask];
+        slot.m_Event = event;
+        slot.m_Sequence.store(position + 1, std::memory_order_release);
+        return true;
+    }
+
+    void EventQueue::Drain() {
+        NV_PROFILE_SCOPE("EventQueue::Drain");
+        m_Frame.clear();
+
+        // Output index of the event each coalescable type merges into, until the next barrier.
+        std::array<size_t, static_cast<size_t>(InputEventType::Count)> pending;
+        pending.fill(k_NoEvent);
+
+        // Only what was claimed before the drain started: a fast producer cannot keep it going.
+        const uint64_t end = m_Tail.load(std::memory_order_acquire);
+        uint32_t received = 0;
+        uint32_t coalesced = 0;
+        while (m_Head != end) {
+            Slot& slot = m_Slots[m_Head & k_Mask];
+            if (slot.m_Sequence.load(std::memory_order_acquire) != m_Head + 1)
+                break;   // claimed but not yet written; it is drained next frame, in order
+
+            const InputEvent event = slot.m_Event;
+            slot.m_Sequence.store(m_Head + k_Capacity, std::memory_order_release);
+            ++m_Head;
+            ++received;
+
+            if (!m_CoalescingEnabled) {
+                m_Frame.push_back(event);
+                continue;
+            }
+
+            if (!IsCoalescable(event.m_Type)) {
+                pending.fill(k_NoEvent);
+                m_Frame.push_back(event);
+                continue;
+            }
+
+            size_t& index = pending[static_cast<size_t>(event.m_Type)];
+            if (index == k_NoEvent) {
+                index = m_Frame.size();
+                m_Frame.push_back(event);
+                continue;
+            }
+
+            // Scroll offsets are deltas; positions and sizes are absolute, the latest one wins.
+            InputEvent& merged = m_Frame[index];
+            if (event.m_Type == InputEventType::MouseScrolled)
+                merged.m_Value += event.m_Value;
+            else
+                merged.m_Value = event.m_Value;
+            ++coalesced;
+        }
+
+        m_Stats.m_Received = received;
+        m_Stats.m_Dispatched = static_cast<uint32_t>(m_Frame.size());
+        m_Stats.m_Coalesced = coalesced;
+        m_Stats.m_TotalReceived += received;
+        m_Stats.m_TotalDispatched += m_Frame.size();
+        m_Stats.m_MaxReceived = std::max(m_Stats.m_MaxReceived, received);
+    }
+
+    EventQueueStats EventQueue::GetStats() const {
+        EventQueueStats stats = m_Stats;
+        stats.m_Rejected = m_Rejected.load(std::memory_order_relaxed);
+        return stats;
+    }
+
+} // namespace Nova::App::Input
@@ -0,0 +1,108 @@
+#ifndef EVENTQUEUE_H
+#define EVENTQUEUE_H
+
+#include <atomic>
+#include <memory>
+#include <vector>
+#include <chrono>
+#include <cstdint>
+
+#include <glm/glm.hpp>
+
+namespace Nova::App::Input {
+
+    enum class InputEventType : uint8_t {
+        MouseMoved,            // m_Value: cursor position
+        MouseScrolled,         // m_Value: scroll offset
+        MouseButtonPressed,    // m_Button
+        MouseButtonReleased,   // m_Button
+        WindowResized,         // m_Value: size
+        PanelResized,          // m_Value: size of the viewport panel
+        Count
+    };
+
+    struct InputEvent {
+        InputEventType m_Type{ InputEventType::MouseMoved };
+        int       m_Button{ 0 };
+        glm::vec2 m_Value{ 0.0f, 0.0f };
+    };
+
+    // Motion, scroll and resizes can be merged within a frame; button events are ordering barriers.
+    constexpr bool IsCoalescable(InputEventType type) {
+        return type == InputEventType::MouseMoved || type == InputEventType::MouseScrolled ||
+               type == InputEventType::WindowResized || type == InputEventType::PanelResized;
+    }
+
+    struct EventQueueStats {
+        // Last Dispatch()
+        uint32_t m_Received{ 0 };      // events drained from the queue
+        uint32_t m_Dispatched{ 0 };    // handler calls after coalescing
+        uint32_t m_Coalesced{ 0 };     // ... and events merged into one of them
+        double   m_DispatchMs{ 0.0 };
+
+        // All time
+        uint64_t m_TotalReceived{ 0 };
+        uint64_t m_TotalDispatched{ 0 };
+        uint32_t m_MaxReceived{ 0 };   // in a single frame
+        uint32_t m_Rejected{ 0 };      // Push() calls that found the queue full
+    };
+
+    // Input events buffered between frames. Push() is lock-free and may be called from any thread
+    // (event pump, asset workers, an input thread); Dispatch() drains the queue once per frame on
+    // the consuming thread. Between two button events, all motion collapses into the final cursor
+    // position, scroll offsets add up and only the last size of a resize survives, so a
+    // high-polling-rate mouse costs one handler call per frame instead of hundreds.
+    //
+    // The ring is a bounded multi-producer queue with a sequence number per slot: producers claim
+    // a position with one compare-exchange and publish the slot by bumping its sequence, so a
+    // producer never waits on another one or on the consumer.
+    class EventQueue {
+    public:
+        static constexpr uint32_t k_Capacity = 4096;   // power of two
+
+        EventQueue();
+        EventQueue(const EventQueue&) = delete;
+        EventQueue& operator=(const EventQueue&) = delete;
+
+        // False when the queue is full; nothing was queued.
+        bool Push(const InputEvent& event);
+
+        // Merging can be turned off to compare against per-event dispatch.
+        void SetCoalescingEnabled(bool enabled) { m_CoalescingEnabled = enabled; }
+        bool IsCoalescingEnabled() const        { return m_CoalescingEnabled; }
+
+        // Consumer thread only. Calls `handler(const InputEvent&)` for the coalesced events, in
+        // queue order. Events pushed while it runs are left for the next call.
+        template <typename Handler>
+        void Dispatch(Handler&& handler) {
+            const auto start = std::chrono::steady_clock::now();
+            Drain();
+            for (const InputEvent& event : m_Frame)
+                handler(event);
+            m_Stats.m_DispatchMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        }
+
+        EventQueueStats GetStats() const;
+
+    private:
+        // Moves the published events into m_Frame, coalesced.
+        void Drain();
+
+        struct Slot {
+            std::atomic<uint64_t> m_Sequence{ 0 };
+            InputEvent m_Event;
+        };
+
+        std::unique_ptr<Slot[]> m_Slots;
+        alignas(64) std::atomic<uint64_t> m_Tail{ 0 };      // next position to claim, producers
+        alignas(64) uint64_t m_Head{ 0 };                   // next position to read, consumer
+        std::atomic<uint32_t> m_Rejected{ 0 };
+
+        std::vector<InputEvent> m_Frame;
+        bool m_CoalescingEnabled{ true };
+        EventQueueStats m_Stats;
+    };
+
+} // namespace Nova::App::Input
+
+#endif // EVENTQUEUE_H
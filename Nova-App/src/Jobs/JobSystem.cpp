@@ -0,0 +1,257 @@
+#include "Jobs/JobSystem.h"
+
+#include <format>
+#include <algorithm>
+
+#include "Core/Log.h"
+#include "Core/Assert.h"
+
+#include "Profiling/Profiler.h"
+
+namespace Nova::App::Jobs {
+
+    namespace {
+
+        // Which system/queue the current thread works for; null on threads that are not workers.
+        struct WorkerContext {
+            const JobSystem* m_System{ nullptr };
+            uint32_t m_Index{ 0 };
+        };
+
+        thread_local WorkerContext t_Worker;
+
+    } // namespace
+
+    JobSystem& JobSystem::Get() {
+        static JobSystem s_Instance;
+        return s_Instance;
+    }
+
+    void JobSystem::Init(const JobSystemDesc& desc) {
+        Shutdown();
+
+        uint32_t threadCount = desc.m_ThreadCount;
+        if (threadCount == 0)
+            threadCount = std::max(1u, std::thread::hardware_concurrency());
+
+        m_Stopping = false;
+        m_QueuedJobs = 0;
+
+        m_Queues.reserve(threadCount);
+        for (uint32_t i = 0; i < threadCount; ++i)
+            m_Queues.push_back(std::make_unique<WorkerQueue>());
+
+        for (uint32_t i = 1; i < threadCount; ++i)
+            m_Workers.emplace_back(&JobSystem::WorkerMain, this, i);
+
+        if (this == &Get())
+            NV_LOG_INFO(std::format("JobSystem: {} thread(s) ({} workers + main).", threadCount, threadCount - 1));
+    }
+
+    void JobSystem::Shutdown() {
+        if (m_Queues.empty())
+            return;
+
+        // Drain what is left so no counter stays pending forever.
+        while (TryRunOne()) {}
+
+        {
+            std::lock_guard lock(m_WakeMutex);
+            m_Stopping = true;
+        }
+        m_WakeCondition.notify_all();
+
+        for (auto& worker : m_Workers)
+            worker.join();
+
+        m_Workers.clear();
+        m_Queues.clear();
+    }
+
+    // ---- Submission ----
+
+    void JobSystem::Submit(JobFunction function, JobCounter* counter) {
+        if (counter)
+            counter->m_Pending.fetch_add(1, std::memory_order_relaxed);
+
+        Enqueue({ std::move(function), counter });
+    }
+
+    void JobSystem::Submit(JobFunction function, JobCounter* counter, JobCounter& dependency) {
+        if (counter)
+            counter->m_Pending.fetch_add(1, std::memory_order_relaxed);
+
+        {
+            // Under the dependency lock: Release() either already ran (pending == 0) or will see this job.
+            std::lock_guard lock(dependency.m_Mutex);
+            if (!dependency.IsDone()) {
+                dependency.m_Continuations.push_back({ std::move(function), counter });
+                return;
+            }
+        }
+
+        Enqueue({ std::move(function), counter });
+    }
+
+    void JobSystem::ParallelFor(uint32_t count, uint32_t grainSize, const std::function<void(uint32_t, uint32_t)>& function, JobCounter* counter) {
+        if (count == 0)
+            return;
+
+        grainSize = std::max(1u, grainSize);
+
+        // Small ranges or no helpers: not worth the queueing.
+        if (!counter && (count <= grainSize || GetThreadCount() <= 1)) {
+            function(0, count);
+            return;
+        }
+
+        JobCounter local;
+        JobCounter& target = counter ? *counter : local;
+
+        for (uint32_t begin = 0; begin < count; begin += grainSize) {
+            const uint32_t end = std::min(count, begin + grainSize);
+            Submit([&function, begin, end]() { function(begin, end); }, &target);
+        }
+
+        if (!counter)
+            Wait(local);
+    }
+
+    void JobSystem::Enqueue(Job job) {
+        NV_ASSERT_MSG(!m_Queues.empty(), "JobSystem is not initialized.");
+
+        const uint32_t index = CurrentQueueIndex();
+        {
+            std::lock_guard lock(m_Queues[index]->m_Mutex);
+            m_Queues[index]->m_Jobs.push_back(std::move(job));
+        }
+
+        m_QueuedJobs.fetch_add(1, std::memory_order_release);
+        {
+            // Pairs with the predicate check in WorkerMain so the wake-up cannot be lost.
+            std::lock_guard lock(m_WakeMutex);
+        }
+        m_WakeCondition.notify_one();
+    }
+
+    // ---- Execution ----
+
+    uint32_t JobSystem::CurrentQueueIndex() const {
+        return t_Worker.m_System == this ? t_Worker.m_Index : 0;
+    }
+
+    bool JobSystem::TryPop(uint32_t index, Job& job) {
+        WorkerQueue& queue = *m_Queues[index];
+        std::lock_guard lock(queue.m_Mutex);
+        if (queue.m_Jobs.empty())
+            return false;
+
+        // Owners take their newest job (LIFO): a waiting job runs the work it just spawned first.
+        job = std::move(queue.m_Jobs.back());
+        queue.m_Jobs.pop_back();
+        return true;
+    }
+
+    bool JobSystem::TrySteal(uint32_t thief, Job& job) {
+        const uint32_t count = static_cast<uint32_t>(m_Queues.size());
+        for (uint32_t offset = 1; offset < count; ++offset) {
+            WorkerQueue& victim = *m_Queues[(thief + offset) % count];
+            std::lock_guard lock(victim.m_Mutex);
+            if (victim.m_Jobs.empty())
+                continue;
+
+            // Oldest job first: it is the least likely to be cache-warm for the victim.
+            job = std::move(victim.m_Jobs.front());
+            victim.m_Jobs.pop_front();
+            return true;
+        }
+        return false;
+    }
+
+    bool JobSystem::TryRunOne() {
+        if (m_QueuedJobs.load(std::memory_order_acquire) == 0)
+            return false;
+
+        const uint32_t index = CurrentQueueIndex();
+
+        Job job;
+        if (!TryPop(index, job) && !TrySteal(index, job))
+            return false;
+
+        m_QueuedJobs.fetch_sub(1, std::memory_order_acq_rel);
+        Execute(job);
+        return true;
+    }
+
+    void JobSystem::Execute(Job& job) {
+        {
+            NV_PROFILE_SCOPE("Job");
+            job.m_Function();
+        }
+
+        if (job.m_Counter)
+            Decrement(*job.m_Counter);
+    }
+
+    void JobSystem::Decrement(JobCounter& counter) {
+        // Not the last job: a plain decrement, the counter is not touched afterwards.
+        uint32_t pending = counter.m_Pending.load(std::memory_order_relaxed);
+        while (pending > 1) {
+            if (counter.m_Pending.compare_exchange_weak(pending, pending - 1, std::memory_order_acq_rel))
+                return;
+        }
+
+        // Last job: collect the continuations and publish zero under the lock. Wait() takes the same
+        // lock before returning, so the owner cannot destroy the counter while we still hold it.
+        std::vector<Job> continuations;
+        {
+            std::lock_guard lock(counter.m_Mutex);
+            continuations.swap(counter.m_Continuations);
+            counter.m_Pending.fetch_sub(1, std::memory_order_acq_rel);
+        }
+
+        for (Job& continuation : continuations)
+            Enqueue(std::move(continuation));
+    }
+
+    void JobSystem::Wait(JobCounter& counter) {
+        while (!counter.IsDone()) {
+            if (!TryRunOne())
+                std::this_thread::yield();
+        }
+
+        // Synchronize with the thread that released the counter (see Decrement).
+        std::lock_guard lock(counter.m_Mutex);
+    }
+
+    uint32_t JobSystem::RunPending(uint32_t maxJobs) {
+        uint32_t ran = 0;
+        while (ran < maxJobs && TryRunOne())
+            ++ran;
+        return ran;
+    }
+
+    void JobSystem::WorkerMain(uint32_t index) {
+        t_Worker = { this, index };
+
+#if NV_PROFILER_ENABLED
+        Profiling::Profiler::Get().SetThreadName(std::format("Worker {}", index));
+#endif
+
+        while (true) {
+            if (TryRunOne())
+                continue;
+
+            std::unique_lock lock(m_WakeMutex);
+            m_WakeCondition.wait(lock, [this]() {
+                return m_Stopping.load() || m_QueuedJobs.load(std::memory_order_acquire) > 0;
+            });
+
+            if (m_Stopping.load())
+                break;
+        }
+
+        t_Worker = {};
+    }
+
+} // namespace Nova::App::Jobs
@@ -0,0 +1,118 @@
+#ifndef JOBSYSTEM_H
+#define JOBSYSTEM_H
+
+#include <mutex>
+#include <deque>
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+#include <cstdint>
+#include <functional>
+#include <condition_variable>
+
+namespace Nova::App::Jobs {
+
+    class JobSystem;
+    class JobCounter;
+
+    using JobFunction = std::function<void()>;
+
+    struct Job {
+        JobFunction m_Function;
+        JobCounter* m_Counter{ nullptr };
+    };
+
+    // Counts the unfinished jobs submitted with it. Jobs submitted with a counter as their
+    // dependency are held back until that counter reaches zero.
+    // A counter must outlive the jobs that reference it: destroy it only after Wait() returned.
+    class JobCounter {
+    public:
+        JobCounter() = default;
+        JobCounter(const JobCounter&) = delete;
+        JobCounter& operator=(const JobCounter&) = delete;
+
+        bool IsDone() const { return m_Pending.load(std::memory_order_acquire) == 0; }
+        uint32_t GetPending() const { return m_Pending.load(std::memory_order_acquire); }
+
+    private:
+        friend class JobSystem;
+
+        std::atomic<uint32_t> m_Pending{ 0 };
+
+        std::mutex m_Mutex;
+        std::vector<Job> m_Continuations;
+    };
+
+    struct JobSystemDesc {
+        // Total number of threads executing jobs, the calling (main) thread included.
+        // 0 = one per hardware thread. 1 = no worker threads: jobs only run on the main thread,
+        // from Wait() / RunPending(), in a fixed order, which makes execution deterministic.
+        uint32_t m_ThreadCount{ 0 };
+    };
+
+    // Work-stealing scheduler: every worker owns a deque, pops its own work LIFO (cache-warm)
+    // and steals FIFO from the others when it runs dry. Threads that are not workers of this
+    // system (main thread, other systems) submit into slot 0, owned by the main thread.
+    class JobSystem {
+    public:
+        JobSystem() = default;
+        ~JobSystem() { Shutdown(); }
+
+        JobSystem(const JobSystem&) = delete;
+        JobSystem& operator=(const JobSystem&) = delete;
+
+        // Process-wide instance used by layers, asset loading and the renderer.
+        static JobSystem& Get();
+
+        void Init(const JobSystemDesc& desc);
+        void Shutdown();
+
+        bool IsInitialized() const { return !m_Queues.empty(); }
+        uint32_t GetThreadCount() const { return static_cast<uint32_t>(m_Queues.size()); }
+
+        void Submit(JobFunction function, JobCounter* counter = nullptr);
+        // Runs `function` once `dependency` has reached zero.
+        void Submit(JobFunction function, JobCounter* counter, JobCounter& dependency);
+
+        // Splits [0, count) into chunks of at most `grainSize` items and runs `function(begin, end)` on each.
+        // With a counter the call returns immediately (and `function` must outlive the chunks);
+        // without one it waits, running chunks itself, until all of them are done.
+        void ParallelFor(uint32_t count, uint32_t grainSize, const std::function<void(uint32_t, uint32_t)>& function, JobCounter* counter = nullptr);
+
+        // Executes pending jobs on the calling thread until the counter reaches zero.
+        void Wait(JobCounter& counter);
+
+        // Executes up to `maxJobs` pending jobs on the calling thread without waiting. Returns how many ran.
+        // Called once per frame by AppLayer so fire-and-forget jobs progress with a single thread.
+        uint32_t RunPending(uint32_t maxJobs);
+
+    private:
+        struct WorkerQueue {
+            std::mutex m_Mutex;
+            std::deque<Job> m_Jobs;
+        };
+
+        void WorkerMain(uint32_t index);
+
+        void Enqueue(Job job);
+        bool TryPop(uint32_t index, Job& job);
+        bool TrySteal(uint32_t thief, Job& job);
+        bool TryRunOne();
+        void Execute(Job& job);
+        void Decrement(JobCounter& counter);
+
+        uint32_t CurrentQueueIndex() const;
+
+        std::vector<std::unique_ptr<WorkerQueue>> m_Queues;   // [0] = main / external threads
+        std::vector<std::thread> m_Workers;
+
+        std::atomic<uint32_t> m_QueuedJobs{ 0 };
+        std::atomic<bool> m_Stopping{ false };
+        std::mutex m_WakeMutex;
+        std::condition_variable m_WakeCondition;
+    };
+
+} // namespace Nova::App::Jobs
+
+#endif // JOBSYSTEM_H
@@ -0,0 +1,172 @@
+#include "Profiling/Profiler.h"
+
+#include <format>
+#include <fstream>
+#include <algorithm>
+
+#include "Core/Log.h"
+
+namespace Nova::App::Profiling {
+
+    namespace {
+
+        void WriteJsonString(std::ofstream& out, std::string_view text) {
+            out << '"';
+            for (char c : text) {
+                switch (c) {
+                case '"':  out << "\\\""; break;
+                case '\\': out << "\\\\"; break;
+                case '\n': out << "\\n"; break;
+                default:
+                    if (static_cast<unsigned char>(c) >= 0x20)
+                        out << c;
+                    break;
+                }
+            }
+            out << '"';
+        }
+
+        void WriteCompleteEvent(std::ofstream& out, bool& first, const char* name, uint32_t pid, uint32_t tid, uint64_t startNs, uint64_t endNs) {
+            out << (first ? "\n" : ",\n") << "{\"ph\":\"X\",\"name\":";
+            WriteJsonString(out, name ? name : "?");
+            out << std::format(",\"pid\":{},\"tid\":{},\"ts\":{:.3f},\"dur\":{:.3f}}}",
+                pid, tid, startNs * 1e-3, (endNs - startNs) * 1e-3);
+            first = false;
+        }
+
+        void WriteThreadName(std::ofstream& out, bool& first, uint32_t pid, uint32_t tid, std::string_view name) {
+            out << (first ? "\n" : ",\n") << std::format("{{\"ph\":\"M\",\"name\":\"thread_name\",\"pid\":{},\"tid\":{},\"args\":{{\"name\":", pid, tid);
+            WriteJsonString(out, name);
+            out << "}}";
+            first = false;
+        }
+
+    } // namespace
+
+    Profiler& Profiler::Get() {
+        static Profiler s_Instance;
+        return s_Instance;
+    }
+
+    void Profiler::SetEnabled(bool enabled) {
+        if (enabled && !IsEnabled())
+            m_FrameStartNs = NowNs();
+        s_Enabled.store(enabled, std::memory_order_relaxed);
+    }
+
+    ThreadBuffer& Profiler::GetThreadBuffer() {
+        static thread_local ThreadBuffer* s_Buffer = nullptr;
+        if (s_Buffer)
+            return *s_Buffer;
+
+        // Buffers live until the profiler is destroyed so threads can exit with zones still queued.
+        std::lock_guard lock(m_ThreadsMutex);
+        const uint32_t index = static_cast<uint32_t>(m_Threads.size());
+        m_Threads.push_back(std::make_unique<ThreadBuffer>(index, std::format("Thread {}", index)));
+        s_Buffer = m_Threads.back().get();
+        return *s_Buffer;
+    }
+
+    void Profiler::SetThreadName(std::string name) {
+        ThreadBuffer& buffer = GetThreadBuffer();
+        std::lock_guard lock(m_ThreadsMutex);
+        buffer.SetName(std::move(name));
+    }
+
+    std::string Profiler::GetThreadName(uint32_t thread) const {
+        std::lock_guard lock(m_ThreadsMutex);
+        return thread < m_Threads.size() ? m_Threads[thread]->GetName() : std::string("?");
+    }
+
+    uint64_t Profiler::GetDroppedEvents() const {
+        std::lock_guard lock(m_ThreadsMutex);
+        uint64_t dropped = 0;
+        for (const auto& buffer : m_Threads)
+            dropped += buffer->GetDropped();
+        return dropped;
+    }
+
+    void Profiler::SubmitGpuZones(std::vector<ProfileEvent> zones) {
+        m_PendingGpu = std::move(zones);
+    }
+
+    void Profiler::EndFrame() {
+        const uint64_t endNs = NowNs();
+
+        FrameCapture frame;
+        frame.m_Frame = m_Frame++;
+        frame.m_StartNs = m_FrameStartNs;
+        frame.m_EndNs = endNs;
+        frame.m_Gpu = std::move(m_PendingGpu);
+        m_PendingGpu.clear();
+        m_FrameStartNs = endNs;
+
+        {
+            std::lock_guard lock(m_ThreadsMutex);
+            for (const auto& buffer : m_Threads) {
+                ThreadTrack track;
+                track.m_Thread = buffer->GetIndex();
+                buffer->Drain([&](const ProfileEvent& event) { track.m_Events.push_back(event); });
+                if (track.m_Events.empty())
+                    continue;
+
+                std::sort(track.m_Events.begin(), track.m_Events.end(), [](const ProfileEvent& a, const ProfileEvent& b) {
+                    return a.m_StartNs != b.m_StartNs ? a.m_StartNs < b.m_StartNs : a.m_Depth < b.m_Depth;
+                });
+                frame.m_Threads.push_back(std::move(track));
+            }
+        }
+
+        if (m_Paused || !IsEnabled())
+            return;
+
+        m_History.push_back(std::move(frame));
+        while (m_History.size() > k_HistoryFrames)
+            m_History.pop_front();
+    }
+
+    bool Profiler::ExportChromeTrace(const std::filesystem::path& path) const {
+        std::error_code error;
+        if (path.has_parent_path())
+            std::filesystem::create_directories(path.parent_path(), error);
+
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        if (!out) {
+            NV_LOG_ERROR(std::format("Failed to write profiler trace '{}'", path.string()));
+            return false;
+        }
+
+        constexpr uint32_t k_CpuProcess = 1;
+        constexpr uint32_t k_GpuProcess = 2;
+
+        out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+        bool first = true;
+
+        {
+            std::lock_guard lock(m_ThreadsMutex);
+            for (const auto& buffer : m_Threads)
+                WriteThreadName(out, first, k_CpuProcess, buffer->GetIndex(), buffer->GetName());
+        }
+        WriteThreadName(out, first, k_GpuProcess, 0, "GPU");
+
+        for (const FrameCapture& frame : m_History) {
+            for (const ThreadTrack& track : frame.m_Threads)
+                for (const ProfileEvent& event : track.m_Events)
+                    WriteCompleteEvent(out, first, event.m_Name, k_CpuProcess, track.m_Thread, event.m_StartNs, event.m_EndNs);
+
+            // GPU timestamps are on their own clock: place them at the start of the CPU frame.
+            for (const ProfileEvent& event : frame.m_Gpu)
+                WriteCompleteEvent(out, first, event.m_Name, k_GpuProcess, 0, frame.m_StartNs + event.m_StartNs, frame.m_StartNs + event.m_EndNs);
+        }
+
+        out << "\n]}\n";
+        if (!out) {
+            NV_LOG_ERROR(std::format("Failed to write profiler trace '{}'", path.string()));
+            return false;
+        }
+
+        NV_LOG_INFO(std::format("Wrote profiler trace of {} frames to '{}'", m_History.size(), path.string()));
+        return true;
+    }
+
+} // namespace Nova::App::Profiling
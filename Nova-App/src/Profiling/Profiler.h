@@ -0,0 +1,238 @@
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <array>
+#include <deque>
+#include <mutex>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <filesystem>
+
+// NV_PROFILE_SCOPE("Name") times the enclosing scope on the calling thread.
+// NV_PROFILE_GPU_SCOPE(renderer, "Name") brackets the commands recorded in the scope with GPU timestamps.
+// Both cost one relaxed atomic load while the profiler is disabled, and nothing when
+// NV_PROFILER_ENABLED is 0 (CMake option NOVA_APP_ENABLE_PROFILER).
+#ifndef NV_PROFILER_ENABLED
+    #define NV_PROFILER_ENABLED 1
+#endif
+
+#define NV_PROFILE_CONCAT_IMPL(a, b) a##b
+#define NV_PROFILE_CONCAT(a, b) NV_PROFILE_CONCAT_IMPL(a, b)
+
+#if NV_PROFILER_ENABLED
+    #define NV_PROFILE_SCOPE(name) ::Nova::App::Profiling::CpuScope NV_PROFILE_CONCAT(nvProfileScope_, __LINE__)(name)
+    #define NV_PROFILE_GPU_SCOPE(renderer, name) ::Nova::App::Profiling::GpuScope NV_PROFILE_CONCAT(nvProfileGpuScope_, __LINE__)(renderer, name)
+#else
+    #define NV_PROFILE_SCOPE(name) ((void)0)
+    #define NV_PROFILE_GPU_SCOPE(renderer, name) ((void)0)
+#endif
+
+namespace Nova::App::Profiling {
+
+    struct ProfileEvent {
+        const char* m_Name{ nullptr };   // string literal
+        uint64_t m_StartNs{ 0 };         // since the profiler epoch
+        uint64_t m_EndNs{ 0 };
+        uint32_t m_Depth{ 0 };
+    };
+
+    // Single-producer / single-consumer ring: the owning thread pushes finished zones, the main
+    // thread drains them once per frame. Events are dropped, not blocked on, when it is full.
+    class ThreadBuffer {
+    public:
+        static constexpr uint32_t k_Capacity = 16 * 1024;
+
+        ThreadBuffer(uint32_t index, std::string name) : m_Index(index), m_Name(std::move(name)) {}
+
+        void Push(const ProfileEvent& event) {
+            const uint64_t write = m_Write.load(std::memory_order_relaxed);
+            if (write - m_Read.load(std::memory_order_acquire) >= k_Capacity) {
+                m_Dropped.fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+            m_Events[write % k_Capacity] = event;
+            m_Write.store(write + 1, std::memory_order_release);
+        }
+
+        template <typename Fn>
+        void Drain(Fn&& fn) {
+            uint64_t read = m_Read.load(std::memory_order_relaxed);
+            const uint64_t write = m_Write.load(std::memory_order_acquire);
+            for (; read < write; ++read)
+                fn(m_Events[read % k_Capacity]);
+            m_Read.store(read, std::memory_order_release);
+        }
+
+        uint32_t GetIndex() const { return m_Index; }
+        const std::string& GetName() const { return m_Name; }
+        void SetName(std::string name) { m_Name = std::move(name); }
+        uint64_t GetDropped() const { return m_Dropped.load(std::memory_order_relaxed); }
+
+        uint32_t m_Depth{ 0 };   // owner thread only
+
+    private:
+        std::array<ProfileEvent, k_Capacity> m_Events{};
+        std::atomic<uint64_t> m_Write{ 0 };
+        std::atomic<uint64_t> m_Read{ 0 };
+        std::atomic<uint64_t> m_Dropped{ 0 };
+
+        uint32_t m_Index{ 0 };
+        std::string m_Name;
+    };
+
+    struct ThreadTrack {
+        uint32_t m_Thread{ 0 };
+        std::vector<ProfileEvent> m_Events;   // sorted by start
+    };
+
+    struct FrameCapture {
+        uint64_t m_Frame{ 0 };
+        uint64_t m_StartNs{ 0 };
+        uint64_t m_EndNs{ 0 };
+        std::vector<ThreadTrack> m_Threads;
+        std::vector<ProfileEvent> m_Gpu;      // relative to m_StartNs's timeline, when available
+
+        double GetDurationMs() const { return (m_EndNs - m_StartNs) * 1e-6; }
+    };
+
+    class Profiler {
+    public:
+        static constexpr size_t k_HistoryFrames = 300;
+
+        static Profiler& Get();
+
+        static bool IsEnabled() { return s_Enabled.load(std::memory_order_relaxed); }
+        void SetEnabled(bool enabled);
+
+        // While paused, frames are still drained but not kept, so the history can be inspected.
+        void SetPaused(bool paused) { m_Paused = paused; }
+        bool IsPaused() const { return m_Paused; }
+
+        static uint64_t NowNs() {
+            return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - s_Epoch).count());
+        }
+
+        // Buffer of the calling thread, registered on first use.
+        ThreadBuffer& GetThreadBuffer();
+        void SetThreadName(std::string name);
+
+        // Main thread, once per frame: collects the zones that finished since the last call.
+        void EndFrame();
+        void SubmitGpuZones(std::vector<ProfileEvent> zones);
+
+        const std::deque<FrameCapture>& GetHistory() const { return m_History; }
+        std::string GetThreadName(uint32_t thread) const;
+        uint64_t GetDroppedEvents() const;
+
+        // Chrome trace event format (chrome://tracing, Perfetto) of the kept history.
+        bool ExportChromeTrace(const std::filesystem::path& path) const;
+
+    private:
+        static inline std::atomic<bool> s_Enabled{ false };
+        static inline const std::chrono::steady_clock::time_point s_Epoch = std::chrono::steady_clock::now();
+
+        mutable std::mutex m_ThreadsMutex;
+        std::vector<std::unique_ptr<ThreadBuffer>> m_Threads;
+
+        std::deque<FrameCapture> m_History;
+        std::vector<ProfileEvent> m_PendingGpu;
+        uint64_t m_FrameStartNs{ 0 };
+        uint64_t m_Frame{ 0 };
+        bool m_Paused{ false };
+    };
+
+    class CpuScope {
+    public:
+        explicit CpuScope(const char* name) {
+            if (!Profiler::IsEnabled())
+                return;
+            m_Buffer = &Profiler::Get().GetThreadBuffer();
+            m_Name = name;
+            m_Depth = m_Buffer->m_Depth++;
+            m_StartNs = Profiler::NowNs();
+        }
+
+        ~CpuScope() {
+            if (!m_Buffer)
+                return;
+            --m_Buffer->m_Depth;
+            m_Buffer->Push({ m_Name, m_StartNs, Profiler::NowNs(), m_Depth });
+        }
+
+        CpuScope(const CpuScope&) = delete;
+        CpuScope& operator=(const CpuScope&) = delete;
+
+    private:
+        ThreadBuffer* m_Buffer{ nullptr };
+        const char* m_Name{ nullptr };
+        uint64_t m_StartNs{ 0 };
+        uint32_t m_Depth{ 0 };
+    };
+
+    // ---- GPU timestamps ----
+    // Renderer-side timestamp queries: zones bracket the commands recorded between Begin and End;
+    // GetGpuZones() returns the zones of the most recent frame whose queries are available, each
+    // with m_Name and m_StartMs/m_EndMs relative to that frame's first timestamp.
+    template <typename Renderer>
+    concept GpuTimestampSupport = requires(Renderer& renderer, const char* name) {
+        renderer.BeginGpuZone(name);
+        renderer.EndGpuZone();
+        renderer.GetGpuZones().begin()->m_StartMs;
+    };
+
+    template <typename Renderer>
+    class GpuScope {
+    public:
+        GpuScope(Renderer* renderer, const char* name) {
+            if constexpr (GpuTimestampSupport<Renderer>) {
+                if (renderer && Profiler::IsEnabled()) {
+                    m_Renderer = renderer;
+                    m_Renderer->BeginGpuZone(name);
+                }
+            }
+        }
+
+        ~GpuScope() {
+            if constexpr (GpuTimestampSupport<Renderer>) {
+                if (m_Renderer)
+                    m_Renderer->EndGpuZone();
+            }
+        }
+
+        GpuScope(const GpuScope&) = delete;
+        GpuScope& operator=(const GpuScope&) = delete;
+
+    private:
+        Renderer* m_Renderer{ nullptr };
+    };
+
+    template <typename Renderer>
+    GpuScope(Renderer*, const char*) -> GpuScope<Renderer>;
+
+    template <typename Renderer>
+    constexpr bool HasGpuTimestamps() { return GpuTimestampSupport<Renderer>; }
+
+    // Main thread, before Profiler::EndFrame(): forwards the renderer's resolved GPU zones.
+    template <typename Renderer>
+    void CollectGpuZones(Renderer& renderer) {
+        if constexpr (GpuTimestampSupport<Renderer>) {
+            if (!Profiler::IsEnabled())
+                return;
+
+            std::vector<ProfileEvent> zones;
+            for (const auto& zone : renderer.GetGpuZones()) {
+                zones.push_back({ zone.m_Name,
+                                  static_cast<uint64_t>(zone.m_StartMs * 1e6),
+                                  static_cast<uint64_t>(zone.m_EndMs * 1e6), 0 });
+            }
+            Profiler::Get().SubmitGpuZones(std::move(zones));
+        }
+    }
+
+} // namespace Nova::App::Profiling
+
+#endif // PROFILER_H
@@ -0,0 +1,87 @@
+#include "Rendering/DynamicResolution.h"
+
+#include <cmath>
+#include <algorithm>
+
+namespace Nova::App::Rendering {
+
+    namespace {
+
+        float QuantizeScale(float scale) {
+            return std::round(scale / DynamicResolution::k_ScaleStep) * DynamicResolution::k_ScaleStep;
+        }
+
+    } // namespace
+
+    void DynamicResolution::SetEnabled(bool enabled) {
+        if (enabled == m_Enabled)
+            return;
+        m_Enabled = enabled;
+        m_Scale = m_Settings.m_MaxScale;
+        m_SettleFrames = k_SettleFrames;
+        m_Samples = 0;
+    }
+
+    void DynamicResolution::SetSettings(const DynamicResolutionSettings& settings) {
+        m_Settings = settings;
+        m_Settings.m_MinScale = std::clamp(m_Settings.m_MinScale, k_ScaleStep, 1.0f);
+        m_Settings.m_MaxScale = std::clamp(m_Settings.m_MaxScale, m_Settings.m_MinScale, 1.0f);
+        m_Settings.m_TargetFrameMs = std::max(m_Settings.m_TargetFrameMs, 1.0f);
+        m_Scale = std::clamp(m_Scale, m_Settings.m_MinScale, m_Settings.m_MaxScale);
+    }
+
+    void DynamicResolution::Update(float frameMs, bool gpuTimed, float displayIntervalMs) {
+        m_Stats.m_FrameMs = frameMs;
+        m_Stats.m_GpuTimed = gpuTimed;
+        m_Stats.m_DisplayIntervalMs = displayIntervalMs;
+        if (!m_Enabled || frameMs <= 0.0f)
+            return;
+
+        // Frames still in flight were rendered at the previous scale: their times say nothing yet.
+        if (m_SettleFrames > 0) {
+            --m_SettleFrames;
+            return;
+        }
+
+        float& filtered = m_Stats.m_FilteredFrameMs;
+        filtered = m_Samples > 0 ? filtered + (frameMs - filtered) * k_Smoothing : frameMs;
+        if (++m_Samples < k_MinSamples)
+            return;
+
+        // Frame time goes with the pixel count, the square of the per-axis scale.
+        const float target = m_Settings.m_TargetFrameMs;
+        const float ideal = m_Scale * std::sqrt(target / filtered);
+
+        // Over budget but within the refresh interval, a frame is presented at the next refresh all
+        // the same: rendering fewer pixels would gain nothing.
+        const float overBudget = std::max(target, displayIntervalMs * k_DisplaySlack);
+
+        float next = m_Scale;
+        if (filtered > overBudget)
+            next = std::floor(ideal / k_ScaleStep + 1e-3f) * k_ScaleStep;   // at once, rounding down
+        else if (filtered < target * k_Headroom)
+            next = QuantizeScale(std::min(ideal, m_Scale + k_MaxScaleUp));
+        next = std::clamp(next, m_Settings.m_MinScale, m_Settings.m_MaxScale);
+
+        if (std::fabs(next - m_Scale) < k_ScaleStep * 0.5f)
+            return;
+
+        // The filter starts over at the new scale.
+        m_Scale = next;
+        m_Samples = 0;
+        m_SettleFrames = k_SettleFrames;
+        ++m_Stats.m_ScaleChanges;
+    }
+
+    glm::uvec2 DynamicResolution::GetRenderSize(const glm::vec2& viewportSize) const {
+        if (viewportSize.x < 1.0f || viewportSize.y < 1.0f)
+            return glm::uvec2(0, 0);
+
+        // Whole pixels first, so a scale of 1 gives exactly the viewport's size.
+        const float scale = GetScale();
+        const glm::uvec2 full(static_cast<uint32_t>(viewportSize.x), static_cast<uint32_t>(viewportSize.y));
+        return glm::uvec2(std::max(1u, static_cast<uint32_t>(std::lround(full.x * scale))),
+                          std::max(1u, static_cast<uint32_t>(std::lround(full.y * scale))));
+    }
+
+} // namespace Nova::App::Rendering
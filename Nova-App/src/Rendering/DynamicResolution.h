@@ -0,0 +1,101 @@
+#ifndef DYNAMICRESOLUTION_H
+#define DYNAMICRESOLUTION_H
+
+#include <optional>
+#include <cstdint>
+#include <string_view>
+
+#include <glm/glm.hpp>
+
+#include "Profiling/Profiler.h"
+
+namespace Nova::App::Rendering {
+
+    struct DynamicResolutionSettings {
+        float m_TargetFrameMs{ 16.6f };
+        float m_MinScale{ 0.5f };     // per axis
+        float m_MaxScale{ 1.0f };
+        float m_Sharpness{ 0.5f };    // of the upscale filter, 0 = plain bilinear
+    };
+
+    struct DynamicResolutionStats {
+        float    m_FrameMs{ 0.0f };        // last sample
+        float    m_FilteredFrameMs{ 0.0f };
+        bool     m_GpuTimed{ false };      // false: CPU work time stands in for the GPU's
+        float    m_DisplayIntervalMs{ 0.0f };   // 0 when frames are not paced by the display
+        uint32_t m_ScaleChanges{ 0 };
+    };
+
+    // Render scale controller. Fed the frame time once per frame, it scales the viewport's render
+    // resolution down quickly when the frame is over budget and back up slowly when there is
+    // headroom. Scales are quantized, and after every change the frame time is measured afresh
+    // (skipping the frames in flight, which still ran at the old size), so the targets are not
+    // resized every frame. The frame time must not include waits on vsync, and a frame that fits in
+    // the display's refresh interval never scales down: it could not be presented any sooner.
+    class DynamicResolution {
+    public:
+        static constexpr float    k_ScaleStep = 0.05f;
+        static constexpr float    k_MaxScaleUp = 0.1f;     // per change
+        static constexpr float    k_Headroom = 0.85f;      // of the budget, needed before scaling up
+        static constexpr float    k_Smoothing = 0.2f;      // frame time filter weight
+        static constexpr uint32_t k_SettleFrames = 4;      // skipped after a change
+        static constexpr uint32_t k_MinSamples = 8;        // filtered before the next decision
+        static constexpr float    k_DisplaySlack = 1.05f;  // of the refresh interval, still counted as within it
+
+        void SetEnabled(bool enabled);
+        bool IsEnabled() const { return m_Enabled; }
+
+        void SetSettings(const DynamicResolutionSettings& settings);
+        const DynamicResolutionSettings& GetSettings() const { return m_Settings; }
+
+        // `displayIntervalMs`: the refresh interval when presents are paced by the display, else 0.
+        void Update(float frameMs, bool gpuTimed, float displayIntervalMs);
+
+        // 1 while disabled.
+        float GetScale() const { return m_Enabled ? m_Scale : 1.0f; }
+        // Size the scene renders at for a `viewportSize` panel; zero while the panel has no size.
+        glm::uvec2 GetRenderSize(const glm::vec2& viewportSize) const;
+
+        const DynamicResolutionStats& GetStats() const { return m_Stats; }
+
+    private:
+        DynamicResolutionSettings m_Settings;
+        DynamicResolutionStats m_Stats;
+        float    m_Scale{ 1.0f };
+        uint32_t m_SettleFrames{ 0 };
+        uint32_t m_Samples{ 0 };
+        bool     m_Enabled{ false };
+    };
+
+    // ---- GPU frame timing ----
+    // The scene frame is bracketed with its own timestamp zone, recorded whether the profiler is
+    // open or not. Renderers without timestamps report nothing.
+    inline constexpr const char* k_FrameTimingZone = "Frame";
+
+    template <typename Renderer>
+    void BeginGpuFrameTiming(Renderer& renderer) {
+        if constexpr (Profiling::GpuTimestampSupport<Renderer>)
+            renderer.BeginGpuZone(k_FrameTimingZone);
+    }
+
+    template <typename Renderer>
+    void EndGpuFrameTiming(Renderer& renderer) {
+        if constexpr (Profiling::GpuTimestampSupport<Renderer>)
+            renderer.EndGpuZone();
+    }
+
+    // GPU time of the most recent frame whose timestamps are resolved.
+    template <typename Renderer>
+    std::optional<float> ReadGpuFrameMs(Renderer& renderer) {
+        if constexpr (Profiling::GpuTimestampSupport<Renderer>) {
+            for (const auto& zone : renderer.GetGpuZones()) {
+                if (std::string_view(zone.m_Name) == k_FrameTimingZone)
+                    return static_cast<float>(zone.m_EndMs - zone.m_StartMs);
+            }
+        }
+        return std::nullopt;
+    }
+
+} // namespace Nova::App::Rendering
+
+#endif // DYNAMICRESOLUTION_H
@@ -0,0 +1,123 @@
+#include "Rendering/FramePacing.h"
+
+#include <algorithm>
+
+namespace Nova::App::Rendering {
+
+    namespace {
+
+        double ElapsedMs(FramePacer::Clock::time_point from, FramePacer::Clock::time_point to) {
+            return std::chrono::duration<double, std::milli>(to - from).count();
+        }
+
+    } // namespace
+
+    const char* GetPresentModeName(PresentMode mode) {
+        switch (mode) {
+            case PresentMode::Fifo:      return "FIFO";
+            case PresentMode::Mailbox:   return "Mailbox";
+            case PresentMode::Immediate: return "Immediate";
+        }
+        return "Unknown";
+    }
+
+    bool ParsePresentMode(std::string_view name, PresentMode& mode) {
+        if (name == "fifo")      { mode = PresentMode::Fifo; return true; }
+        if (name == "mailbox")   { mode = PresentMode::Mailbox; return true; }
+        if (name == "immediate") { mode = PresentMode::Immediate; return true; }
+        return false;
+    }
+
+    uint32_t GetVkPresentMode(PresentMode mode) {
+        switch (mode) {
+            case PresentMode::Immediate: return 0;   // VK_PRESENT_MODE_IMMEDIATE_KHR
+            case PresentMode::Mailbox:   return 1;   // VK_PRESENT_MODE_MAILBOX_KHR
+            case PresentMode::Fifo:      return 2;   // VK_PRESENT_MODE_FIFO_KHR
+        }
+        return 2;
+    }
+
+    void FramePacer::SetSettings(const FramePacingSettings& settings) {
+        const FramePacingSettings previous = m_Settings;
+        m_Settings = settings;
+        m_Settings.m_FramesInFlight = std::clamp(m_Settings.m_FramesInFlight, 1u, k_MaxFramesInFlight);
+        m_PresentModeDirty |= m_Settings.m_PresentMode != previous.m_PresentMode;
+        m_FramesInFlightDirty |= m_Settings.m_FramesInFlight != previous.m_FramesInFlight;
+    }
+
+    void FramePacer::SetFramesInFlight(uint32_t count) {
+        m_Stats.m_FramesInFlight = count;
+        m_Stats.m_FramesInFlightApplied = true;
+        // The renderer went idle: no recorded frame is still in flight.
+        m_Frames.fill({});
+    }
+
+    void FramePacer::OnFrameBegin(Clock::time_point waitStart, Clock::time_point waitEnd) {
+        ++m_Frame;
+        m_FrameWaitMs = ElapsedMs(waitStart, waitEnd);
+        m_WindowFenceWaitMs += m_FrameWaitMs;
+
+        // BeginFrame() reused the slot of the frame `frames in flight` back, so its fence has signaled.
+        const uint32_t inFlight = m_Stats.m_FramesInFlight;
+        if (m_Frame > inFlight) {
+            FrameRecord& retired = m_Frames[(m_Frame - inFlight) % m_Frames.size()];
+            if (retired.m_Sampled) {
+                const double latency = ElapsedMs(retired.m_InputSampled, waitEnd);
+                m_WindowRetireMs += latency;
+                m_WindowMaxRetireMs = std::max(m_WindowMaxRetireMs, latency);
+                ++m_WindowRetired;
+            }
+        }
+
+        m_Frames[m_Frame % m_Frames.size()] = {};
+    }
+
+    void FramePacer::OnInputSampled(Clock::time_point time) {
+        FrameRecord& frame = m_Frames[m_Frame % m_Frames.size()];
+        frame.m_InputSampled = time;
+        frame.m_Sampled = true;
+    }
+
+    void FramePacer::OnFramePresented(Clock::time_point presentStart, Clock::time_point time) {
+        // Work time is what the frame would take without vsync: the waits on the fence and on the
+        // swapchain are where a vsync-bound frame spends its slack.
+        if (m_LastPresent != Clock::time_point{}) {
+            const double interval = ElapsedMs(m_LastPresent, time);
+            const double blocked = m_FrameWaitMs + ElapsedMs(presentStart, time);
+            m_Stats.m_CpuWorkMs = static_cast<float>(std::max(interval - blocked, 0.0));
+
+            // A FIFO frame that blocked was paced by the display: its interval is a whole number of
+            // refresh intervals, the shortest of them one.
+            float& display = m_Stats.m_DisplayIntervalMs;
+            if (m_Settings.m_PresentMode != PresentMode::Fifo)
+                display = 0.0f;
+            else if (blocked > k_VsyncBlockedMs && (display == 0.0f || interval < display))
+                display = static_cast<float>(interval);
+        }
+        m_LastPresent = time;
+
+        ++m_WindowFrames;
+        if (const FrameRecord& frame = m_Frames[m_Frame % m_Frames.size()]; frame.m_Sampled) {
+            m_WindowSubmitMs += ElapsedMs(frame.m_InputSampled, time);
+            ++m_WindowSubmitted;
+        }
+
+        const double elapsed = std::chrono::duration<double>(time - m_WindowStart).count();
+        if (elapsed < 1.0)
+            return;
+
+        m_Stats.m_FramesPerSecond = static_cast<float>(m_WindowFrames / elapsed);
+        m_Stats.m_FenceWaitMs = static_cast<float>(m_WindowFenceWaitMs / std::max(m_WindowFrames, 1u));
+        if (m_WindowSubmitted > 0)
+            m_Stats.m_SampleToSubmitMs = static_cast<float>(m_WindowSubmitMs / m_WindowSubmitted);
+        if (m_WindowRetired > 0) {
+            m_Stats.m_SampleToRetireMs = static_cast<float>(m_WindowRetireMs / m_WindowRetired);
+            m_Stats.m_MaxSampleToRetireMs = static_cast<float>(m_WindowMaxRetireMs);
+        }
+
+        m_WindowStart = time;
+        m_WindowFrames = m_WindowSubmitted = m_WindowRetired = 0;
+        m_WindowSubmitMs = m_WindowRetireMs = m_WindowMaxRetireMs = m_WindowFenceWaitMs = 0.0;
+    }
+
+} // namespace Nova::App::Rendering
@@ -0,0 +1,148 @@
+#ifndef FRAMEPACING_H
+#define FRAMEPACING_H
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <concepts>
+#include <string_view>
+
+namespace Nova::App::Rendering {
+
+    enum class PresentMode : uint8_t {
+        Fifo,        // vsync, never tears; frames queue behind the display
+        Mailbox,     // vsync, the newest frame replaces a queued one
+        Immediate    // no vsync, may tear
+    };
+
+    const char* GetPresentModeName(PresentMode mode);
+    // "fifo", "mailbox" or "immediate"; false for anything else.
+    bool ParsePresentMode(std::string_view name, PresentMode& mode);
+    // The matching VkPresentModeKHR value, which is what the renderer hook takes.
+    uint32_t GetVkPresentMode(PresentMode mode);
+
+    // ---- Renderer support ----
+    // SetPresentMode() recreates the swapchain, falling back to FIFO when the surface lacks the
+    // mode. SetFramesInFlight() waits for the GPU to go idle before resizing its per-frame
+    // resources. Without the hooks, the present mode follows WindowDesc::m_VSync at startup and the
+    // renderer keeps its default frame count.
+    template <typename Renderer>
+    concept PresentModeSupport = requires(Renderer& renderer, uint32_t mode) {
+        renderer.SetPresentMode(mode);
+    };
+
+    template <typename Renderer>
+    concept FramesInFlightSupport = requires(Renderer& renderer, uint32_t count) {
+        renderer.SetFramesInFlight(count);
+    };
+
+    struct FramePacingSettings {
+        PresentMode m_PresentMode{ PresentMode::Fifo };
+        uint32_t    m_FramesInFlight{ 2 };
+        // Input is sampled after the renderer's BeginFrame() has waited on the frame fence, right
+        // before recording, instead of at the start of the update. Fewest frames in flight gives
+        // the lowest latency.
+        bool        m_LowLatency{ false };
+    };
+
+    struct FramePacingStats {
+        // Averages over the last second.
+        float m_SampleToSubmitMs{ 0.0f };   // input sampled -> EndFrame() returned, present queued
+        float m_SampleToRetireMs{ 0.0f };   // input sampled -> the frame's fence seen signaled
+        float m_MaxSampleToRetireMs{ 0.0f };
+        float m_FenceWaitMs{ 0.0f };        // blocked in BeginFrame()
+        float m_FramesPerSecond{ 0.0f };
+        // Last frame
+        float m_CpuWorkMs{ 0.0f };          // present to present, less the time blocked in BeginFrame() and EndFrame()
+        // Refresh interval: the shortest interval of the FIFO frames that blocked on the display since
+        // the present mode was applied. 0 in the other modes, whose frames are not paced by the display.
+        float m_DisplayIntervalMs{ 0.0f };
+
+        uint32_t m_FramesInFlight{ 2 };     // in effect
+        bool     m_PresentModeApplied{ false };    // false: set at startup only (WindowDesc::m_VSync)
+        bool     m_FramesInFlightApplied{ false }; // false: the renderer's default
+    };
+
+    // Frame pacing policy and latency measurement. The pipeline is timed per frame: when the frame
+    // sampled its input, when its present was submitted, and when its fence was seen signaled,
+    // which is when BeginFrame() of the frame that reuses its slot returns. The last is an upper
+    // bound on when the GPU finished it.
+    class FramePacer {
+    public:
+        using Clock = std::chrono::steady_clock;
+        static constexpr uint32_t k_MaxFramesInFlight = 3;
+        static constexpr uint32_t k_DefaultFramesInFlight = 2;   // Nova-Core renderers
+        static constexpr double   k_VsyncBlockedMs = 0.5;         // a frame blocked longer waited on the display
+
+        void SetSettings(const FramePacingSettings& settings);
+        const FramePacingSettings& GetSettings() const { return m_Settings; }
+        bool IsLowLatency() const { return m_Settings.m_LowLatency; }
+        uint32_t GetFramesInFlight() const { return m_Stats.m_FramesInFlight; }
+
+        // Before BeginFrame(): pushes changed settings to the renderer. Returns true when the frame
+        // count in effect changed.
+        template <typename Renderer>
+        bool Apply(Renderer& renderer);
+
+        // Frame pipeline, in this order each frame.
+        void OnFrameBegin(Clock::time_point waitStart, Clock::time_point waitEnd);
+        void OnInputSampled(Clock::time_point time);
+        // `presentStart`: when EndFrame() was called, `time`: when it returned.
+        void OnFramePresented(Clock::time_point presentStart, Clock::time_point time);
+
+        const FramePacingStats& GetStats() const { return m_Stats; }
+
+    private:
+        void SetFramesInFlight(uint32_t count);
+
+        struct FrameRecord {
+            Clock::time_point m_InputSampled{};
+            bool m_Sampled{ false };
+        };
+
+        FramePacingSettings m_Settings;
+        FramePacingStats m_Stats;
+        bool m_PresentModeDirty{ true };
+        bool m_FramesInFlightDirty{ true };
+
+        std::array<FrameRecord, k_MaxFramesInFlight + 1> m_Frames{};
+        uint64_t m_Frame{ 0 };
+        Clock::time_point m_LastPresent{};
+        double m_FrameWaitMs{ 0.0 };   // blocked in this frame's BeginFrame()
+
+        Clock::time_point m_WindowStart{ Clock::now() };
+        uint32_t m_WindowFrames{ 0 };
+        uint32_t m_WindowSubmitted{ 0 };
+        uint32_t m_WindowRetired{ 0 };
+        double   m_WindowSubmitMs{ 0.0 };
+        double   m_WindowRetireMs{ 0.0 };
+        double   m_WindowMaxRetireMs{ 0.0 };
+        double   m_WindowFenceWaitMs{ 0.0 };
+    };
+
+    template <typename Renderer>
+    bool FramePacer::Apply(Renderer& renderer) {
+        if (m_PresentModeDirty) {
+            m_PresentModeDirty = false;
+            if constexpr (PresentModeSupport<Renderer>) {
+                renderer.SetPresentMode(GetVkPresentMode(m_Settings.m_PresentMode));
+                m_Stats.m_PresentModeApplied = true;
+                m_Stats.m_DisplayIntervalMs = 0.0f;
+            }
+        }
+
+        if (!m_FramesInFlightDirty)
+            return false;
+        m_FramesInFlightDirty = false;
+
+        const uint32_t previous = m_Stats.m_FramesInFlight;
+        if constexpr (FramesInFlightSupport<Renderer>) {
+            renderer.SetFramesInFlight(m_Settings.m_FramesInFlight);
+            SetFramesInFlight(m_Settings.m_FramesInFlight);
+        }
+        return m_Stats.m_FramesInFlight != previous;
+    }
+
+} // namespace Nova::App::Rendering
+
+#endif // FRAMEPACING_H
@@ -0,0 +1,266 @@
+#include "Rendering/FrustumCulling.h"
+
+#include <bit>
+#include <cmath>
+
+#if defined(__AVX__)
+    #define NV_CULLING_AVX 1
+#endif
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define NV_CULLING_SSE 1
+#endif
+
+#if defined(NV_CULLING_AVX) || defined(NV_CULLING_SSE)
+    #include <immintrin.h>
+#endif
+
+namespace Nova::App::Rendering {
+
+    namespace {
+
+        // Plane coefficients split per component, with |n| precomputed for the extents projection.
+        struct PlaneSet {
+            float m_NX[6], m_NY[6], m_NZ[6], m_D[6];
+            float m_AbsNX[6], m_AbsNY[6], m_AbsNZ[6];
+        };
+
+        PlaneSet MakePlaneSet(const Frustum& frustum) {
+            PlaneSet set{};
+            for (int p = 0; p < 6; ++p) {
+                const glm::vec4& plane = frustum.m_Planes[p];
+                set.m_NX[p] = plane.x;
+                set.m_NY[p] = plane.y;
+                set.m_NZ[p] = plane.z;
+                set.m_D[p]  = plane.w;
+                set.m_AbsNX[p] = std::fabs(plane.x);
+                set.m_AbsNY[p] = std::fabs(plane.y);
+                set.m_AbsNZ[p] = std::fabs(plane.z);
+            }
+            return set;
+        }
+
+        // An AABB is outside when, for some plane, even its most positive corner is behind it:
+        // dot(n, c) + d + dot(|n|, e) < 0.
+        void CullScalar(const PlaneSet& planes, const WorldBoundsArray& bounds, size_t begin, size_t end, std::vector<uint32_t>& visible) {
+            const float* cx = bounds.CenterX();
+            const float* cy = bounds.CenterY();
+            const float* cz = bounds.CenterZ();
+            const float* ex = bounds.ExtentX();
+            const float* ey = bounds.ExtentY();
+            const float* ez = bounds.ExtentZ();
+
+            for (size_t i = begin; i < end; ++i) {
+                bool inside = true;
+                for (int p = 0; p < 6 && inside; ++p) {
+                    const float d = planes.m_NX[p] * cx[i] + planes.m_NY[p] * cy[i] + planes.m_NZ[p] * cz[i] + planes.m_D[p];
+                    const float r = planes.m_AbsNX[p] * ex[i] + planes.m_AbsNY[p] * ey[i] + planes.m_AbsNZ[p] * ez[i];
+                    inside = (d + r) >= 0.0f;
+                }
+                if (inside)
+                    visible.push_back(static_cast<uint32_t>(i));
+            }
+        }
+
+        void AppendMask(uint32_t mask, size_t base, std::vector<uint32_t>& visible) {
+            while (mask) {
+                visible.push_back(static_cast<uint32_t>(base + std::countr_zero(mask)));
+                mask &= mask - 1;
+            }
+        }
+
+#if defined(NV_CULLING_SSE)
+        size_t CullSSE(const PlaneSet& planes, const WorldBoundsArray& bounds, size_t begin, size_t end, std::vector<uint32_t>& visible) {
+            const size_t stop = begin + ((end - begin) & ~size_t(3));
+            const __m128 zero = _mm_setzero_ps();
+
+            for (size_t i = begin; i < stop; i += 4) {
+                const __m128 cx = _mm_loadu_ps(bounds.CenterX() + i);
+                const __m128 cy = _mm_loadu_ps(bounds.CenterY() + i);
+                const __m128 cz = _mm_loadu_ps(bounds.CenterZ() + i);
+                const __m128 ex = _mm_loadu_ps(bounds.ExtentX() + i);
+                const __m128 ey = _mm_loadu_ps(bounds.ExtentY() + i);
+                const __m128 ez = _mm_loadu_ps(bounds.ExtentZ() + i);
+
+                __m128 inside = _mm_castsi128_ps(_mm_set1_epi32(-1));
+                for (int p = 0; p < 6; ++p) {
+                    __m128 d = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(planes.m_NX[p]), cx), _mm_set1_ps(planes.m_D[p]));
+                    d = _mm_add_ps(d, _mm_mul_ps(_mm_set1_ps(planes.m_NY[p]), cy));
+                    d = _mm_add_ps(d, _mm_mul_ps(_mm_set1_ps(planes.m_NZ[p]), cz));
+
+                    __m128 r = _mm_mul_ps(_mm_set1_ps(planes.m_AbsNX[p]), ex);
+                    r = _mm_add_ps(r, _mm_mul_ps(_mm_set1_ps(planes.m_AbsNY[p]), ey));
+                    r = _mm_add_ps(r, _mm_mul_ps(_mm_set1_ps(planes.m_AbsNZ[p]), ez));
+
+                    inside = _mm_and_ps(inside, _mm_cmpge_ps(_mm_add_ps(d, r), zero));
+                }
+
+                AppendMask(static_cast<uint32_t>(_mm_movemask_ps(inside)), i, visible);
+            }
+            return stop;
+        }
+#endif
+
+#if defined(NV_CULLING_AVX)
+        size_t CullAVX(const PlaneSet& planes, const WorldBoundsArray& bounds, size_t begin, size_t end, std::vector<uint32_t>& visible) {
+            const size_t stop = begin + ((end - begin) & ~size_t(7));
+            const __m256 zero = _mm256_setzero_ps();
+
+            for (size_t i = begin; i < stop; i += 8) {
+                const __m256 cx = _mm256_loadu_ps(bounds.CenterX() + i);
+                const __m256 cy = _mm256_loadu_ps(bounds.CenterY() + i);
+                const __m256 cz = _mm256_loadu_ps(bounds.CenterZ() + i);
+                const __m256 ex = _mm256_loadu_ps(bounds.ExtentX() + i);
+                const __m256 ey = _mm256_loadu_ps(bounds.ExtentY() + i);
+                const __m256 ez = _mm256_loadu_ps(bounds.ExtentZ() + i);
+
+                __m256 inside = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+                for (int p = 0; p < 6; ++p) {
+                    __m256 d = _mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(planes.m_NX[p]), cx), _mm256_set1_ps(planes.m_D[p]));
+                    d = _mm256_add_ps(d, _mm256_mul_ps(_mm256_set1_ps(planes.m_NY[p]), cy));
+                    d = _mm256_add_ps(d, _mm256_mul_ps(_mm256_set1_ps(planes.m_NZ[p]), cz));
+
+                    __m256 r = _mm256_mul_ps(_mm256_set1_ps(planes.m_AbsNX[p]), ex);
+                    r = _mm256_add_ps(r, _mm256_mul_ps(_mm256_set1_ps(planes.m_AbsNY[p]), ey));
+                    r = _mm256_add_ps(r, _mm256_mul_ps(_mm256_set1_ps(planes.m_AbsNZ[p]), ez));
+
+                    inside = _mm256_and_ps(inside, _mm256_cmp_ps(_mm256_add_ps(d, r), zero, _CMP_GE_OQ));
+                }
+
+                AppendMask(static_cast<uint32_t>(_mm256_movemask_ps(inside)), i, visible);
+            }
+            return stop;
+        }
+#endif
+
+    } // namespace
+
+    Frustum Frustum::FromViewProjection(const glm::mat4& m) {
+        // Gribb/Hartmann: planes are sums/differences of the matrix rows (glm is column-major).
+        const glm::vec4 row0(m[0][0], m[1][0], m[2][0], m[3][0]);
+        const glm::vec4 row1(m[0][1], m[1][1], m[2][1], m[3][1]);
+        const glm::vec4 row2(m[0][2], m[1][2], m[2][2], m[3][2]);
+        const glm::vec4 row3(m[0][3], m[1][3], m[2][3], m[3][3]);
+
+        Frustum frustum;
+        frustum.m_Planes[0] = row3 + row0; // left
+        frustum.m_Planes[1] = row3 - row0; // right
+        frustum.m_Planes[2] = row3 + row1; // bottom
+        frustum.m_Planes[3] = row3 - row1; // top
+        frustum.m_Planes[4] = row3 + row2; // near (conservative for a [0, 1] depth range)
+        frustum.m_Planes[5] = row3 - row2; // far
+
+        for (auto& plane : frustum.m_Planes) {
+            const float length = glm::length(glm::vec3(plane));
+            if (length > 0.0f)
+                plane /= length;
+        }
+        return frustum;
+    }
+
+    void WorldBoundsArray::Clear() {
+        m_Entities.clear();
+        m_CenterX.clear(); m_CenterY.clear(); m_CenterZ.clear();
+        m_ExtentX.clear(); m_ExtentY.clear(); m_ExtentZ.clear();
+        m_Radius.clear();
+    }
+
+    void WorldBoundsArray::Reserve(size_t count) {
+        m_Entities.reserve(count);
+        m_CenterX.reserve(count); m_CenterY.reserve(count); m_CenterZ.reserve(count);
+        m_ExtentX.reserve(count); m_ExtentY.reserve(count); m_ExtentZ.reserve(count);
+        m_Radius.reserve(count);
+    }
+
+    uint32_t WorldBoundsArray::Add(entt::entity entity, const glm::mat4& transform, const MeshBounds& bounds) {
+        // Arvo: the world AABB of a transformed box has extents |M| * e around M * c.
+        const glm::vec3 center = glm::vec3(transform * glm::vec4(bounds.m_Center, 1.0f));
+        const glm::mat3 basis(transform);
+        const glm::vec3 extents =
+            glm::abs(basis[0]) * bounds.m_Extents.x +
+            glm::abs(basis[1]) * bounds.m_Extents.y +
+            glm::abs(basis[2]) * bounds.m_Extents.z;
+
+        const uint32_t index = static_cast<uint32_t>(m_Entities.size());
+        m_Entities.push_back(entity);
+        m_CenterX.push_back(center.x); m_CenterY.push_back(center.y); m_CenterZ.push_back(center.z);
+        m_ExtentX.push_back(extents.x); m_ExtentY.push_back(extents.y); m_ExtentZ.push_back(extents.z);
+        m_Radius.push_back(glm::length(extents));
+        return index;
+    }
+
+    CullingKernel GetBestCullingKernel() {
+#if defined(NV_CULLING_AVX)
+        return CullingKernel::AVX;
+#elif defined(NV_CULLING_SSE)
+        return CullingKernel::SSE;
+#else
+        return CullingKernel::Scalar;
+#endif
+    }
+
+    const char* GetCullingKernelName(CullingKernel kernel) {
+        switch (kernel) {
+            case CullingKernel::Scalar: return "Scalar";
+            case CullingKernel::SSE:    return "SSE";
+            case CullingKernel::AVX:    return "AVX";
+        }
+        return "Unknown";
+    }
+
+    void CullAABBs(const Frustum& frustum, const WorldBoundsArray& bounds, size_t begin, size_t end, std::vector<uint32_t>& visible, CullingKernel kernel) {
+        const PlaneSet planes = MakePlaneSet(frustum);
+
+        // The SIMD kernels handle whole lanes and return where they stopped; the scalar loop finishes the tail.
+        size_t done = begin;
+        switch (kernel) {
+#if defined(NV_CULLING_AVX)
+            case CullingKernel::AVX: done = CullAVX(planes, bounds, begin, end, visible); break;
+#endif
+#if defined(NV_CULLING_SSE)
+            case CullingKernel::SSE: done = CullSSE(planes, bounds, begin, end, visible); break;
+#endif
+            default: break;
+        }
+
+        CullScalar(planes, bounds, done, end, visible);
+    }
+
+    void CullAABBs(const Frustum& frustum, const WorldBoundsArray& bounds, std::vector<uint32_t>& visible, CullingKernel kernel) {
+        CullAABBs(frustum, bounds, 0, bounds.Size(), visible, kernel);
+    }
+
+    bool IsAABBVisible(const Frustum& frustum, const WorldBoundsArray& bounds, uint32_t index) {
+        const glm::vec3 center = bounds.GetCenter(index);
+        const glm::vec3 extents(bounds.ExtentX()[index], bounds.ExtentY()[index], bounds.ExtentZ()[index]);
+        for (const glm::vec4& plane : frustum.m_Planes) {
+            const glm::vec3 normal(plane);
+            if (glm::dot(normal, center) + plane.w + glm::dot(glm::abs(normal), extents) < 0.0f)
+                return false;
+        }
+        return true;
+    }
+
+    void CullAABBsParallel(const Frustum& frustum, const WorldBoundsArray& bounds, std::vector<uint32_t>& visible, Jobs::JobSystem& jobs) {
+        constexpr uint32_t k_ChunkSize = 16 * 1024;
+
+        const uint32_t count = static_cast<uint32_t>(bounds.Size());
+        if (count <= k_ChunkSize || jobs.GetThreadCount() <= 1) {
+            CullAABBs(frustum, bounds, visible);
+            return;
+        }
+
+        // One output list per chunk, concatenated in chunk order so the result matches the serial one.
+        const uint32_t chunkCount = (count + k_ChunkSize - 1) / k_ChunkSize;
+        // Sized here and captured by reference: every worker writes its own chunk's list.
+        std::vector<std::vector<uint32_t>> chunkVisible(chunkCount);
+
+        jobs.ParallelFor(count, k_ChunkSize, [&](uint32_t begin, uint32_t end) {
+            CullAABBs(frustum, bounds, begin, end, chunkVisible[begin / k_ChunkSize]);
+        });
+
+        for (const std::vector<uint32_t>& chunk : chunkVisible)
+            visible.insert(visible.end(), chunk.begin(), chunk.end());
+    }
+
+} // namespace Nova::App::Rendering
@@ -0,0 +1,82 @@
+#ifndef FRUSTUMCULLING_H
+#define FRUSTUMCULLING_H
+
+#include <array>
+#include <vector>
+#include <cstdint>
+
+#include <glm/glm.hpp>
+#include <entt/entt.hpp>
+
+#include "Rendering/MeshBounds.h"
+#include "Jobs/JobSystem.h"
+
+namespace Nova::App::Rendering {
+
+    // Six normalized planes (xyz = inward normal, w = distance), extracted from a view-projection matrix.
+    struct Frustum {
+        std::array<glm::vec4, 6> m_Planes{};
+
+        static Frustum FromViewProjection(const glm::mat4& viewProj);
+    };
+
+    // Packed SoA array of world-space bounds, one slot per renderable entity.
+    // Kept as separate float streams so the culling kernels load 4/8 objects per instruction.
+    class WorldBoundsArray {
+    public:
+        void Clear();
+        void Reserve(size_t count);
+
+        // Transforms the mesh bounds into world space and appends them. Returns the slot index.
+        uint32_t Add(entt::entity entity, const glm::mat4& transform, const MeshBounds& bounds);
+
+        size_t Size() const { return m_Entities.size(); }
+
+        entt::entity GetEntity(uint32_t index) const { return m_Entities[index]; }
+        glm::vec3 GetCenter(uint32_t index) const { return { m_CenterX[index], m_CenterY[index], m_CenterZ[index] }; }
+        float GetRadius(uint32_t index) const { return m_Radius[index]; }
+
+        const float* CenterX() const { return m_CenterX.data(); }
+        const float* CenterY() const { return m_CenterY.data(); }
+        const float* CenterZ() const { return m_CenterZ.data(); }
+        const float* ExtentX() const { return m_ExtentX.data(); }
+        const float* ExtentY() const { return m_ExtentY.data(); }
+        const float* ExtentZ() const { return m_ExtentZ.data(); }
+
+    private:
+        std::vector<entt::entity> m_Entities;
+
+        // World AABB (center/extents) and enclosing sphere radius around the same center.
+        std::vector<float> m_CenterX, m_CenterY, m_CenterZ;
+        std::vector<float> m_ExtentX, m_ExtentY, m_ExtentZ;
+        std::vector<float> m_Radius;
+    };
+
+    enum class CullingKernel : uint8_t {
+        Scalar = 0,
+        SSE,
+        AVX,
+    };
+
+    // Widest kernel compiled into this build (AVX requires NOVA_APP_ENABLE_AVX2).
+    CullingKernel GetBestCullingKernel();
+    const char* GetCullingKernelName(CullingKernel kernel);
+
+    // Tests every AABB against the frustum and appends the indices of the visible ones.
+    // Kernels that are not compiled into this build fall back to the scalar one.
+    void CullAABBs(const Frustum& frustum, const WorldBoundsArray& bounds, std::vector<uint32_t>& visible,
+                   CullingKernel kernel = GetBestCullingKernel());
+
+    // Same, restricted to the slots [begin, end).
+    void CullAABBs(const Frustum& frustum, const WorldBoundsArray& bounds, size_t begin, size_t end, std::vector<uint32_t>& visible,
+                   CullingKernel kernel = GetBestCullingKernel());
+
+    // Single-slot test, for the few objects culled outside the batch kernels.
+    bool IsAABBVisible(const Frustum& frustum, const WorldBoundsArray& bounds, uint32_t index);
+
+    // Splits large arrays into chunks culled on the job system; the output order matches CullAABBs.
+    void CullAABBsParallel(const Frustum& frustum, const WorldBoundsArray& bounds, std::vector<uint32_t>& visible, Jobs::JobSystem& jobs);
+
+} // namespace Nova::App::Rendering
+
+#endif // FRUSTUMCULLING_H
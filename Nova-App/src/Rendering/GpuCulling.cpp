@@ -0,0 +1,87 @@
+#include "Rendering/GpuCulling.h"
+
+#include <cstring>
+#include <memory>
+#include <algorithm>
+
+namespace Nova::App::Rendering {
+
+    void GpuCulling::BeginFrame() {
+        m_Objects.clear();
+        m_LODs.clear();
+        m_FirstLODOfMesh.clear();
+        m_BucketMeshes.clear();
+        m_BucketTable.clear();
+        m_BucketOfMesh.clear();
+
+        m_Stats.m_ObjectsUploaded = 0;
+        m_Stats.m_Ranges = 0;
+        m_Stats.m_BytesUploaded = 0;
+    }
+
+    uint32_t GpuCulling::AcquireBucket(const GPUMeshRef& mesh) {
+        auto [it, inserted] = m_BucketOfMesh.try_emplace(static_cast<const void*>(std::to_address(mesh)), static_cast<uint32_t>(m_BucketMeshes.size()));
+        if (inserted) {
+            m_BucketMeshes.push_back(mesh);
+            m_BucketTable.emplace_back();
+        }
+        return it->second;
+    }
+
+    void GpuCulling::AddObject(uint32_t draw, const WorldBoundsArray& bounds, uint32_t boundsIndex, float worldScale,
+                               const GPUMeshRef& mesh, uint32_t indexCount, const MeshLODChain* chain) {
+        // The levels of a mesh are shared by every object drawing it.
+        const uint32_t levelCount = chain ? static_cast<uint32_t>(chain->m_Levels.size()) : 1;
+        auto [it, inserted] = m_FirstLODOfMesh.try_emplace(static_cast<const void*>(std::to_address(mesh)), static_cast<uint32_t>(m_LODs.size()));
+        if (inserted) {
+            for (uint32_t level = 0; level < levelCount; ++level) {
+                GpuCullLOD& lod = m_LODs.emplace_back();
+                lod.m_Bucket = AcquireBucket(chain ? chain->m_Levels[level].m_Mesh : mesh);
+                lod.m_IndexCount = chain ? chain->m_Levels[level].m_IndexCount : indexCount;
+                lod.m_Error = chain ? chain->m_Levels[level].m_Error : 0.0f;
+            }
+        }
+
+        // Any of the levels may be selected: the object reserves a command in each of their buckets.
+        for (uint32_t level = 0; level < levelCount; ++level)
+            ++m_BucketTable[m_LODs[it->second + level].m_Bucket].m_Capacity;
+
+        GpuCullObject& object = m_Objects.emplace_back();
+        object.m_Center = bounds.GetCenter(boundsIndex);
+        object.m_Radius = bounds.GetRadius(boundsIndex);
+        object.m_Extents = { bounds.ExtentX()[boundsIndex], bounds.ExtentY()[boundsIndex], bounds.ExtentZ()[boundsIndex] };
+        object.m_WorldScale = worldScale;
+        object.m_Draw = draw;
+        object.m_FirstLOD = it->second;
+        object.m_LODCount = levelCount;
+    }
+
+    void GpuCulling::Prepare() {
+        m_CommandCount = 0;
+        for (GpuCullBucket& bucket : m_BucketTable) {
+            bucket.m_FirstCommand = m_CommandCount;
+            m_CommandCount += bucket.m_Capacity;
+        }
+        m_Counts.assign(m_BucketTable.size(), 0);
+
+        // Moving objects change their bounds every frame; static ones are not uploaded again.
+        m_DirtyObjects.clear();
+        const size_t common = std::min(m_Objects.size(), m_UploadedObjects.size());
+        for (uint32_t i = 0; i < common; ++i) {
+            if (std::memcmp(&m_Objects[i], &m_UploadedObjects[i], sizeof(GpuCullObject)) != 0)
+                m_DirtyObjects.push_back(i);
+        }
+        for (uint32_t i = static_cast<uint32_t>(common); i < m_Objects.size(); ++i)
+            m_DirtyObjects.push_back(i);
+
+        m_Stats.m_Objects = static_cast<uint32_t>(m_Objects.size());
+        m_Stats.m_Buckets = static_cast<uint32_t>(m_BucketTable.size());
+        m_Stats.m_LODs = static_cast<uint32_t>(m_LODs.size());
+        m_Stats.m_Commands = m_CommandCount;
+    }
+
+    void GpuCulling::Clear() {
+        *this = GpuCulling{};
+    }
+
+} // namespace Nova::App::Rendering
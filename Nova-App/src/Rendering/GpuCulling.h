@@ -0,0 +1,247 @@
+#ifndef GPUCULLING_H
+#define GPUCULLING_H
+
+#include <span>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <concepts>
+#include <unordered_map>
+
+#include <glm/glm.hpp>
+
+#include "Rendering/RHICompat.h"
+#include "Rendering/GpuScene.h"
+#include "Rendering/MeshLOD.h"
+#include "Rendering/FrustumCulling.h"
+
+namespace Nova::App::Rendering {
+
+    // ---- Renderer support ----
+    // GPU-driven submission on top of the bindless scene buffers (GpuScene.h). ReserveStorageBuffer()
+    // grows a storage buffer of the bindless set to at least `size` bytes without writing it.
+    // DispatchCulling() runs Resources/Editor/Shaders/Culling.slang over `objectCount` objects
+    // (64 per group) after the frame's buffer writes, outside any render pass, and makes its command
+    // and count writes visible to the indirect stage. DrawIndexedIndirectCount() binds cmd.m_Mesh and
+    // draws up to `maxDrawCount` commands read at byte `commandOffset` of the command buffer, their
+    // number read at byte `countOffset` of the count buffer. Like BindlessDrawSupport, a mismatch
+    // falls back to the CPU path unless NOVA_APP_REQUIRE_GPU_DRIVEN is on.
+    template <typename Renderer, typename Command>
+    concept GpuCullingSupport = BindlessDrawSupport<Renderer, Command>
+        && requires(Renderer& renderer, const Command& cmd, uint32_t binding, uint64_t size, uint32_t count) {
+            renderer.ReserveStorageBuffer(binding, size);
+            renderer.DispatchCulling(count);
+            renderer.DrawIndexedIndirectCount(cmd, size, size, count);
+        };
+
+    // Max-depth mip chain of the viewport depth, bound to the culling shader. BuildDepthPyramid()
+    // records its construction from the depth just rendered; without it occlusion culling is off.
+    template <typename Renderer>
+    concept DepthPyramidSupport = requires(Renderer& renderer) {
+        renderer.BuildDepthPyramid();
+    };
+
+    // Storage buffer bindings of the culling pass, after the GpuSceneBuffer ones in the bindless set.
+    enum class GpuCullingBuffer : uint32_t {
+        Params   = 5,
+        Objects  = 6,
+        LODs     = 7,
+        Buckets  = 8,
+        Commands = 9,
+        Counts   = 10,
+    };
+
+    namespace GpuCullingFlags {
+        constexpr uint32_t k_Frustum     = 1u << 0;
+        constexpr uint32_t k_Occlusion   = 1u << 1;
+        constexpr uint32_t k_LOD         = 1u << 2;
+        constexpr uint32_t k_Perspective = 1u << 3;
+    }
+
+    struct GpuCullingParams {
+        glm::vec4 m_Planes[6]{};
+        glm::mat4 m_OcclusionViewProj{ 1.0f };   // camera of the frame the depth pyramid was built from
+        glm::vec4 m_CameraPos{ 0.0f };           // xyz; w = near plane
+        float     m_PixelsPerUnit{ 0.0f };       // ProjectedPixelsPerUnit() at distance 1
+        float     m_LODThreshold{ MeshLODSelector::k_DefaultThresholdPixels };
+        uint32_t  m_ObjectCount{ 0 };
+        uint32_t  m_Flags{ 0 };
+    };
+    static_assert(sizeof(GpuCullingParams) % 16 == 0);
+
+    // Culling input of one object. Its draw id selects the transform and material in the GpuScene
+    // draw table and becomes the firstInstance of the command it is drawn with.
+    struct GpuCullObject {
+        glm::vec3 m_Center{ 0.0f };      // world AABB
+        float     m_Radius{ 0.0f };
+        glm::vec3 m_Extents{ 0.0f };
+        float     m_WorldScale{ 1.0f };
+        uint32_t  m_Draw{ 0 };
+        uint32_t  m_FirstLOD{ 0 };       // into the LOD table
+        uint32_t  m_LODCount{ 1 };
+        uint32_t  m_Padding{ 0 };
+    };
+    static_assert(sizeof(GpuCullObject) == 48);
+
+    // A level of a mesh: the bucket (mesh) its draws go to.
+    struct GpuCullLOD {
+        uint32_t m_Bucket{ 0 };
+        uint32_t m_IndexCount{ 0 };
+        float    m_Error{ 0.0f };        // object space, see MeshLODLevel
+        uint32_t m_Padding{ 0 };
+        bool operator==(const GpuCullLOD&) const = default;
+    };
+
+    // Commands [m_FirstCommand, m_FirstCommand + m_Capacity) of the command buffer, drawn with one mesh.
+    struct GpuCullBucket {
+        uint32_t m_FirstCommand{ 0 };
+        uint32_t m_Capacity{ 0 };        // objects that may select the mesh, so appends never overflow
+        bool operator==(const GpuCullBucket&) const = default;
+    };
+
+    // VkDrawIndexedIndirectCommand.
+    struct GpuDrawIndexedIndirect {
+        uint32_t m_IndexCount{ 0 };
+        uint32_t m_InstanceCount{ 0 };
+        uint32_t m_FirstIndex{ 0 };
+        int32_t  m_VertexOffset{ 0 };
+        uint32_t m_FirstInstance{ 0 };
+    };
+    static_assert(sizeof(GpuDrawIndexedIndirect) == 20);
+
+    struct GpuCullingStats {
+        uint32_t m_Objects{ 0 };
+        uint32_t m_Buckets{ 0 };
+        uint32_t m_LODs{ 0 };
+        uint32_t m_Commands{ 0 };            // command buffer capacity
+        // This frame
+        uint32_t m_ObjectsUploaded{ 0 };
+        uint32_t m_Ranges{ 0 };
+        uint64_t m_BytesUploaded{ 0 };
+        bool     m_Occlusion{ false };
+    };
+
+    // CPU side of GPU-driven culling. Objects are gathered each frame with their world bounds, draw id
+    // and LOD levels; the culling shader tests them against the frustum and, optionally, the previous
+    // frame's depth pyramid, picks a level as MeshLODSelector does (without hysteresis) and appends
+    // a command for the level's mesh into that mesh's bucket. Each bucket is then drawn with a single
+    // indirect-count draw, whatever the number of objects. Buffers are written where they changed.
+    class GpuCulling {
+    public:
+        static constexpr uint32_t k_GroupSize = 64;
+
+        void BeginFrame();
+
+        // `draw`: the object's GpuScene draw id. `chain` null draws `mesh` at full detail.
+        void AddObject(uint32_t draw, const WorldBoundsArray& bounds, uint32_t boundsIndex, float worldScale,
+                       const GPUMeshRef& mesh, uint32_t indexCount, const MeshLODChain* chain);
+
+        // Writes the changed buffers, resets the counts and records the culling dispatch. Returns false
+        // when the renderer has no GPU-driven support, in which case nothing was written.
+        template <typename Renderer, typename Command>
+        bool Dispatch(Renderer& renderer, GpuCullingParams params);
+
+        // Draws a bucket's surviving commands. `cmd` carries the bucket's mesh and draw state.
+        template <typename Renderer, typename Command>
+        void Draw(Renderer& renderer, const Command& cmd, uint32_t bucket) const;
+
+        // The mesh of each bucket.
+        const std::vector<GPUMeshRef>& GetBucketMeshes() const { return m_BucketMeshes; }
+        uint32_t GetObjectCount() const { return static_cast<uint32_t>(m_Objects.size()); }
+
+        void Clear();
+
+        const GpuCullingStats& GetStats() const { return m_Stats; }
+
+    private:
+        uint32_t AcquireBucket(const GPUMeshRef& mesh);
+        // Lays the buckets out in the command buffer and finds what changed since the last upload.
+        void Prepare();
+
+        std::vector<GpuCullObject> m_Objects;
+        std::vector<GpuCullObject> m_UploadedObjects;
+        std::vector<uint32_t>      m_DirtyObjects;
+
+        std::vector<GpuCullLOD> m_LODs;
+        std::vector<GpuCullLOD> m_UploadedLODs;
+        std::unordered_map<const void*, uint32_t> m_FirstLODOfMesh;   // full-detail mesh -> LOD table
+
+        std::vector<GPUMeshRef>    m_BucketMeshes;
+        std::vector<GpuCullBucket> m_BucketTable;
+        std::vector<GpuCullBucket> m_UploadedBucketTable;
+        std::unordered_map<const void*, uint32_t> m_BucketOfMesh;
+        std::vector<uint32_t> m_Counts;   // zeroes
+        uint32_t m_CommandCount{ 0 };
+
+        std::vector<GpuBufferRange> m_Ranges;   // scratch
+        GpuCullingStats m_Stats;
+    };
+
+    template <typename Renderer, typename Command>
+    bool GpuCulling::Dispatch(Renderer& renderer, GpuCullingParams params) {
+        if constexpr (GpuCullingSupport<Renderer, Command>) {
+            Prepare();
+
+            auto write = [&](GpuCullingBuffer buffer, auto data) {
+                renderer.UpdateStorageBuffer(static_cast<uint32_t>(buffer), 0, std::as_bytes(data));
+                m_Stats.m_BytesUploaded += data.size_bytes();
+                ++m_Stats.m_Ranges;
+            };
+
+            m_Stats.m_ObjectsUploaded = static_cast<uint32_t>(m_DirtyObjects.size());
+            MergeDirtyRanges(m_DirtyObjects, GpuScene::k_MergeGap, m_Ranges);
+            m_Stats.m_BytesUploaded += WriteBufferRanges(renderer, static_cast<uint32_t>(GpuCullingBuffer::Objects),
+                std::span<const GpuCullObject>(m_Objects), std::span<const GpuBufferRange>(m_Ranges));
+            m_Stats.m_Ranges += static_cast<uint32_t>(m_Ranges.size());
+            m_UploadedObjects.assign(m_Objects.begin(), m_Objects.end());
+
+            if (m_LODs != m_UploadedLODs) {
+                write(GpuCullingBuffer::LODs, std::span<const GpuCullLOD>(m_LODs));
+                m_UploadedLODs = m_LODs;
+            }
+            if (m_BucketTable != m_UploadedBucketTable) {
+                write(GpuCullingBuffer::Buckets, std::span<const GpuCullBucket>(m_BucketTable));
+                m_UploadedBucketTable = m_BucketTable;
+            }
+
+            renderer.ReserveStorageBuffer(static_cast<uint32_t>(GpuCullingBuffer::Commands), uint64_t(m_CommandCount) * sizeof(GpuDrawIndexedIndirect));
+            write(GpuCullingBuffer::Counts, std::span<const uint32_t>(m_Counts));
+
+            params.m_ObjectCount = static_cast<uint32_t>(m_Objects.size());
+            m_Stats.m_Occlusion = (params.m_Flags & GpuCullingFlags::k_Occlusion) != 0;
+            write(GpuCullingBuffer::Params, std::span<const GpuCullingParams>(&params, 1));
+
+            if (!m_Objects.empty())
+                renderer.DispatchCulling(params.m_ObjectCount);
+            return true;
+        }
+        else {
+            return false;
+        }
+    }
+
+    template <typename Renderer, typename Command>
+    void GpuCulling::Draw(Renderer& renderer, const Command& cmd, uint32_t bucket) const {
+        if constexpr (GpuCullingSupport<Renderer, Command>) {
+            const GpuCullBucket& range = m_BucketTable[bucket];
+            renderer.DrawIndexedIndirectCount(cmd, uint64_t(range.m_FirstCommand) * sizeof(GpuDrawIndexedIndirect),
+                uint64_t(bucket) * sizeof(uint32_t), range.m_Capacity);
+        }
+    }
+
+    // Records the depth pyramid build. Returns false when the renderer has none, in which case
+    // nothing was recorded.
+    template <typename Renderer>
+    bool BuildDepthPyramid(Renderer& renderer) {
+        if constexpr (DepthPyramidSupport<Renderer>) {
+            renderer.BuildDepthPyramid();
+            return true;
+        }
+        else {
+            return false;
+        }
+    }
+
+} // namespace Nova::App::Rendering
+
+#endif // GPUCULLING_H
@@ -0,0 +1,159 @@
+#include "Rendering/GpuScene.h"
+
+#include <cstring>
+#include <algorithm>
+
+namespace Nova::App::Rendering {
+
+    template <typename T>
+    uint32_t GpuScene::SlotTable<T>::Allocate(uint64_t frame) {
+        uint32_t slot;
+        if (!m_Free.empty()) {
+            slot = m_Free.back();
+            m_Free.pop_back();
+        }
+        else {
+            slot = static_cast<uint32_t>(m_Data.size());
+            m_Data.emplace_back();
+            m_LastUsed.push_back(0);
+            m_Dirty.push_back(0);
+        }
+        m_LastUsed[slot] = frame;
+        MarkDirty(slot);
+        return slot;
+    }
+
+    template <typename T>
+    void GpuScene::SlotTable<T>::MarkDirty(uint32_t slot) {
+        if (m_Dirty[slot])
+            return;
+        m_Dirty[slot] = 1;
+        m_DirtySlots.push_back(slot);
+    }
+
+    void GpuScene::BeginFrame() {
+        ++m_Frame;
+        m_Draws.clear();
+        m_Stats.m_TransformsUploaded = 0;
+        m_Stats.m_MaterialsUploaded = 0;
+        m_Stats.m_DrawsUploaded = 0;
+        m_Stats.m_Ranges = 0;
+        m_Stats.m_BytesUploaded = 0;
+    }
+
+    uint32_t GpuScene::AcquireTransform(entt::entity entity, const glm::mat4& transform) {
+        const size_t index = static_cast<size_t>(entt::to_entity(entity));
+        if (index >= m_SlotOfEntity.size())
+            m_SlotOfEntity.resize(index + 1, k_NoSlot);
+
+        uint32_t& slot = m_SlotOfEntity[index];
+        if (slot == k_NoSlot) {
+            slot = m_Transforms.Allocate(m_Frame);
+            if (slot >= m_EntityOfSlot.size())
+                m_EntityOfSlot.resize(slot + 1, entt::null);
+            m_EntityOfSlot[slot] = entity;
+            m_Transforms.m_Data[slot] = transform;
+            return slot;
+        }
+
+        m_Transforms.m_LastUsed[slot] = m_Frame;
+        glm::mat4& stored = m_Transforms.m_Data[slot];
+        if (std::memcmp(&stored, &transform, sizeof(glm::mat4)) != 0) {
+            stored = transform;
+            m_Transforms.MarkDirty(slot);
+        }
+        return slot;
+    }
+
+    uint32_t GpuScene::AcquireMaterial(const MaterialBlockComponent& material) {
+        // Content-addressed: a slot's data never changes, an edited material moves to another slot.
+        const auto [first, last] = m_SlotOfMaterial.equal_range(material.m_Hash);
+        for (auto it = first; it != last; ++it) {
+            if (MaterialBlocksEqual(m_Materials.m_Data[it->second].m_Block, material.m_Data)) {
+                m_Materials.m_LastUsed[it->second] = m_Frame;
+                return it->second;
+            }
+        }
+
+        const uint32_t slot = m_Materials.Allocate(m_Frame);
+        if (slot >= m_MaterialOfSlot.size())
+            m_MaterialOfSlot.resize(slot + 1, 0);
+        m_MaterialOfSlot[slot] = material.m_Hash;
+        m_Materials.m_Data[slot] = { material.m_Data, GpuMaterialTextures{} };
+        m_SlotOfMaterial.emplace(material.m_Hash, slot);
+        return slot;
+    }
+
+    uint32_t GpuScene::AddDraw(uint32_t transform, uint32_t material) {
+        m_Draws.push_back({ transform, material });
+        return static_cast<uint32_t>(m_Draws.size() - 1);
+    }
+
+    void GpuScene::RetireSlots() {
+        if (m_Frame <= k_RetireFrames)
+            return;
+        const uint64_t cutoff = m_Frame - k_RetireFrames;
+
+        // Freed slots keep their stale data until reused; no draw references them.
+        for (uint32_t slot = 0; slot < m_Transforms.m_LastUsed.size(); ++slot) {
+            const entt::entity entity = m_EntityOfSlot[slot];
+            if (entity == entt::null)
+                continue;
+            if (m_Transforms.m_LastUsed[slot] < cutoff) {
+                m_SlotOfEntity[static_cast<size_t>(entt::to_entity(entity))] = k_NoSlot;
+                m_EntityOfSlot[slot] = entt::null;
+                m_Transforms.m_Free.push_back(slot);
+            }
+        }
+
+        for (uint32_t slot = 0; slot < m_Materials.m_LastUsed.size(); ++slot) {
+            if (m_Materials.m_LastUsed[slot] == 0)
+                continue;
+            if (m_Materials.m_LastUsed[slot] < cutoff) {
+                const auto [first, last] = m_SlotOfMaterial.equal_range(m_MaterialOfSlot[slot]);
+                m_SlotOfMaterial.erase(std::find_if(first, last, [slot](const auto& entry) { return entry.second == slot; }));
+                m_Materials.m_LastUsed[slot] = 0;
+                m_Materials.m_Free.push_back(slot);
+            }
+        }
+    }
+
+    void MergeDirtyRanges(std::vector<uint32_t>& dirty, uint32_t mergeGap, std::vector<GpuBufferRange>& ranges) {
+        ranges.clear();
+        std::sort(dirty.begin(), dirty.end());
+        for (uint32_t index : dirty) {
+            if (!ranges.empty() && index <= ranges.back().m_End + mergeGap)
+                ranges.back().m_End = index + 1;
+            else
+                ranges.push_back({ index, index + 1 });
+        }
+        dirty.clear();
+    }
+
+    void GpuScene::BuildRanges(std::vector<uint32_t>& dirty, std::vector<uint8_t>* flags) {
+        if (flags) {
+            for (uint32_t index : dirty)
+                (*flags)[index] = 0;
+        }
+        MergeDirtyRanges(dirty, k_MergeGap, m_Ranges);
+    }
+
+    void GpuScene::DiffDraws() {
+        m_DirtyDraws.clear();
+        const size_t common = std::min(m_Draws.size(), m_UploadedDraws.size());
+        for (uint32_t i = 0; i < common; ++i) {
+            if (!(m_Draws[i] == m_UploadedDraws[i]))
+                m_DirtyDraws.push_back(i);
+        }
+        for (uint32_t i = static_cast<uint32_t>(common); i < m_Draws.size(); ++i)
+            m_DirtyDraws.push_back(i);
+        m_Stats.m_Draws = static_cast<uint32_t>(m_Draws.size());
+        m_Stats.m_Transforms = static_cast<uint32_t>(m_Transforms.m_Data.size() - m_Transforms.m_Free.size());
+        m_Stats.m_Materials = static_cast<uint32_t>(m_Materials.m_Data.size() - m_Materials.m_Free.size());
+    }
+
+    void GpuScene::Clear() {
+        *this = GpuScene{};
+    }
+
+} // namespace Nova::App::Rendering
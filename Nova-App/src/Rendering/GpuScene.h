@@ -0,0 +1,213 @@
+#ifndef GPUSCENE_H
+#define GPUSCENE_H
+
+#include <span>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <concepts>
+#include <type_traits>
+#include <unordered_map>
+
+#include <glm/glm.hpp>
+#include <entt/entt.hpp>
+
+#include "Rendering/MaterialBlock.h"
+
+namespace Nova::App::Rendering {
+
+    // ---- Renderer support ----
+    // Persistent storage buffers in the scene shader's bindless set (Resources/Editor/Shaders/Bindless.slang).
+    // UpdateStorageBuffer() writes a byte range, growing the buffer (contents kept) when the range
+    // ends past it; writes are ordered before the frame's draws. DrawIndexedBindless() draws
+    // `drawCount` instances starting at instance `firstDraw`: the shader's draw id is the instance
+    // index, which selects the transform and material through the draw table. A renderer whose
+    // hooks drift from these signatures silently loses bindless draws (Render Stats says so);
+    // NOVA_APP_REQUIRE_GPU_DRIVEN turns that into a build error (App/CoreHooks.cpp).
+    template <typename Renderer, typename Command>
+    concept BindlessDrawSupport = requires(Renderer& renderer, const Command& cmd, uint32_t binding, uint64_t offset,
+                                           std::span<const std::byte> bytes, uint32_t index) {
+        renderer.UpdateStorageBuffer(binding, offset, bytes);
+        renderer.DrawIndexedBindless(cmd, index, index);
+    };
+
+    // Storage buffer bindings of the bindless set.
+    enum class GpuSceneBuffer : uint32_t {
+        Materials  = 0,
+        Transforms = 1,
+        Draws      = 2,
+    };
+
+    // Bindless texture indices of a material; 0 samples the renderer's white texture. Materials
+    // carry no textures yet, so every index is 0 and the shader reads the factors alone.
+    struct alignas(16) GpuMaterialTextures {
+        uint32_t m_BaseColor{ 0 };
+        uint32_t m_Normal{ 0 };
+        uint32_t m_MetalRoughness{ 0 };
+        uint32_t m_Emission{ 0 };
+    };
+
+    struct GpuMaterialData {
+        MaterialBlockData   m_Block;
+        GpuMaterialTextures m_Textures;
+    };
+    static_assert(std::is_trivially_copyable_v<GpuMaterialData>);
+    static_assert(sizeof(GpuMaterialData) % 16 == 0);
+
+    // One per draw id.
+    struct GpuDrawData {
+        uint32_t m_Transform{ 0 };
+        uint32_t m_Material{ 0 };
+        bool operator==(const GpuDrawData&) const = default;
+    };
+    static_assert(sizeof(GpuDrawData) == 8);
+
+    // Elements [m_Begin, m_End) of a storage buffer.
+    struct GpuBufferRange {
+        uint32_t m_Begin{ 0 };
+        uint32_t m_End{ 0 };
+    };
+
+    // Sorts `dirty`, merges the indices at most `mergeGap` apart into `ranges` and clears `dirty`.
+    void MergeDirtyRanges(std::vector<uint32_t>& dirty, uint32_t mergeGap, std::vector<GpuBufferRange>& ranges);
+
+    // Writes the `ranges` of `data` to the storage buffer at `binding`. Returns the bytes written.
+    template <typename Renderer, typename T>
+    uint64_t WriteBufferRanges(Renderer& renderer, uint32_t binding, std::span<const T> data, std::span<const GpuBufferRange> ranges) {
+        uint64_t written = 0;
+        for (const GpuBufferRange& range : ranges) {
+            const auto bytes = std::as_bytes(data.subspan(range.m_Begin, range.m_End - range.m_Begin));
+            renderer.UpdateStorageBuffer(binding, uint64_t(range.m_Begin) * sizeof(T), bytes);
+            written += bytes.size();
+        }
+        return written;
+    }
+
+    struct GpuSceneStats {
+        uint32_t m_Transforms{ 0 };          // live slots
+        uint32_t m_Materials{ 0 };
+        uint32_t m_Draws{ 0 };
+        // This frame
+        uint32_t m_TransformsUploaded{ 0 };
+        uint32_t m_MaterialsUploaded{ 0 };
+        uint32_t m_DrawsUploaded{ 0 };
+        uint32_t m_Ranges{ 0 };              // UpdateStorageBuffer() calls
+        uint64_t m_BytesUploaded{ 0 };
+    };
+
+    // CPU mirror of the bindless scene buffers. World transforms keep a slot per entity and
+    // materials one per distinct content, both for as long as they are drawn (plus a grace period,
+    // so culled objects do not churn), and only changed slots are uploaded, coalesced into ranges.
+    // The draw table is rebuilt each frame in submission order and uploaded where it differs from
+    // the previous frame's. A draw then costs the renderer a mesh and a draw id.
+    class GpuScene {
+    public:
+        static constexpr uint64_t k_RetireFrames = 120;   // unused this long, a slot is freed
+        static constexpr uint32_t k_MergeGap = 4;         // dirty elements this close share a range
+
+        void BeginFrame();
+
+        // Slot of the entity's world matrix, marked for upload when it changed.
+        uint32_t AcquireTransform(entt::entity entity, const glm::mat4& transform);
+        // Slot of the material's content, shared by every material with the same block.
+        uint32_t AcquireMaterial(const MaterialBlockComponent& material);
+        // Draw id of the appended draw.
+        uint32_t AddDraw(uint32_t transform, uint32_t material);
+        uint32_t GetDrawCount() const { return static_cast<uint32_t>(m_Draws.size()); }
+
+        // Frees stale slots and writes the changed ranges. Returns false when the renderer has no
+        // bindless support, in which case nothing was written.
+        template <typename Renderer, typename Command>
+        bool Upload(Renderer& renderer);
+
+        void Clear();
+
+        const GpuSceneStats& GetStats() const { return m_Stats; }
+
+    private:
+        static constexpr uint32_t k_NoSlot = 0xFFFFFFFFu;
+
+        template <typename T>
+        struct SlotTable {
+            std::vector<T>        m_Data;
+            std::vector<uint64_t> m_LastUsed;
+            std::vector<uint8_t>  m_Dirty;
+            std::vector<uint32_t> m_DirtySlots;
+            std::vector<uint32_t> m_Free;
+
+            uint32_t Allocate(uint64_t frame);
+            void MarkDirty(uint32_t slot);
+        };
+
+        void RetireSlots();
+        // Merges `dirty` into ranges and clears it, with the elements' flags when given.
+        void BuildRanges(std::vector<uint32_t>& dirty, std::vector<uint8_t>* flags);
+        void DiffDraws();
+
+        template <typename Renderer, typename T>
+        void WriteRanges(Renderer& renderer, GpuSceneBuffer buffer, const std::vector<T>& data);
+
+        uint64_t m_Frame{ 0 };
+
+        SlotTable<glm::mat4>       m_Transforms;
+        std::vector<uint32_t>      m_SlotOfEntity;   // indexed by entt::to_entity
+        std::vector<entt::entity>  m_EntityOfSlot;
+        SlotTable<GpuMaterialData> m_Materials;
+        std::unordered_multimap<uint64_t, uint32_t> m_SlotOfMaterial;   // content hash -> slots, confirmed on content
+        std::vector<uint64_t>      m_MaterialOfSlot;
+
+        std::vector<GpuDrawData> m_Draws;
+        std::vector<GpuDrawData> m_UploadedDraws;
+        std::vector<uint32_t>    m_DirtyDraws;
+
+        std::vector<GpuBufferRange> m_Ranges;   // scratch
+        GpuSceneStats m_Stats;
+    };
+
+    template <typename Renderer, typename T>
+    void GpuScene::WriteRanges(Renderer& renderer, GpuSceneBuffer buffer, const std::vector<T>& data) {
+        m_Stats.m_BytesUploaded += WriteBufferRanges(renderer, static_cast<uint32_t>(buffer), std::span<const T>(data), std::span<const GpuBufferRange>(m_Ranges));
+        m_Stats.m_Ranges += static_cast<uint32_t>(m_Ranges.size());
+    }
+
+    template <typename Renderer, typename Command>
+    bool GpuScene::Upload(Renderer& renderer) {
+        if constexpr (BindlessDrawSupport<Renderer, Command>) {
+            RetireSlots();
+
+            m_Stats.m_MaterialsUploaded = static_cast<uint32_t>(m_Materials.m_DirtySlots.size());
+            BuildRanges(m_Materials.m_DirtySlots, &m_Materials.m_Dirty);
+            WriteRanges(renderer, GpuSceneBuffer::Materials, m_Materials.m_Data);
+
+            m_Stats.m_TransformsUploaded = static_cast<uint32_t>(m_Transforms.m_DirtySlots.size());
+            BuildRanges(m_Transforms.m_DirtySlots, &m_Transforms.m_Dirty);
+            WriteRanges(renderer, GpuSceneBuffer::Transforms, m_Transforms.m_Data);
+
+            DiffDraws();
+            m_Stats.m_DrawsUploaded = static_cast<uint32_t>(m_DirtyDraws.size());
+            BuildRanges(m_DirtyDraws, nullptr);
+            WriteRanges(renderer, GpuSceneBuffer::Draws, m_Draws);
+            m_UploadedDraws.assign(m_Draws.begin(), m_Draws.end());
+            return true;
+        }
+        else {
+            return false;
+        }
+    }
+
+    // Issues the draws [firstDraw, firstDraw + drawCount) of the uploaded draw table. Returns false
+    // when the renderer has no bindless support, in which case nothing was submitted.
+    template <typename Renderer, typename Command>
+    bool DrawBindless(Renderer& renderer, const Command& cmd, uint32_t firstDraw, uint32_t drawCount) {
+        if constexpr (BindlessDrawSupport<Renderer, Command>) {
+            renderer.DrawIndexedBindless(cmd, firstDraw, drawCount);
+            return true;
+        }
+        else {
+            return false;
+        }
+    }
+
+} // namespace Nova::App::Rendering
+
+#endif // GPUSCENE_H
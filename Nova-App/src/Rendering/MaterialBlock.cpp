@@ -0,0 +1,157 @@
+#include "Rendering/MaterialBlock.h"
+
+#include <cstring>
+
+#include "Common/Hash.h"
+
+namespace Nova::App::Rendering {
+
+    using Nova::Core::Renderer::RHI::Material;
+    using Nova::Core::Renderer::RHI::RHI_Shaders;
+    using Nova::Core::Scene::ECS::Components::MeshRendererComponent;
+
+    // Every Material field uploaded as a named shader parameter, in declaration order.
+    // isOpaque is handled separately because the shader expects it as an int.
+#define NV_MATERIAL_PARAMETERS(X) \
+    X(base) X(baseColor) X(diffuseRoughness) \
+    X(metalness) X(metalColor) \
+    X(specular) X(specularColor) X(specularRoughness) X(specularIOR) X(specularAnisotropy) X(specularRotation) \
+    X(transmission) X(transmissionColor) \
+    X(subsurface) X(subsurfaceColor) X(subsurfaceRadius) X(subsurfaceScale) X(subsurfaceAnisotropy) \
+    X(sheen) X(sheenColor) X(sheenRoughness) \
+    X(coat) X(coatColor) X(coatRoughness) X(coatAnisotropy) X(coatRotation) X(coatIOR) X(coatAffectColor) X(coatAffectRoughness) \
+    X(emission) X(emissionColor) \
+    X(opacity) X(thinWalled)
+
+    namespace {
+
+        glm::vec4 Slot(const glm::vec3& rgb, float a) {
+            return glm::vec4(rgb, a);
+        }
+
+    } // namespace
+
+    uint64_t HashMaterialBlock(const MaterialBlockData& data) {
+        return Fnv1aOf(data);
+    }
+
+    bool MaterialBlocksEqual(const MaterialBlockData& a, const MaterialBlockData& b) {
+        return std::memcmp(&a, &b, sizeof(MaterialBlockData)) == 0;
+    }
+
+    MaterialBlockData PackMaterial(const Material& m) {
+        MaterialBlockData d;
+        d.m_Base             = Slot(glm::vec3(m.baseColor), static_cast<float>(m.base));
+        d.m_Metal            = Slot(glm::vec3(m.metalColor), static_cast<float>(m.metalness));
+        d.m_Specular         = Slot(glm::vec3(m.specularColor), static_cast<float>(m.specular));
+        d.m_SpecularParams   = glm::vec4(m.specularRoughness, m.specularIOR, m.specularAnisotropy, m.specularRotation);
+        d.m_Transmission     = Slot(glm::vec3(m.transmissionColor), static_cast<float>(m.transmission));
+        d.m_Subsurface       = Slot(glm::vec3(m.subsurfaceColor), static_cast<float>(m.subsurface));
+        d.m_SubsurfaceRadius = Slot(glm::vec3(m.subsurfaceRadius), static_cast<float>(m.subsurfaceScale));
+        d.m_Sheen            = Slot(glm::vec3(m.sheenColor), static_cast<float>(m.sheen));
+        d.m_Coat             = Slot(glm::vec3(m.coatColor), static_cast<float>(m.coat));
+        d.m_CoatParams       = glm::vec4(m.coatRoughness, m.coatAnisotropy, m.coatRotation, m.coatIOR);
+        d.m_Lobes            = glm::vec4(m.coatAffectColor, m.coatAffectRoughness, m.subsurfaceAnisotropy, m.sheenRoughness);
+        d.m_Emission         = Slot(glm::vec3(m.emissionColor), static_cast<float>(m.emission));
+        d.m_Opacity          = Slot(glm::vec3(m.opacity), m.isOpaque ? 1.0f : 0.0f);
+        d.m_Surface          = glm::vec4(m.diffuseRoughness, static_cast<float>(m.thinWalled), 0.0f, 0.0f);
+        return d;
+    }
+
+    bool UpdateMaterialBlock(MaterialBlockComponent& block, const Material& material) {
+        const MaterialBlockData packed = PackMaterial(material);
+        if (block.m_Version != 0 && MaterialBlocksEqual(packed, block.m_Data))
+            return false;
+
+        block.m_Source = material;
+        block.m_Data = packed;
+        block.m_Hash = HashMaterialBlock(packed);
+        ++block.m_Version;
+        return true;
+    }
+
+    void MaterialBlockTracker::Connect(entt::registry& registry) {
+        Disconnect();
+        m_Registry = &registry;
+
+        registry.on_construct<MeshRendererComponent>().connect<&MaterialBlockTracker::OnChanged>(*this);
+        registry.on_update<MeshRendererComponent>().connect<&MaterialBlockTracker::OnChanged>(*this);
+        registry.on_destroy<MeshRendererComponent>().connect<&MaterialBlockTracker::OnChanged>(*this);
+
+        // Pick up whatever already exists in the registry.
+        m_AllDirty = true;
+    }
+
+    void MaterialBlockTracker::Disconnect() {
+        if (!m_Registry)
+            return;
+
+        m_Registry->on_construct<MeshRendererComponent>().disconnect(this);
+        m_Registry->on_update<MeshRendererComponent>().disconnect(this);
+        m_Registry->on_destroy<MeshRendererComponent>().disconnect(this);
+        m_Registry = nullptr;
+
+        m_Dirty.clear();
+        m_AllDirty = false;
+    }
+
+    void MaterialBlockTracker::OnChanged(entt::registry&, entt::entity entity) {
+        if (!m_AllDirty)
+            m_Dirty.push_back(entity);
+    }
+
+    uint32_t MaterialBlockTracker::Update() {
+        if (!m_Registry)
+            return 0;
+        entt::registry& registry = *m_Registry;
+
+        uint32_t updated = 0;
+        if (m_AllDirty) {
+            // Blocks left behind by removed renderers go with them.
+            for (const entt::entity entity : registry.view<MaterialBlockComponent>(entt::exclude<MeshRendererComponent>))
+                registry.remove<MaterialBlockComponent>(entity);
+
+            for (auto [entity, renderer] : registry.view<MeshRendererComponent>().each())
+                if (UpdateMaterialBlock(registry.get_or_emplace<MaterialBlockComponent>(entity), renderer.m_Material))
+                    ++updated;
+        }
+        else {
+            // An entity may be queued several times; repacking an up-to-date block is a no-op.
+            for (const entt::entity entity : m_Dirty) {
+                if (!registry.valid(entity))
+                    continue;
+                if (const auto* renderer = registry.try_get<MeshRendererComponent>(entity)) {
+                    if (UpdateMaterialBlock(registry.get_or_emplace<MaterialBlockComponent>(entity), renderer->m_Material))
+                        ++updated;
+                }
+                else {
+                    registry.remove<MaterialBlockComponent>(entity);
+                }
+            }
+        }
+
+        m_Dirty.clear();
+        m_AllDirty = false;
+        return updated;
+    }
+
+    void MaterialBinder::Bind(RHI_Shaders& shader, const MaterialBlockComponent& block, RenderStats& stats) {
+        if (m_HasBound && MaterialBlocksEqual(m_Bound, block.m_Data)) {
+            ++stats.m_MaterialBindsSkipped;
+            return;
+        }
+
+        const Material& m = block.m_Source;
+#define NV_UPLOAD_MATERIAL_PARAMETER(field) UploadParameter(shader, #field, m.field, stats);
+        NV_MATERIAL_PARAMETERS(NV_UPLOAD_MATERIAL_PARAMETER)
+#undef NV_UPLOAD_MATERIAL_PARAMETER
+        UploadParameter(shader, "isOpaque", static_cast<int>(m.isOpaque), stats);
+
+        m_Bound = block.m_Data;
+        m_HasBound = true;
+        ++stats.m_MaterialBinds;
+    }
+
+#undef NV_MATERIAL_PARAMETERS
+
+} // namespace Nova::App::Rendering
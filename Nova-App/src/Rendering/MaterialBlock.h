@@ -0,0 +1,107 @@
+#ifndef MATERIALBLOCK_H
+#define MATERIALBLOCK_H
+
+#include <vector>
+#include <cstdint>
+
+#include <glm/glm.hpp>
+#include <entt/entt.hpp>
+
+#include "Renderer/RHI/RHI_Shaders.h"
+#include "Scene/ECS/Components/MeshRendererComponent.h"
+
+#include "Rendering/RenderStats.h"
+
+namespace Nova::App::Rendering {
+
+    // std140-friendly packing of RHI::Material: every field lives in a vec4 slot,
+    // so the block can be compared with a single memcmp and uploaded as one range.
+    struct alignas(16) MaterialBlockData {
+        glm::vec4 m_Base{ 0.0f };             // rgb = baseColor,         a = base
+        glm::vec4 m_Metal{ 0.0f };            // rgb = metalColor,        a = metalness
+        glm::vec4 m_Specular{ 0.0f };         // rgb = specularColor,     a = specular
+        glm::vec4 m_SpecularParams{ 0.0f };   // roughness, IOR, anisotropy, rotation
+        glm::vec4 m_Transmission{ 0.0f };     // rgb = transmissionColor, a = transmission
+        glm::vec4 m_Subsurface{ 0.0f };       // rgb = subsurfaceColor,   a = subsurface
+        glm::vec4 m_SubsurfaceRadius{ 0.0f }; // rgb = subsurfaceRadius,  a = subsurfaceScale
+        glm::vec4 m_Sheen{ 0.0f };            // rgb = sheenColor,        a = sheen
+        glm::vec4 m_Coat{ 0.0f };             // rgb = coatColor,         a = coat
+        glm::vec4 m_CoatParams{ 0.0f };       // roughness, anisotropy, rotation, IOR
+        glm::vec4 m_Lobes{ 0.0f };            // coatAffectColor, coatAffectRoughness, subsurfaceAnisotropy, sheenRoughness
+        glm::vec4 m_Emission{ 0.0f };         // rgb = emissionColor,     a = emission
+        glm::vec4 m_Opacity{ 0.0f };          // rgb = opacity,           a = isOpaque
+        glm::vec4 m_Surface{ 0.0f };          // diffuseRoughness, thinWalled, 0, 0
+    };
+
+    // Per-entity material block, created lazily next to MeshRendererComponent.
+    // m_Source keeps the material with its original field types for the named-parameter upload.
+    struct MaterialBlockComponent {
+        Nova::Core::Renderer::RHI::Material m_Source{};
+        MaterialBlockData m_Data{};
+        uint64_t m_Hash{ 0 };      // content hash of m_Data, used to group draws sharing a material
+        uint32_t m_Version{ 0 };
+    };
+
+    // SetParameter wrapper that accounts the uploaded bytes in the frame stats.
+    template <typename T>
+    void UploadParameter(Nova::Core::Renderer::RHI::RHI_Shaders& shader, const char* name, const T& value, RenderStats& stats) {
+        shader.SetParameter(name, value);
+        stats.m_UniformBytesUploaded += sizeof(T);
+    }
+
+    uint64_t HashMaterialBlock(const MaterialBlockData& data);
+    // Content comparison backing every lookup by m_Hash: equal hashes do not imply equal blocks.
+    bool MaterialBlocksEqual(const MaterialBlockData& a, const MaterialBlockData& b);
+
+    MaterialBlockData PackMaterial(const Nova::Core::Renderer::RHI::Material& material);
+
+    // Repacks the material into the block. Returns true (and bumps m_Version) only when
+    // the packed content differs from what the block already holds.
+    bool UpdateMaterialBlock(MaterialBlockComponent& block, const Nova::Core::Renderer::RHI::Material& material);
+
+    // Keeps the MaterialBlockComponent of every MeshRendererComponent in step with its material.
+    // Registry signals on MeshRendererComponent queue the entity; Update() repacks only the queued
+    // blocks. Materials must therefore be modified through registry.patch/replace, or the entity
+    // flagged with MarkDirty (MarkAllDirty after writes that bypass signals, e.g. a snapshot restore).
+    class MaterialBlockTracker {
+    public:
+        MaterialBlockTracker() = default;
+        ~MaterialBlockTracker() { Disconnect(); }
+
+        MaterialBlockTracker(const MaterialBlockTracker&) = delete;
+        MaterialBlockTracker& operator=(const MaterialBlockTracker&) = delete;
+
+        void Connect(entt::registry& registry);
+        void Disconnect();
+
+        void MarkDirty(entt::entity entity) { m_Dirty.push_back(entity); }
+        void MarkAllDirty() { m_AllDirty = true; }
+
+        // Brings the queued blocks up to date. Returns how many changed content.
+        uint32_t Update();
+
+    private:
+        void OnChanged(entt::registry& registry, entt::entity entity);
+
+        entt::registry* m_Registry{ nullptr };
+        std::vector<entt::entity> m_Dirty;
+        bool m_AllDirty{ false };
+    };
+
+    // Remembers which block content is currently bound on the scene shader and skips
+    // the upload when the next draw uses an identical block.
+    class MaterialBinder {
+    public:
+        void Bind(Nova::Core::Renderer::RHI::RHI_Shaders& shader, const MaterialBlockComponent& block, RenderStats& stats);
+
+        // Forget the bound block (e.g. after the renderer or its shader has been recreated).
+        void Invalidate() { m_HasBound = false; }
+
+    private:
+        MaterialBlockData m_Bound{};
+        bool m_HasBound{ false };
+    };
+
+} // namespace Nova::App::Rendering
+
+#endif // MATERIALBLOCK_H
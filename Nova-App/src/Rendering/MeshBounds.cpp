@@ -0,0 +1,43 @@
+#include "Rendering/MeshBounds.h"
+
+#include <limits>
+#include <memory>
+
+namespace Nova::App::Rendering {
+
+    MeshBounds ComputeMeshBounds(const GPUMeshRef& mesh) {
+        MeshBounds bounds{};
+        if (!mesh)
+            return bounds;
+
+        const auto& vertices = mesh->GetVertices();
+        if (vertices.empty())
+            return bounds;
+
+        glm::vec3 min(std::numeric_limits<float>::max());
+        glm::vec3 max(std::numeric_limits<float>::lowest());
+        for (const auto& vertex : vertices) {
+            const glm::vec3 p = VertexPosition(vertex);
+            min = glm::min(min, p);
+            max = glm::max(max, p);
+        }
+
+        bounds.m_Center = 0.5f * (min + max);
+        bounds.m_Extents = 0.5f * (max - min);
+        bounds.m_Radius = glm::length(bounds.m_Extents);
+        return bounds;
+    }
+
+    const MeshBounds& MeshBoundsCache::Get(const GPUMeshRef& mesh) {
+        auto [it, inserted] = m_Bounds.try_emplace(std::to_address(mesh));
+        // Expired: the address belonged to a mesh released since.
+        if (inserted || it->second.m_Mesh.expired())
+            it->second = { mesh, ComputeMeshBounds(mesh) };
+        return it->second.m_Bounds;
+    }
+
+    void MeshBoundsCache::Prune() {
+        std::erase_if(m_Bounds, [](const auto& entry) { return entry.second.m_Mesh.expired(); });
+    }
+
+} // namespace Nova::App::Rendering
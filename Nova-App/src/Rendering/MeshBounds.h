@@ -0,0 +1,43 @@
+#ifndef MESHBOUNDS_H
+#define MESHBOUNDS_H
+
+#include <unordered_map>
+
+#include <glm/glm.hpp>
+
+#include "Rendering/RHICompat.h"
+
+namespace Nova::App::Rendering {
+
+    // Object-space bounding volumes of a mesh: AABB (center/extents) and enclosing sphere radius.
+    struct MeshBounds {
+        glm::vec3 m_Center{ 0.0f };
+        glm::vec3 m_Extents{ 0.0f };
+        float     m_Radius{ 0.0f };
+    };
+
+    MeshBounds ComputeMeshBounds(const GPUMeshRef& mesh);
+
+    // Bounds are computed once per GPU mesh from its vertex positions, then reused by every
+    // entity drawing that mesh. Entries of released meshes are recomputed if the address is reused
+    // and dropped by Prune().
+    class MeshBoundsCache {
+    public:
+        const MeshBounds& Get(const GPUMeshRef& mesh);
+        // Drops the entries of released meshes. Once per frame.
+        void Prune();
+        void Clear() { m_Bounds.clear(); }
+
+        size_t GetMeshCount() const { return m_Bounds.size(); }
+
+    private:
+        struct Entry {
+            GPUMeshWeakRef m_Mesh;
+            MeshBounds     m_Bounds;
+        };
+        std::unordered_map<const void*, Entry> m_Bounds;
+    };
+
+} // namespace Nova::App::Rendering
+
+#endif // MESHBOUNDS_H
@@ -0,0 +1,80 @@
+#include "Rendering/MeshLOD.h"
+
+#include <cmath>
+#include <memory>
+#include <algorithm>
+
+namespace Nova::App::Rendering {
+
+    MeshLODLibrary& MeshLODLibrary::Get() {
+        static MeshLODLibrary s_Instance;
+        return s_Instance;
+    }
+
+    void MeshLODLibrary::Register(const GPUMeshRef& mesh, MeshLODChain chain) {
+        if (!mesh || chain.m_Levels.size() < 2)
+            return;
+        chain.m_Levels.front().m_Mesh = mesh;
+        m_Chains.insert_or_assign(static_cast<const void*>(std::to_address(mesh)), std::move(chain));
+    }
+
+    const MeshLODChain* MeshLODLibrary::Find(const GPUMeshRef& mesh) const {
+        if (m_Chains.empty() || !mesh)
+            return nullptr;
+        auto it = m_Chains.find(static_cast<const void*>(std::to_address(mesh)));
+        return it != m_Chains.end() ? &it->second : nullptr;
+    }
+
+    void MeshLODLibrary::Prune() {
+        // The chain's own reference to its full-detail mesh is the last one.
+        std::erase_if(m_Chains, [](const auto& entry) { return entry.second.m_Levels.front().m_Mesh.use_count() <= 1; });
+    }
+
+    uint32_t MeshLODSelector::Select(entt::entity entity, const MeshLODChain& chain, float worldScale, float pixelsPerUnit) {
+        const auto& levels = chain.m_Levels;
+        const float scale = worldScale * pixelsPerUnit;
+
+        // Coarsest level within `threshold` pixels.
+        auto coarsest = [&](float threshold) {
+            uint32_t level = 0;
+            while (level + 1 < levels.size() && levels[level + 1].m_Error * scale <= threshold)
+                ++level;
+            return level;
+        };
+
+        const size_t slot = static_cast<size_t>(entt::to_entity(entity));
+        if (slot >= m_Levels.size())
+            m_Levels.resize(slot + 1);
+
+        // A recycled index is another entity: it starts without a previous level.
+        LevelState& state = m_Levels[slot];
+        if (state.m_Entity != entity)
+            state = { entity, 0 };
+
+        const uint32_t previous = std::min<uint32_t>(state.m_Level, static_cast<uint32_t>(levels.size() - 1));
+        uint32_t level = coarsest(m_ThresholdPixels);
+
+        // Coarser only once clearly under the threshold, finer only once clearly over it.
+        if (level > previous)
+            level = std::max(previous, coarsest(m_ThresholdPixels * (1.0f - m_Hysteresis)));
+        else if (level < previous && levels[previous].m_Error * scale <= m_ThresholdPixels * (1.0f + m_Hysteresis))
+            level = previous;
+
+        state.m_Level = static_cast<uint8_t>(level);
+        return level;
+    }
+
+    float MaxAxisScale(const glm::mat4& m) {
+        return std::sqrt(std::max({ glm::dot(glm::vec3(m[0]), glm::vec3(m[0])),
+            glm::dot(glm::vec3(m[1]), glm::vec3(m[1])), glm::dot(glm::vec3(m[2]), glm::vec3(m[2])) }));
+    }
+
+    float ProjectedPixelsPerUnit(const glm::mat4& projection, bool perspective, float viewportHeight, float distance) {
+        // projection[1][1] maps view-space y to NDC y (cot(fov / 2) for a perspective projection),
+        // negative when the projection flips Y for Vulkan clip space.
+        const float scale = std::abs(projection[1][1]);
+        const float ndcPerUnit = perspective ? scale / std::max(distance, 1e-4f) : scale;
+        return ndcPerUnit * 0.5f * viewportHeight;
+    }
+
+} // namespace Nova::App::Rendering
@@ -0,0 +1,141 @@
+#ifndef MESHLOD_H
+#define MESHLOD_H
+
+#include <span>
+#include <vector>
+#include <cstdint>
+#include <algorithm>
+#include <unordered_map>
+
+#include <entt/entt.hpp>
+#include <glm/glm.hpp>
+
+#include "Rendering/RHICompat.h"
+#include "Rendering/MeshSimplifier.h"
+
+namespace Nova::App::Rendering {
+
+    struct MeshLODSettings {
+        uint32_t m_MaxLevels{ 6 };           // including the full mesh
+        float    m_Reduction{ 0.5f };        // triangle count of a level relative to the previous one
+        float    m_MaxError{ 0.02f };        // per level, relative to the mesh bounding radius
+        uint32_t m_MinTriangles{ 64 };
+        float    m_MinReduction{ 0.85f };    // a level keeping more than this of the previous one ends the chain
+    };
+
+    // A simplified level in its own compact vertex/index arrays, as uploaded and cooked.
+    template <typename Vertex>
+    struct MeshLODBuffers {
+        std::vector<Vertex>   m_Vertices;
+        std::vector<uint32_t> m_Indices;
+        float m_Error{ 0.0f };   // object space, accumulated over the previous levels
+    };
+
+    // Simplified levels of a mesh (the full mesh itself excluded), each simplified from the previous one.
+    template <typename Vertex, typename Index>
+    std::vector<MeshLODBuffers<Vertex>> BuildMeshLODs(std::span<const Vertex> vertices, std::span<const Index> indices,
+                                                      float radius, const MeshLODSettings& settings = {}) {
+        std::vector<MeshLODBuffers<Vertex>> levels;
+        if (vertices.empty() || indices.size() < 3)
+            return levels;
+
+        std::vector<glm::vec3> positions;
+        positions.reserve(vertices.size());
+        for (const Vertex& vertex : vertices)
+            positions.push_back(VertexPosition(vertex));
+
+        std::vector<uint32_t> current(indices.begin(), indices.end());
+        float error = 0.0f;
+        std::vector<uint32_t> remap(vertices.size());
+
+        while (levels.size() + 1 < settings.m_MaxLevels && current.size() / 3 > settings.m_MinTriangles) {
+            const size_t target = std::max<size_t>(size_t(current.size() / 3 * settings.m_Reduction), settings.m_MinTriangles) * 3;
+            SimplifyResult simplified = SimplifyMesh(positions, current, target, settings.m_MaxError * radius);
+            if (simplified.m_Indices.empty() || simplified.m_Indices.size() > current.size() * settings.m_MinReduction)
+                break;
+
+            error += simplified.m_Error;
+            current = std::move(simplified.m_Indices);
+
+            // Only the vertices the level still references, in first-use order.
+            MeshLODBuffers<Vertex>& level = levels.emplace_back();
+            level.m_Error = error;
+            level.m_Indices.reserve(current.size());
+            std::fill(remap.begin(), remap.end(), 0xFFFFFFFFu);
+            for (const uint32_t index : current) {
+                if (remap[index] == 0xFFFFFFFFu) {
+                    remap[index] = static_cast<uint32_t>(level.m_Vertices.size());
+                    level.m_Vertices.push_back(vertices[index]);
+                }
+                level.m_Indices.push_back(remap[index]);
+            }
+        }
+        return levels;
+    }
+
+    struct MeshLODLevel {
+        GPUMeshRef m_Mesh{};
+        uint32_t   m_IndexCount{ 0 };
+        float      m_Error{ 0.0f };
+    };
+
+    // Level 0 is the full mesh.
+    struct MeshLODChain {
+        std::vector<MeshLODLevel> m_Levels;
+    };
+
+    // LOD chains of the loaded meshes, keyed by their full-detail GPU mesh. Filled by the asset
+    // streamer when a mesh with cooked levels is uploaded. A chain holds its level 0, so the address
+    // it is keyed by cannot be reused while it is registered; Prune() drops the chains no one else
+    // draws with any more, releasing their levels. Main thread only.
+    class MeshLODLibrary {
+    public:
+        static MeshLODLibrary& Get();
+
+        void Register(const GPUMeshRef& mesh, MeshLODChain chain);
+        // Null for meshes without simplified levels.
+        const MeshLODChain* Find(const GPUMeshRef& mesh) const;
+        // Once per frame.
+        void Prune();
+        void Clear() { m_Chains.clear(); }
+
+        size_t GetChainCount() const { return m_Chains.size(); }
+
+    private:
+        std::unordered_map<const void*, MeshLODChain> m_Chains;
+    };
+
+    // Picks the coarsest level whose error, projected on screen, stays under a pixel threshold.
+    // The level last chosen for an entity is kept within a hysteresis band around the threshold, so
+    // objects hovering at a switch distance do not flip levels every frame.
+    class MeshLODSelector {
+    public:
+        static constexpr float k_DefaultThresholdPixels = 1.0f;
+        static constexpr float k_DefaultHysteresis = 0.25f;
+
+        // `pixelsPerUnit`: screen pixels covered by one world unit at the object's distance.
+        uint32_t Select(entt::entity entity, const MeshLODChain& chain, float worldScale, float pixelsPerUnit);
+        void Clear() { m_Levels.clear(); }
+
+        void SetThreshold(float pixels) { m_ThresholdPixels = pixels; }
+        float GetThreshold() const      { return m_ThresholdPixels; }
+
+    private:
+        struct LevelState {
+            entt::entity m_Entity{ entt::null };   // version included
+            uint8_t      m_Level{ 0 };
+        };
+        std::vector<LevelState> m_Levels;   // by entity index
+        float m_ThresholdPixels{ k_DefaultThresholdPixels };
+        float m_Hysteresis{ k_DefaultHysteresis };
+    };
+
+    // Largest axis scale of a transform: what object-space LOD errors are multiplied by in world space.
+    float MaxAxisScale(const glm::mat4& transform);
+
+    // Pixels per world unit at `distance` along the view direction, for a viewport `viewportHeight` pixels tall.
+    float ProjectedPixelsPerUnit(const glm::mat4& projection, bool perspective, float viewportHeight, float distance);
+
+} // namespace Nova::App::Rendering
+
+#endif // MESHLOD_H
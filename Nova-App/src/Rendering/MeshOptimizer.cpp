@@ -0,0 +1,360 @@
+#include "Rendering/MeshOptimizer.h"
+
+#include <cmath>
+#include <array>
+#include <numeric>
+#include <algorithm>
+
+namespace Nova::App::Rendering {
+
+    namespace {
+
+        constexpr uint32_t k_None = 0xFFFFFFFFu;
+
+        // ---- Forsyth scoring ----
+        constexpr int   k_ScoreCacheSize = 32;
+        constexpr float k_LastTriangleScore = 0.75f;
+        constexpr float k_CacheDecayPower = 1.5f;
+        constexpr float k_ValenceBoostScale = 2.0f;
+        constexpr float k_ValenceBoostPower = 0.5f;
+
+        constexpr uint32_t k_ValenceTableSize = 32;
+
+        // pow() per rescored vertex dominates the optimizer otherwise.
+        struct ScoreTables {
+            float m_Cache[k_ScoreCacheSize + 1]{};   // by cache position + 1; [0] is "not cached"
+            float m_Valence[k_ValenceTableSize]{};
+
+            ScoreTables() {
+                for (int position = 0; position < k_ScoreCacheSize; ++position) {
+                    // The three vertices of the last triangle get a fixed score, so the next triangle
+                    // does not simply reuse its freshest edge.
+                    m_Cache[position + 1] = position < 3
+                        ? k_LastTriangleScore
+                        : std::pow(1.0f - float(position - 3) / float(k_ScoreCacheSize - 3), k_CacheDecayPower);
+                }
+                for (uint32_t valence = 1; valence < k_ValenceTableSize; ++valence)
+                    m_Valence[valence] = ValenceScore(valence);
+            }
+
+            // Vertices with few triangles left are finished first, so they leave the cache for good.
+            static float ValenceScore(uint32_t remainingTriangles) {
+                return k_ValenceBoostScale * std::pow(float(remainingTriangles), -k_ValenceBoostPower);
+            }
+        };
+
+        float VertexScore(const ScoreTables& tables, int cachePosition, uint32_t remainingTriangles) {
+            if (remainingTriangles == 0)
+                return -1.0f;
+            const float valence = remainingTriangles < k_ValenceTableSize ? tables.m_Valence[remainingTriangles] : ScoreTables::ValenceScore(remainingTriangles);
+            return tables.m_Cache[cachePosition + 1] + valence;
+        }
+
+        // FIFO post-transform cache, as on most hardware.
+        class FifoCache {
+        public:
+            FifoCache(size_t vertexCount, uint32_t size) : m_Stamps(vertexCount, 0), m_Size(size) {}
+
+            // True on a miss.
+            bool Access(uint32_t vertex) {
+                if (m_Stamps[vertex] != 0 && m_Time - m_Stamps[vertex] < m_Size)
+                    return false;
+                m_Stamps[vertex] = ++m_Time;
+                return true;
+            }
+
+            void Reset() { m_Time += m_Size + 1; }
+
+        private:
+            std::vector<uint32_t> m_Stamps;   // insertion time of each vertex
+            uint32_t m_Time{ 0 };
+            uint32_t m_Size;
+        };
+
+    } // namespace
+
+    void OptimizeVertexCache(std::span<uint32_t> indices, size_t vertexCount) {
+        const size_t triangleCount = indices.size() / 3;
+        if (triangleCount == 0 || vertexCount == 0)
+            return;
+
+        // Triangles of each vertex; the first remaining[v] of a vertex's list are still to be emitted.
+        std::vector<uint32_t> offsets(vertexCount + 1, 0);
+        for (size_t i = 0; i < triangleCount * 3; ++i)
+            ++offsets[indices[i] + 1];
+        std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+
+        std::vector<uint32_t> remaining(vertexCount);
+        for (size_t v = 0; v < vertexCount; ++v)
+            remaining[v] = offsets[v + 1] - offsets[v];
+
+        std::vector<uint32_t> adjacency(triangleCount * 3);
+        {
+            std::vector<uint32_t> fill(offsets.begin(), offsets.end() - 1);
+            for (size_t i = 0; i < triangleCount * 3; ++i)
+                adjacency[fill[indices[i]]++] = static_cast<uint32_t>(i / 3);
+        }
+
+        static const ScoreTables s_Tables;
+
+        std::vector<float> vertexScores(vertexCount);
+        for (size_t v = 0; v < vertexCount; ++v)
+            vertexScores[v] = VertexScore(s_Tables, -1, remaining[v]);
+
+        std::vector<float> triangleScores(triangleCount);
+        for (size_t t = 0; t < triangleCount; ++t)
+            triangleScores[t] = vertexScores[indices[t * 3]] + vertexScores[indices[t * 3 + 1]] + vertexScores[indices[t * 3 + 2]];
+
+        std::vector<uint8_t> emitted(triangleCount, 0);
+        std::vector<uint32_t> output;
+        output.reserve(triangleCount * 3);
+
+        std::array<uint32_t, k_ScoreCacheSize + 3> cache{};
+        size_t cacheCount = 0;
+        std::array<uint32_t, k_ScoreCacheSize + 3> nextCache{};
+
+        uint32_t best = k_None;
+        size_t scan = 0;   // fallback when nothing in the cache has triangles left
+
+        for (size_t emittedCount = 0; emittedCount < triangleCount; ++emittedCount) {
+            if (best == k_None) {
+                // A fresh start: the best triangle of the rest would need a full scan; the next
+                // unemitted one is good enough and keeps this linear.
+                while (scan < triangleCount && emitted[scan])
+                    ++scan;
+                best = static_cast<uint32_t>(scan);
+            }
+
+            const uint32_t triangle = best;
+            emitted[triangle] = 1;
+            const uint32_t* corners = &indices[size_t(triangle) * 3];
+
+            // Remove the triangle from its vertices' remaining lists.
+            for (int k = 0; k < 3; ++k) {
+                const uint32_t v = corners[k];
+                uint32_t* list = &adjacency[offsets[v]];
+                for (uint32_t i = 0; i < remaining[v]; ++i) {
+                    if (list[i] == triangle) {
+                        std::swap(list[i], list[remaining[v] - 1]);
+                        break;
+                    }
+                }
+                --remaining[v];
+                output.push_back(v);
+            }
+
+            // LRU update: the triangle's vertices move to the front.
+            size_t nextCount = 0;
+            for (int k = 0; k < 3; ++k)
+                nextCache[nextCount++] = corners[k];
+            for (size_t i = 0; i < cacheCount; ++i) {
+                const uint32_t v = cache[i];
+                if (v != corners[0] && v != corners[1] && v != corners[2])
+                    nextCache[nextCount++] = v;
+            }
+
+            // Rescore the cached vertices (and those just pushed out) and their pending triangles.
+            for (size_t i = 0; i < nextCount; ++i) {
+                const uint32_t v = nextCache[i];
+                const int position = i < k_ScoreCacheSize ? static_cast<int>(i) : -1;
+                const float score = VertexScore(s_Tables, position, remaining[v]);
+                const float delta = score - vertexScores[v];
+                vertexScores[v] = score;
+
+                for (uint32_t j = 0; j < remaining[v]; ++j)
+                    triangleScores[adjacency[offsets[v] + j]] += delta;
+            }
+
+            // The next triangle is the best one touching the cache.
+            best = k_None;
+            float bestScore = -1.0f;
+            for (size_t i = 0; i < std::min<size_t>(nextCount, k_ScoreCacheSize); ++i) {
+                const uint32_t v = nextCache[i];
+                for (uint32_t j = 0; j < remaining[v]; ++j) {
+                    const uint32_t t = adjacency[offsets[v] + j];
+                    if (triangleScores[t] > bestScore) {
+                        bestScore = triangleScores[t];
+                        best = t;
+                    }
+                }
+            }
+
+            cacheCount = std::min<size_t>(nextCount, k_ScoreCacheSize);
+            std::copy_n(nextCache.begin(), cacheCount, cache.begin());
+        }
+
+        std::copy(output.begin(), output.end(), indices.begin());
+    }
+
+    void OptimizeOverdraw(std::span<uint32_t> indices, std::span<const glm::vec3> positions, float threshold) {
+        const size_t triangleCount = indices.size() / 3;
+        if (triangleCount == 0 || positions.empty())
+            return;
+
+        constexpr uint32_t k_CacheSize = 16;
+
+        // Hard boundaries: triangles whose three vertices all miss the cache, where the cache
+        // optimizer effectively restarted. Moving whole clusters costs nothing there.
+        std::vector<uint32_t> hard;
+        {
+            FifoCache cache(positions.size(), k_CacheSize);
+            for (size_t t = 0; t < triangleCount; ++t) {
+                const int misses = cache.Access(indices[t * 3]) + cache.Access(indices[t * 3 + 1]) + cache.Access(indices[t * 3 + 2]);
+                if (t == 0 || misses == 3)
+                    hard.push_back(static_cast<uint32_t>(t));
+            }
+            hard.push_back(static_cast<uint32_t>(triangleCount));
+        }
+
+        // Soft boundaries: within a hard cluster, cut wherever the prefix's miss ratio is within
+        // `threshold` of the cluster's, so the cut cannot make the cluster much worse for the cache.
+        std::vector<uint32_t> clusters;
+        {
+            FifoCache cache(positions.size(), k_CacheSize);
+            for (size_t c = 0; c + 1 < hard.size(); ++c) {
+                const uint32_t begin = hard[c];
+                const uint32_t end = hard[c + 1];
+
+                cache.Reset();
+                uint32_t clusterMisses = 0;
+                for (uint32_t t = begin; t < end; ++t)
+                    clusterMisses += cache.Access(indices[t * 3]) + cache.Access(indices[t * 3 + 1]) + cache.Access(indices[t * 3 + 2]);
+                const float clusterACMR = float(clusterMisses) / float(end - begin);
+
+                cache.Reset();
+                clusters.push_back(begin);
+                uint32_t start = begin;
+                uint32_t misses = 0;
+                for (uint32_t t = begin; t < end; ++t) {
+                    misses += cache.Access(indices[t * 3]) + cache.Access(indices[t * 3 + 1]) + cache.Access(indices[t * 3 + 2]);
+                    const uint32_t count = t + 1 - start;
+                    if (t + 1 < end && float(misses) / float(count) <= threshold * clusterACMR) {
+                        clusters.push_back(t + 1);
+                        start = t + 1;
+                        misses = 0;
+                        cache.Reset();
+                    }
+                }
+            }
+            clusters.push_back(static_cast<uint32_t>(triangleCount));
+        }
+
+        glm::vec3 meshCenter(0.0f);
+        for (const glm::vec3& p : positions)
+            meshCenter += p;
+        meshCenter = meshCenter / float(positions.size());
+
+        // Clusters facing away from the mesh center are drawn first: they occlude the rest.
+        const size_t clusterCount = clusters.size() - 1;
+        std::vector<float> sortKeys(clusterCount);
+        for (size_t c = 0; c < clusterCount; ++c) {
+            glm::vec3 centroid(0.0f);
+            glm::vec3 normal(0.0f);
+            float area = 0.0f;
+            for (uint32_t t = clusters[c]; t < clusters[c + 1]; ++t) {
+                const glm::vec3& a = positions[indices[t * 3]];
+                const glm::vec3& b = positions[indices[t * 3 + 1]];
+                const glm::vec3& d = positions[indices[t * 3 + 2]];
+                const glm::vec3 cross = glm::cross(b - a, d - a);
+                const float weight = glm::length(cross);
+                centroid += (a + b + d) * (weight / 3.0f);
+                normal += cross;
+                area += weight;
+            }
+            const float normalLength = glm::length(normal);
+            if (area <= 0.0f || normalLength <= 0.0f) {
+                sortKeys[c] = 0.0f;
+                continue;
+            }
+            centroid = centroid / area;
+            sortKeys[c] = glm::dot(centroid - meshCenter, normal / normalLength);
+        }
+
+        std::vector<uint32_t> order(clusterCount);
+        std::iota(order.begin(), order.end(), 0u);
+        std::stable_sort(order.begin(), order.end(), [&](uint32_t a, uint32_t b) { return sortKeys[a] > sortKeys[b]; });
+
+        std::vector<uint32_t> output;
+        output.reserve(indices.size());
+        for (const uint32_t c : order)
+            output.insert(output.end(), indices.begin() + size_t(clusters[c]) * 3, indices.begin() + size_t(clusters[c + 1]) * 3);
+        std::copy(output.begin(), output.end(), indices.begin());
+    }
+
+    std::vector<uint32_t> OptimizeVertexFetchRemap(std::span<uint32_t> indices, size_t vertexCount) {
+        std::vector<uint32_t> remap(vertexCount, k_None);
+        std::vector<uint32_t> order;
+        order.reserve(vertexCount);
+        for (uint32_t& index : indices) {
+            if (remap[index] == k_None) {
+                remap[index] = static_cast<uint32_t>(order.size());
+                order.push_back(index);
+            }
+            index = remap[index];
+        }
+        return order;
+    }
+
+    size_t RemoveDegenerateTriangles(std::span<uint32_t> indices) {
+        size_t write = 0;
+        for (size_t t = 0; t + 2 < indices.size(); t += 3) {
+            const uint32_t a = indices[t], b = indices[t + 1], c = indices[t + 2];
+            if (a == b || b == c || a == c)
+                continue;
+            indices[write++] = a;
+            indices[write++] = b;
+            indices[write++] = c;
+        }
+        return write;
+    }
+
+    VertexCacheStats AnalyzeVertexCache(std::span<const uint32_t> indices, size_t vertexCount, uint32_t cacheSize) {
+        VertexCacheStats stats;
+        if (indices.size() < 3)
+            return stats;
+
+        FifoCache cache(vertexCount, cacheSize);
+        std::vector<uint8_t> used(vertexCount, 0);
+        size_t misses = 0;
+        size_t unique = 0;
+        for (const uint32_t index : indices) {
+            misses += cache.Access(index);
+            if (!used[index]) {
+                used[index] = 1;
+                ++unique;
+            }
+        }
+
+        stats.m_ACMR = float(misses) / float(indices.size() / 3);
+        stats.m_ATVR = float(misses) / float(unique);
+        return stats;
+    }
+
+    float AnalyzeVertexFetch(std::span<const uint32_t> indices, size_t vertexCount, size_t vertexStride) {
+        constexpr size_t k_LineSize = 64;
+        constexpr uint32_t k_Lines = 128;   // 8 KB of vertex data in flight
+
+        if (indices.empty() || vertexStride == 0)
+            return 0.0f;
+
+        const size_t lineCount = (vertexCount * vertexStride + k_LineSize - 1) / k_LineSize;
+        FifoCache lines(lineCount, k_Lines);
+        std::vector<uint8_t> used(vertexCount, 0);
+        size_t fetched = 0;
+        size_t referenced = 0;
+
+        for (const uint32_t index : indices) {
+            if (!used[index]) {
+                used[index] = 1;
+                referenced += vertexStride;
+            }
+            const size_t first = index * vertexStride / k_LineSize;
+            const size_t last = (index * vertexStride + vertexStride - 1) / k_LineSize;
+            for (size_t line = first; line <= last; ++line)
+                fetched += lines.Access(static_cast<uint32_t>(line)) ? k_LineSize : 0;
+        }
+
+        return float(fetched) / float(referenced);
+    }
+
+} // namespace Nova::App::Rendering
@@ -0,0 +1,69 @@
+#ifndef MESHOPTIMIZER_H
+#define MESHOPTIMIZER_H
+
+#include <span>
+#include <vector>
+#include <cstdint>
+
+#include <glm/glm.hpp>
+
+#include "Rendering/RHICompat.h"
+
+namespace Nova::App::Rendering {
+
+    // ---- Index order ----
+    // Reorders triangles for the post-transform vertex cache (Forsyth's linear-speed optimizer).
+    void OptimizeVertexCache(std::span<uint32_t> indices, size_t vertexCount);
+
+    // Reorders the clusters of a cache-optimized index buffer so outward-facing ones come first,
+    // which cuts overdraw, while keeping the cache miss ratio within `threshold` of the input's.
+    void OptimizeOverdraw(std::span<uint32_t> indices, std::span<const glm::vec3> positions, float threshold = 1.05f);
+
+    // ---- Vertex order ----
+    // Vertex order of first use by `indices`, which are rewritten to it. Returns, for each new
+    // vertex, the old vertex it comes from; unreferenced vertices are dropped.
+    std::vector<uint32_t> OptimizeVertexFetchRemap(std::span<uint32_t> indices, size_t vertexCount);
+
+    template <typename Vertex>
+    void OptimizeVertexFetch(std::vector<Vertex>& vertices, std::span<uint32_t> indices) {
+        const std::vector<uint32_t> order = OptimizeVertexFetchRemap(indices, vertices.size());
+        std::vector<Vertex> reordered;
+        reordered.reserve(order.size());
+        for (const uint32_t old : order)
+            reordered.push_back(vertices[old]);
+        vertices = std::move(reordered);
+    }
+
+    // Drops triangles with repeated vertices. Returns the new index count.
+    size_t RemoveDegenerateTriangles(std::span<uint32_t> indices);
+
+    // The whole cook-time pipeline: degenerate triangles dropped, then vertex cache, overdraw and
+    // vertex fetch order, in that order (each step keeps what the previous one gained).
+    template <typename Vertex>
+    void OptimizeMesh(std::vector<Vertex>& vertices, std::vector<uint32_t>& indices) {
+        indices.resize(RemoveDegenerateTriangles(indices));
+        OptimizeVertexCache(indices, vertices.size());
+
+        std::vector<glm::vec3> positions;
+        positions.reserve(vertices.size());
+        for (const Vertex& vertex : vertices)
+            positions.push_back(VertexPosition(vertex));
+        OptimizeOverdraw(indices, positions);
+
+        OptimizeVertexFetch(vertices, std::span<uint32_t>(indices));
+    }
+
+    // ---- Analysis ----
+    struct VertexCacheStats {
+        float m_ACMR{ 0.0f };   // vertex shader invocations per triangle (0.5 is the ideal for grids, 3 the worst)
+        float m_ATVR{ 0.0f };   // invocations per referenced vertex (1 is the ideal)
+    };
+    VertexCacheStats AnalyzeVertexCache(std::span<const uint32_t> indices, size_t vertexCount, uint32_t cacheSize = 16);
+
+    // Bytes fetched through 64-byte cache lines over the vertex buffer bytes actually referenced
+    // (1 is the ideal).
+    float AnalyzeVertexFetch(std::span<const uint32_t> indices, size_t vertexCount, size_t vertexStride);
+
+} // namespace Nova::App::Rendering
+
+#endif // MESHOPTIMIZER_H
@@ -0,0 +1,295 @@
+#include "Rendering/MeshSimplifier.h"
+
+#include <cmath>
+#include <numeric>
+#include <algorithm>
+
+namespace Nova::App::Rendering {
+
+    namespace {
+
+        constexpr uint32_t k_None = 0xFFFFFFFFu;
+
+        // Collapses turning a triangle by more than ~75 degrees are rejected.
+        constexpr float k_MaxNormalTurnCos = 0.25f;
+
+        // Sum of area-weighted squared distances to the planes of the triangles around a vertex.
+        struct Quadric {
+            double m_A00{ 0 }, m_A01{ 0 }, m_A02{ 0 }, m_A11{ 0 }, m_A12{ 0 }, m_A22{ 0 };
+            double m_B0{ 0 }, m_B1{ 0 }, m_B2{ 0 };
+            double m_C{ 0 };
+            double m_Weight{ 0 };
+
+            void Add(const Quadric& other) {
+                m_A00 += other.m_A00; m_A01 += other.m_A01; m_A02 += other.m_A02;
+                m_A11 += other.m_A11; m_A12 += other.m_A12; m_A22 += other.m_A22;
+                m_B0 += other.m_B0; m_B1 += other.m_B1; m_B2 += other.m_B2;
+                m_C += other.m_C;
+                m_Weight += other.m_Weight;
+            }
+
+            static Quadric FromPlane(const glm::dvec3& normal, double distance, double weight) {
+                Quadric q;
+                q.m_A00 = weight * normal.x * normal.x;
+                q.m_A01 = weight * normal.x * normal.y;
+                q.m_A02 = weight * normal.x * normal.z;
+                q.m_A11 = weight * normal.y * normal.y;
+                q.m_A12 = weight * normal.y * normal.z;
+                q.m_A22 = weight * normal.z * normal.z;
+                q.m_B0 = weight * normal.x * distance;
+                q.m_B1 = weight * normal.y * distance;
+                q.m_B2 = weight * normal.z * distance;
+                q.m_C = weight * distance * distance;
+                q.m_Weight = weight;
+                return q;
+            }
+        };
+
+        // Mean squared distance of `p` to the planes accumulated in `a` and `b`.
+        double Evaluate(const Quadric& a, const Quadric& b, const glm::vec3& point) {
+            Quadric q = a;
+            q.Add(b);
+            if (q.m_Weight <= 0.0)
+                return 0.0;
+
+            const double x = point.x, y = point.y, z = point.z;
+            const double error = q.m_A00 * x * x + q.m_A11 * y * y + q.m_A22 * z * z
+                + 2.0 * (q.m_A01 * x * y + q.m_A02 * x * z + q.m_A12 * y * z)
+                + 2.0 * (q.m_B0 * x + q.m_B1 * y + q.m_B2 * z)
+                + q.m_C;
+            return std::max(error, 0.0) / q.m_Weight;
+        }
+
+        glm::vec3 TriangleNormal(const glm::vec3& a, const glm::vec3& b, const glm::vec3& c) {
+            return glm::cross(b - a, c - a);
+        }
+
+        // Vertices sharing a position become one "position vertex": topology, quadrics and collapses
+        // work on those. Returns the position vertex of every vertex and how many vertices share it.
+        uint32_t WeldPositions(std::span<const glm::vec3> positions, std::vector<uint32_t>& remap, std::vector<uint32_t>& wedges) {
+            std::vector<uint32_t> order(positions.size());
+            std::iota(order.begin(), order.end(), 0u);
+            auto less = [&](uint32_t a, uint32_t b) {
+                const glm::vec3& pa = positions[a];
+                const glm::vec3& pb = positions[b];
+                if (pa.x != pb.x) return pa.x < pb.x;
+                if (pa.y != pb.y) return pa.y < pb.y;
+                return pa.z < pb.z;
+            };
+            std::sort(order.begin(), order.end(), less);
+
+            remap.assign(positions.size(), k_None);
+            wedges.clear();
+            uint32_t count = 0;
+            for (size_t i = 0; i < order.size(); ++i) {
+                if (i == 0 || positions[order[i]] != positions[order[i - 1]]) {
+                    ++count;
+                    wedges.push_back(0);
+                }
+                remap[order[i]] = count - 1;
+                ++wedges.back();
+            }
+            return count;
+        }
+
+        struct Collapse {
+            double m_Cost;
+            uint32_t m_From;   // position vertices
+            uint32_t m_To;
+        };
+
+    } // namespace
+
+    SimplifyResult SimplifyMesh(std::span<const glm::vec3> positions, std::span<const uint32_t> indices,
+                                size_t targetIndexCount, float maxError) {
+        SimplifyResult result;
+        result.m_Indices.assign(indices.begin(), indices.end());
+        if (indices.size() <= targetIndexCount || positions.empty())
+            return result;
+
+        std::vector<uint32_t> remap;
+        std::vector<uint32_t> wedges;
+        const uint32_t count = WeldPositions(positions, remap, wedges);
+
+        // Representative position of each position vertex.
+        std::vector<glm::vec3> points(count);
+        for (size_t v = 0; v < positions.size(); ++v)
+            points[remap[v]] = positions[v];
+
+        // Seams cannot move: the wedges on either side would need different targets.
+        std::vector<uint8_t> locked(count, 0);
+        for (uint32_t c = 0; c < count; ++c)
+            locked[c] = wedges[c] > 1 ? 1 : 0;
+
+        // Open and non-manifold edges pin their vertices, which keeps silhouettes and holes intact.
+        {
+            std::vector<uint64_t> edges;
+            edges.reserve(indices.size());
+            for (size_t t = 0; t + 2 < indices.size(); t += 3) {
+                for (int e = 0; e < 3; ++e) {
+                    const uint32_t a = remap[indices[t + e]];
+                    const uint32_t b = remap[indices[t + (e + 1) % 3]];
+                    edges.push_back((uint64_t(std::min(a, b)) << 32) | std::max(a, b));
+                }
+            }
+            std::sort(edges.begin(), edges.end());
+            for (size_t i = 0; i < edges.size();) {
+                size_t j = i;
+                while (j < edges.size() && edges[j] == edges[i])
+                    ++j;
+                if (j - i != 2) {
+                    locked[edges[i] >> 32] = 1;
+                    locked[edges[i] & 0xFFFFFFFFu] = 1;
+                }
+                i = j;
+            }
+        }
+
+        std::vector<Quadric> quadrics(count);
+        for (size_t t = 0; t + 2 < indices.size(); t += 3) {
+            const uint32_t c0 = remap[indices[t]], c1 = remap[indices[t + 1]], c2 = remap[indices[t + 2]];
+            const glm::dvec3 cross = glm::dvec3(TriangleNormal(points[c0], points[c1], points[c2]));
+            const double length = glm::length(cross);
+            if (length <= 0.0)
+                continue;
+
+            const glm::dvec3 normal = cross / length;
+            const Quadric plane = Quadric::FromPlane(normal, -glm::dot(normal, glm::dvec3(points[c0])), 0.5 * length);
+            quadrics[c0].Add(plane);
+            quadrics[c1].Add(plane);
+            quadrics[c2].Add(plane);
+        }
+
+        const double maxCost = double(maxError) * double(maxError);
+        const size_t targetTriangles = targetIndexCount / 3;
+        std::vector<uint32_t>& triangles = result.m_Indices;
+
+        std::vector<uint32_t> adjacencyOffsets;
+        std::vector<uint32_t> adjacency;
+        std::vector<uint64_t> edges;
+        std::vector<Collapse> collapses;
+        std::vector<uint8_t> touched;
+        std::vector<uint32_t> collapseTo(count, k_None);   // per position vertex: the vertex now used instead
+
+        // Each pass collapses the cheapest independent edges, then rewrites the triangles.
+        for (;;) {
+            const size_t triangleCount = triangles.size() / 3;
+            if (triangleCount <= targetTriangles)
+                break;
+
+            adjacencyOffsets.assign(count + 1, 0);
+            for (const uint32_t v : triangles)
+                ++adjacencyOffsets[remap[v] + 1];
+            std::partial_sum(adjacencyOffsets.begin(), adjacencyOffsets.end(), adjacencyOffsets.begin());
+            adjacency.resize(triangles.size());
+            {
+                std::vector<uint32_t> fill(adjacencyOffsets.begin(), adjacencyOffsets.end() - 1);
+                for (size_t i = 0; i < triangles.size(); ++i)
+                    adjacency[fill[remap[triangles[i]]]++] = static_cast<uint32_t>(i / 3);
+            }
+
+            edges.clear();
+            for (size_t t = 0; t < triangles.size(); t += 3) {
+                for (int e = 0; e < 3; ++e) {
+                    const uint32_t a = remap[triangles[t + e]];
+                    const uint32_t b = remap[triangles[t + (e + 1) % 3]];
+                    edges.push_back((uint64_t(std::min(a, b)) << 32) | std::max(a, b));
+                }
+            }
+            std::sort(edges.begin(), edges.end());
+            edges.erase(std::unique(edges.begin(), edges.end()), edges.end());
+
+            collapses.clear();
+            for (const uint64_t edge : edges) {
+                const uint32_t a = static_cast<uint32_t>(edge >> 32);
+                const uint32_t b = static_cast<uint32_t>(edge & 0xFFFFFFFFu);
+                const double costAB = locked[a] ? HUGE_VAL : Evaluate(quadrics[a], quadrics[b], points[b]);
+                const double costBA = locked[b] ? HUGE_VAL : Evaluate(quadrics[a], quadrics[b], points[a]);
+                if (costAB <= costBA && costAB <= maxCost)
+                    collapses.push_back({ costAB, a, b });
+                else if (costBA < costAB && costBA <= maxCost)
+                    collapses.push_back({ costBA, b, a });
+            }
+            std::sort(collapses.begin(), collapses.end(), [](const Collapse& x, const Collapse& y) { return x.m_Cost < y.m_Cost; });
+
+            touched.assign(count, 0);
+            size_t remaining = triangleCount;
+            uint32_t applied = 0;
+            for (const Collapse& collapse : collapses) {
+                if (remaining <= targetTriangles)
+                    break;
+                if (touched[collapse.m_From] || touched[collapse.m_To])
+                    continue;
+
+                // The triangles around `from` either contain the edge (and disappear) or get `from`
+                // moved onto `to`, which must not flip them.
+                uint32_t target = k_None;
+                size_t removed = 0;
+                bool valid = true;
+                for (uint32_t i = adjacencyOffsets[collapse.m_From]; i < adjacencyOffsets[collapse.m_From + 1] && valid; ++i) {
+                    const uint32_t* triangle = &triangles[size_t(adjacency[i]) * 3];
+                    glm::vec3 corners[3];
+                    glm::vec3 moved[3];
+                    bool hasTo = false;
+                    for (int k = 0; k < 3; ++k) {
+                        const uint32_t c = remap[triangle[k]];
+                        if (c == collapse.m_To) {
+                            hasTo = true;
+                            target = triangle[k];
+                        }
+                        corners[k] = points[c];
+                        moved[k] = c == collapse.m_From ? points[collapse.m_To] : points[c];
+                    }
+                    if (hasTo) {
+                        ++removed;
+                        continue;
+                    }
+
+                    const glm::vec3 before = TriangleNormal(corners[0], corners[1], corners[2]);
+                    const glm::vec3 after = TriangleNormal(moved[0], moved[1], moved[2]);
+                    valid = glm::dot(before, after) > k_MaxNormalTurnCos * glm::length(before) * glm::length(after);
+                }
+                if (!valid || target == k_None)
+                    continue;
+
+                collapseTo[collapse.m_From] = target;
+                quadrics[collapse.m_To].Add(quadrics[collapse.m_From]);
+
+                // Neighbours are frozen for the rest of the pass so the flip tests above stay exact.
+                for (uint32_t i = adjacencyOffsets[collapse.m_From]; i < adjacencyOffsets[collapse.m_From + 1]; ++i) {
+                    const uint32_t* triangle = &triangles[size_t(adjacency[i]) * 3];
+                    for (int k = 0; k < 3; ++k)
+                        touched[remap[triangle[k]]] = 1;
+                }
+
+                remaining -= removed;
+                result.m_Error = std::max(result.m_Error, static_cast<float>(std::sqrt(collapse.m_Cost)));
+                ++applied;
+            }
+
+            if (applied == 0)
+                break;
+
+            size_t write = 0;
+            for (size_t t = 0; t < triangles.size(); t += 3) {
+                uint32_t v[3];
+                for (int k = 0; k < 3; ++k) {
+                    v[k] = triangles[t + k];
+                    if (const uint32_t to = collapseTo[remap[v[k]]]; to != k_None)
+                        v[k] = to;
+                }
+                const uint32_t c0 = remap[v[0]], c1 = remap[v[1]], c2 = remap[v[2]];
+                if (c0 == c1 || c1 == c2 || c0 == c2)
+                    continue;
+                triangles[write++] = v[0];
+                triangles[write++] = v[1];
+                triangles[write++] = v[2];
+            }
+            triangles.resize(write);
+            std::fill(collapseTo.begin(), collapseTo.end(), k_None);
+        }
+
+        return result;
+    }
+
+} // namespace Nova::App::Rendering
@@ -0,0 +1,29 @@
+#ifndef MESHSIMPLIFIER_H
+#define MESHSIMPLIFIER_H
+
+#include <span>
+#include <vector>
+#include <cstdint>
+
+#include <glm/glm.hpp>
+
+namespace Nova::App::Rendering {
+
+    struct SimplifyResult {
+        std::vector<uint32_t> m_Indices;
+        float m_Error{ 0.0f };   // object-space distance the surface moved by, at most the requested bound
+    };
+
+    // Edge-collapse simplification of an indexed triangle list, ordered by quadric error.
+    //
+    // Vertices are only ever collapsed onto one another, so the result indexes the same vertex array.
+    // Vertices whose position is shared with another vertex (UV or normal seams) and vertices on open
+    // or non-manifold edges stay in place, as do collapses that would fold a triangle over.
+    // Stops once the index count is at most `targetIndexCount`, or when the next collapse would move
+    // the surface by more than `maxError`.
+    SimplifyResult SimplifyMesh(std::span<const glm::vec3> positions, std::span<const uint32_t> indices,
+                                size_t targetIndexCount, float maxError);
+
+} // namespace Nova::App::Rendering
+
+#endif // MESHSIMPLIFIER_H
@@ -0,0 +1,129 @@
+#include "Rendering/PipelineCache.h"
+
+#include <format>
+#include <fstream>
+#include <cstring>
+
+#include "Core/Log.h"
+#include "Common/Hash.h"
+
+namespace Nova::App::Rendering {
+
+    namespace fs = std::filesystem;
+
+    namespace {
+
+        constexpr const char* k_PipelineCacheFile = "Cache/Pipelines/PipelineCache.bin";
+        constexpr uint32_t k_FileMagic = 0x4C504E4E;   // "NNPL"
+        constexpr uint32_t k_FileVersion = 1;
+
+        // Our wrapper around the driver blob: the full identity, including the UUIDs the
+        // Vulkan header does not carry, and a checksum against truncated or corrupt files.
+        struct FileHeader {
+            uint32_t m_Magic{ k_FileMagic };
+            uint32_t m_Version{ k_FileVersion };
+            PipelineDeviceIdentity m_Identity{};
+            uint64_t m_BlobSize{ 0 };
+            uint64_t m_BlobHash{ 0 };
+        };
+
+        // VkPipelineCacheHeaderVersionOne, as laid out by the Vulkan specification.
+        struct VulkanCacheHeader {
+            uint32_t m_HeaderSize;
+            uint32_t m_HeaderVersion;   // VK_PIPELINE_CACHE_HEADER_VERSION_ONE
+            uint32_t m_VendorID;
+            uint32_t m_DeviceID;
+            uint8_t  m_PipelineCacheUUID[16];
+        };
+        static_assert(sizeof(VulkanCacheHeader) == 32);
+
+    } // namespace
+
+    fs::path GetPipelineCachePath() {
+        return k_PipelineCacheFile;
+    }
+
+    bool IsPipelineCacheBlobCompatible(std::span<const std::byte> blob, const PipelineDeviceIdentity& identity) {
+        if (blob.size() < sizeof(VulkanCacheHeader))
+            return false;
+
+        VulkanCacheHeader header{};
+        std::memcpy(&header, blob.data(), sizeof(header));
+
+        return header.m_HeaderSize >= sizeof(VulkanCacheHeader)
+            && header.m_HeaderVersion == 1
+            && header.m_VendorID == identity.m_VendorID
+            && header.m_DeviceID == identity.m_DeviceID
+            && std::memcmp(header.m_PipelineCacheUUID, identity.m_PipelineCacheUUID.data(), 16) == 0;
+    }
+
+    std::vector<std::byte> ReadPipelineCache(const fs::path& path, const PipelineDeviceIdentity& identity, std::string& status) {
+        std::error_code error;
+        const uint64_t fileSize = fs::file_size(path, error);
+        std::ifstream file(path, std::ios::binary);
+        if (error || !file) {
+            status = "cold: no cache file";
+            return {};
+        }
+
+        FileHeader header{};
+        file.read(reinterpret_cast<char*>(&header), sizeof(header));
+        if (!file || header.m_Magic != k_FileMagic || header.m_Version != k_FileVersion) {
+            status = "cold: unrecognized cache file";
+            return {};
+        }
+
+        if (!(header.m_Identity == identity)) {
+            status = "cold: written by another device or driver";
+            return {};
+        }
+
+        // Checked before sizing the allocation: a corrupt size must not ask for more than the file holds.
+        if (header.m_BlobSize > fileSize - sizeof(header)) {
+            status = "cold: cache file is corrupt";
+            return {};
+        }
+
+        std::vector<std::byte> blob(header.m_BlobSize);
+        file.read(reinterpret_cast<char*>(blob.data()), static_cast<std::streamsize>(blob.size()));
+        if (!file || Fnv1a(blob) != header.m_BlobHash) {
+            status = "cold: cache file is corrupt";
+            return {};
+        }
+
+        if (!IsPipelineCacheBlobCompatible(blob, identity)) {
+            status = "cold: driver blob header mismatch";
+            return {};
+        }
+
+        return blob;
+    }
+
+    bool WritePipelineCache(const fs::path& path, const PipelineDeviceIdentity& identity, std::span<const std::byte> blob) {
+        if (!IsPipelineCacheBlobCompatible(blob, identity))
+            return false;
+
+        std::error_code error;
+        fs::create_directories(path.parent_path(), error);
+
+        FileHeader header{};
+        header.m_Identity = identity;
+        header.m_BlobSize = blob.size();
+        header.m_BlobHash = Fnv1a(blob);
+
+        const fs::path temporary = path.string() + ".tmp";
+        {
+            std::ofstream file(temporary, std::ios::binary | std::ios::trunc);
+            file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+            file.write(reinterpret_cast<const char*>(blob.data()), static_cast<std::streamsize>(blob.size()));
+            if (!file) {
+                NV_LOG_ERROR(std::format("Cannot write pipeline cache '{}'", path.string()));
+                return false;
+            }
+        }
+
+        fs::rename(temporary, path, error);
+        return !error;
+    }
+
+} // namespace Nova::App::Rendering
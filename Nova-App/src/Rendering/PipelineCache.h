@@ -0,0 +1,111 @@
+#ifndef PIPELINECACHE_H
+#define PIPELINECACHE_H
+
+#include <span>
+#include <array>
+#include <chrono>
+#include <string>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <concepts>
+#include <filesystem>
+
+namespace Nova::App::Rendering {
+
+    // What a VkPipelineCache blob is only valid for: VkPhysicalDeviceProperties (vendor, device,
+    // driver version, pipelineCacheUUID) and VkPhysicalDeviceIDProperties (driver/device UUIDs).
+    struct PipelineDeviceIdentity {
+        uint32_t m_VendorID{ 0 };
+        uint32_t m_DeviceID{ 0 };
+        uint32_t m_DriverVersion{ 0 };
+        std::array<uint8_t, 16> m_PipelineCacheUUID{};
+        std::array<uint8_t, 16> m_DriverUUID{};
+        std::array<uint8_t, 16> m_DeviceUUID{};
+
+        bool operator==(const PipelineDeviceIdentity&) const = default;
+    };
+
+    struct PipelineCacheStats {
+        bool   m_Supported{ false };
+        bool   m_Warm{ false };          // a valid blob was loaded at startup
+        size_t m_LoadedBytes{ 0 };
+        size_t m_SavedBytes{ 0 };
+        double m_LoadMs{ 0.0 };
+        double m_SaveMs{ 0.0 };
+        std::string m_Status;            // why the cache is cold, or "warm"
+    };
+
+    // ---- Renderer support ----
+    // Vulkan-style device queries plus access to the renderer's VkPipelineCache: its serialized data
+    // (vkGetPipelineCacheData) and merging a previously saved blob into it (vkMergePipelineCaches).
+    template <typename Renderer>
+    concept PipelineCacheSupport = requires(Renderer& renderer, std::span<const std::byte> data) {
+        renderer.GetPhysicalDeviceProperties().pipelineCacheUUID;
+        renderer.GetPhysicalDeviceIDProperties().deviceUUID;
+        { renderer.GetPipelineCacheData() } -> std::convertible_to<std::vector<std::byte>>;
+        renderer.MergePipelineCacheData(data);
+    };
+
+    template <typename Properties, typename IDProperties>
+    PipelineDeviceIdentity MakePipelineDeviceIdentity(const Properties& properties, const IDProperties& ids) {
+        PipelineDeviceIdentity identity{};
+        identity.m_VendorID = properties.vendorID;
+        identity.m_DeviceID = properties.deviceID;
+        identity.m_DriverVersion = properties.driverVersion;
+        for (size_t i = 0; i < 16; ++i) {
+            identity.m_PipelineCacheUUID[i] = static_cast<uint8_t>(properties.pipelineCacheUUID[i]);
+            identity.m_DriverUUID[i] = static_cast<uint8_t>(ids.driverUUID[i]);
+            identity.m_DeviceUUID[i] = static_cast<uint8_t>(ids.deviceUUID[i]);
+        }
+        return identity;
+    }
+
+    std::filesystem::path GetPipelineCachePath();
+
+    // Checks the VkPipelineCacheHeaderVersionOne at the start of a blob against the device.
+    bool IsPipelineCacheBlobCompatible(std::span<const std::byte> blob, const PipelineDeviceIdentity& identity);
+
+    // Returns an empty blob (and the reason in `status`) when the file is missing, corrupt, or was
+    // written by another device or driver.
+    std::vector<std::byte> ReadPipelineCache(const std::filesystem::path& path, const PipelineDeviceIdentity& identity, std::string& status);
+    bool WritePipelineCache(const std::filesystem::path& path, const PipelineDeviceIdentity& identity, std::span<const std::byte> blob);
+
+    // Call once the renderer's device exists, before pipelines are created.
+    template <typename Renderer>
+    void LoadPipelineCache(Renderer& renderer, PipelineCacheStats& stats) {
+        if constexpr (PipelineCacheSupport<Renderer>) {
+            const auto start = std::chrono::steady_clock::now();
+            const auto identity = MakePipelineDeviceIdentity(renderer.GetPhysicalDeviceProperties(), renderer.GetPhysicalDeviceIDProperties());
+
+            stats.m_Supported = true;
+            const auto blob = ReadPipelineCache(GetPipelineCachePath(), identity, stats.m_Status);
+            if (!blob.empty()) {
+                renderer.MergePipelineCacheData(std::span<const std::byte>(blob));
+                stats.m_Warm = true;
+                stats.m_LoadedBytes = blob.size();
+                stats.m_Status = "warm";
+            }
+            stats.m_LoadMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        }
+        else {
+            stats.m_Status = "not supported by the renderer";
+        }
+    }
+
+    template <typename Renderer>
+    void SavePipelineCache(Renderer& renderer, PipelineCacheStats& stats) {
+        if constexpr (PipelineCacheSupport<Renderer>) {
+            const auto start = std::chrono::steady_clock::now();
+            const auto identity = MakePipelineDeviceIdentity(renderer.GetPhysicalDeviceProperties(), renderer.GetPhysicalDeviceIDProperties());
+            const std::vector<std::byte> blob = renderer.GetPipelineCacheData();
+
+            if (!blob.empty() && WritePipelineCache(GetPipelineCachePath(), identity, blob))
+                stats.m_SavedBytes = blob.size();
+            stats.m_SaveMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        }
+    }
+
+} // namespace Nova::App::Rendering
+
+#endif // PIPELINECACHE_H
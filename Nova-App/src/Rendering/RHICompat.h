@@ -0,0 +1,131 @@
+#ifndef RHICOMPAT_H
+#define RHICOMPAT_H
+
+#include <span>
+#include <memory>
+#include <cstdint>
+
+#include <glm/glm.hpp>
+
+#include "Renderer/RHI/RHI_Renderer.h"
+
+// Optional RHI features used by the app-side renderer.
+// Nova-Core is tracked as a submodule and its backends do not all expose the same entry points,
+// so features are detected at compile time and callers fall back to the baseline path.
+
+namespace Nova::App::Rendering {
+
+    using GPUMeshRef = decltype(Nova::Core::Renderer::RHI::RHI_DrawIndexedCommand::m_Mesh);
+    // Per-mesh caches are keyed by the mesh address and keep one of these to tell the mesh they
+    // were filled for from a later one allocated at the same address: it expires with the mesh.
+    using GPUMeshWeakRef = std::weak_ptr<typename GPUMeshRef::element_type>;
+
+    // ---- Vertex access ----
+    template <typename Vertex>
+    glm::vec3 VertexPosition(const Vertex& vertex) {
+        if constexpr (requires { vertex.m_Position; })
+            return glm::vec3(vertex.m_Position);
+        else
+            return glm::vec3(vertex.position);
+    }
+
+    template <typename Vertex>
+    glm::vec3 VertexNormal(const Vertex& vertex) {
+        if constexpr (requires { vertex.m_Normal; })
+            return glm::vec3(vertex.m_Normal);
+        else if constexpr (requires { vertex.normal; })
+            return glm::vec3(vertex.normal);
+        else
+            return glm::vec3(0.0f, 0.0f, 1.0f);
+    }
+
+    template <typename Vertex>
+    glm::vec2 VertexUV(const Vertex& vertex) {
+        if constexpr (requires { vertex.m_UV; })
+            return glm::vec2(vertex.m_UV);
+        else if constexpr (requires { vertex.uv; })
+            return glm::vec2(vertex.uv);
+        else
+            return glm::vec2(0.0f);
+    }
+
+    // ---- Instancing ----
+    // Per-instance model matrices uploaded into the renderer's instance buffer, consumed by
+    // an RHI_DrawIndexedCommand with m_InstanceCount > 1 when u_UseInstancing is set.
+    template <typename Renderer, typename Command>
+    concept InstancedDrawSupport = requires(Renderer& renderer, Command& cmd, std::span<const glm::mat4> transforms) {
+        cmd.m_InstanceCount = uint32_t{ 1 };
+        renderer.SetInstanceTransforms(transforms);
+    };
+
+    // Issues one instanced draw for `transforms`. Returns false when the renderer has no
+    // instancing support, in which case nothing was submitted.
+    template <typename Renderer, typename Command>
+    bool DrawInstanced(Renderer& renderer, Command cmd, std::span<const glm::mat4> transforms) {
+        if constexpr (InstancedDrawSupport<Renderer, Command>) {
+            renderer.SetInstanceTransforms(transforms);
+            cmd.m_InstanceCount = static_cast<uint32_t>(transforms.size());
+            renderer.DrawIndexed(cmd);
+            return true;
+        }
+        else {
+            return false;
+        }
+    }
+
+    // ---- Render scale ----
+    // The scene is rendered into an internal target of SetViewportRenderSize() and UpscaleViewport()
+    // resamples it into the viewport texture (sharpened bilinear, Resources/Editor/Shaders/Upscale.frag.slang).
+    // At the viewport's own size the scene goes straight to the viewport texture.
+    template <typename Renderer>
+    concept ViewportUpscaleSupport = requires(Renderer& renderer, uint32_t size, float sharpness) {
+        renderer.SetViewportRenderSize(size, size);
+        renderer.UpscaleViewport(sharpness);
+    };
+
+    // Returns false when the renderer has no upscale hook, in which case nothing was changed.
+    template <typename Renderer>
+    bool SetViewportRenderSize(Renderer& renderer, uint32_t width, uint32_t height) {
+        if constexpr (ViewportUpscaleSupport<Renderer>) {
+            renderer.SetViewportRenderSize(width, height);
+            return true;
+        }
+        else {
+            return false;
+        }
+    }
+
+    template <typename Renderer>
+    bool UpscaleViewport(Renderer& renderer, float sharpness) {
+        if constexpr (ViewportUpscaleSupport<Renderer>) {
+            renderer.UpscaleViewport(sharpness);
+            return true;
+        }
+        else {
+            return false;
+        }
+    }
+
+    // ---- Render target barriers ----
+    // Layout transitions of the viewport targets recorded by the app (see RenderGraph). Renderers
+    // without the hook transition them inside BeginFrame() and PrepareForImGui().
+    template <typename Renderer>
+    concept ViewportBarrierSupport = requires(Renderer& renderer, bool depth, uint32_t layout) {
+        renderer.TransitionViewportImage(depth, layout, layout);
+    };
+
+    // Returns false when the renderer has no hook, in which case nothing was recorded.
+    template <typename Renderer>
+    bool TransitionViewportImage(Renderer& renderer, bool depth, uint32_t oldLayout, uint32_t newLayout) {
+        if constexpr (ViewportBarrierSupport<Renderer>) {
+            renderer.TransitionViewportImage(depth, oldLayout, newLayout);
+            return true;
+        }
+        else {
+            return false;
+        }
+    }
+
+} // namespace Nova::App::Rendering
+
+#endif // RHICOMPAT_H
@@ -0,0 +1,52 @@
+#include "Rendering/RadixSort.h"
+
+#include <array>
+#include <cstddef>
+#include <utility>
+
+namespace Nova::App::Rendering {
+
+    void RadixSort(std::vector<SortEntry>& entries, std::vector<SortEntry>& scratch) {
+        constexpr uint32_t k_Digits = sizeof(uint64_t);
+
+        const size_t count = entries.size();
+        if (count < 2)
+            return;
+
+        scratch.resize(count);
+
+        std::array<std::array<uint32_t, 256>, k_Digits> histograms{};
+        for (const SortEntry& entry : entries) {
+            for (uint32_t digit = 0; digit < k_Digits; ++digit)
+                ++histograms[digit][(entry.m_Key >> (digit * 8)) & 0xFF];
+        }
+
+        std::vector<SortEntry>* src = &entries;
+        std::vector<SortEntry>* dst = &scratch;
+
+        for (uint32_t digit = 0; digit < k_Digits; ++digit) {
+            const uint32_t shift = digit * 8;
+            auto& histogram = histograms[digit];
+
+            // Every key has the same byte here: the pass would be an identity permutation.
+            if (histogram[((*src)[0].m_Key >> shift) & 0xFF] == count)
+                continue;
+
+            uint32_t offset = 0;
+            for (uint32_t& bucket : histogram) {
+                const uint32_t size = bucket;
+                bucket = offset;
+                offset += size;
+            }
+
+            for (const SortEntry& entry : *src)
+                (*dst)[histogram[(entry.m_Key >> shift) & 0xFF]++] = entry;
+
+            std::swap(src, dst);
+        }
+
+        if (src != &entries)
+            entries.swap(scratch);
+    }
+
+} // namespace Nova::App::Rendering
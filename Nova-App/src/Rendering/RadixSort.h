@@ -0,0 +1,22 @@
+#ifndef RADIXSORT_H
+#define RADIXSORT_H
+
+#include <vector>
+#include <cstdint>
+
+namespace Nova::App::Rendering {
+
+    struct SortEntry {
+        uint64_t m_Key{ 0 };
+        uint32_t m_Index{ 0 };
+    };
+
+    // Stable LSD radix sort on the 64-bit keys, one byte per pass.
+    // All histograms are built in a single read of the input, and passes whose byte is identical
+    // for every key are skipped, so sparse keys (few shaders, few passes) cost only a few scatters.
+    // `scratch` is resized as needed and can be kept between calls to avoid reallocations.
+    void RadixSort(std::vector<SortEntry>& entries, std::vector<SortEntry>& scratch);
+
+} // namespace Nova::App::Rendering
+
+#endif // RADIXSORT_H
@@ -0,0 +1,283 @@
+#include "Rendering/RenderGraph.h"
+
+#include <chrono>
+#include <algorithm>
+
+#include "Core/Assert.h"
+#include "Profiling/Profiler.h"
+
+namespace Nova::App::Rendering {
+
+    uint32_t GetBytesPerPixel(RGFormat format) {
+        switch (format) {
+        case RGFormat::R8:              return 1;
+        case RGFormat::RGBA8:           return 4;
+        case RGFormat::RG16F:           return 4;
+        case RGFormat::RGBA16F:         return 8;
+        case RGFormat::R11G11B10F:      return 4;
+        case RGFormat::R32UI:           return 4;
+        case RGFormat::Depth32F:        return 4;
+        case RGFormat::Depth24Stencil8: return 4;
+        }
+        return 4;
+    }
+
+    uint32_t ToVkImageLayout(RGState state) {
+        switch (state) {
+        case RGState::Undefined:       return 0;            // VK_IMAGE_LAYOUT_UNDEFINED
+        case RGState::ColorAttachment: return 2;            // VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL
+        case RGState::DepthAttachment: return 3;            // VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL
+        case RGState::DepthRead:       return 4;            // VK_IMAGE_LAYOUT_DEPTH_STENCIL_READ_ONLY_OPTIMAL
+        case RGState::ShaderRead:      return 5;            // VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL
+        case RGState::StorageWrite:    return 1;            // VK_IMAGE_LAYOUT_GENERAL
+        case RGState::TransferSrc:     return 6;            // VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL
+        case RGState::TransferDst:     return 7;            // VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL
+        case RGState::Present:         return 1000001002;   // VK_IMAGE_LAYOUT_PRESENT_SRC_KHR
+        }
+        return 0;
+    }
+
+    const char* GetStateName(RGState state) {
+        switch (state) {
+        case RGState::Undefined:       return "Undefined";
+        case RGState::ColorAttachment: return "ColorAttachment";
+        case RGState::DepthAttachment: return "DepthAttachment";
+        case RGState::DepthRead:       return "DepthRead";
+        case RGState::ShaderRead:      return "ShaderRead";
+        case RGState::StorageWrite:    return "StorageWrite";
+        case RGState::TransferSrc:     return "TransferSrc";
+        case RGState::TransferDst:     return "TransferDst";
+        case RGState::Present:         return "Present";
+        }
+        return "?";
+    }
+
+    namespace {
+
+        // Placement granularity of images in a shared allocation (the usual Vulkan bufferImageGranularity
+        // and render-target alignment).
+        constexpr uint64_t k_PlacementAlignment = 64 * 1024;
+
+        bool IsAttachment(RGState state) {
+            return state == RGState::ColorAttachment || state == RGState::DepthAttachment;
+        }
+
+    } // namespace
+
+    // ---- Builder ----
+
+    RGTexture RenderGraph::PassBuilder::Create(const RGTextureDesc& desc) {
+        RGTexture texture{ static_cast<uint32_t>(m_Graph.m_Textures.size()) };
+        m_Graph.m_Textures.push_back({ desc });
+        return texture;
+    }
+
+    void RenderGraph::PassBuilder::Read(RGTexture texture, RGState state) {
+        NV_ASSERT_MSG(texture.IsValid(), "RenderGraph: reading an invalid texture.");
+        m_Graph.m_Passes[m_Pass].m_Accesses.push_back({ texture.m_Index, state, false });
+    }
+
+    void RenderGraph::PassBuilder::Write(RGTexture texture, RGState state) {
+        NV_ASSERT_MSG(texture.IsValid(), "RenderGraph: writing an invalid texture.");
+        m_Graph.m_Passes[m_Pass].m_Accesses.push_back({ texture.m_Index, state, true });
+    }
+
+    void RenderGraph::PassBuilder::SetSideEffect() {
+        m_Graph.m_Passes[m_Pass].m_SideEffect = true;
+    }
+
+    // ---- Graph ----
+
+    void RenderGraph::Reset() {
+        m_Passes.clear();
+        m_Textures.clear();
+        m_FinalBarriers.clear();
+        m_Compiled = false;
+    }
+
+    RGTexture RenderGraph::Import(const RGTextureDesc& desc, RGState initialState, RGState finalState) {
+        RGTexture texture{ static_cast<uint32_t>(m_Textures.size()) };
+        Texture& entry = m_Textures.emplace_back();
+        entry.m_Desc = desc;
+        entry.m_Imported = true;
+        entry.m_InitialState = initialState;
+        entry.m_FinalState = finalState;
+        return texture;
+    }
+
+    uint32_t RenderGraph::AddPassInternal(const char* name, PassFunction execute) {
+        Pass& pass = m_Passes.emplace_back();
+        pass.m_Name = name;
+        pass.m_Execute = std::move(execute);
+        return static_cast<uint32_t>(m_Passes.size() - 1);
+    }
+
+    void RenderGraph::Compile() {
+        NV_PROFILE_SCOPE("RenderGraph::Compile");
+        const auto start = std::chrono::steady_clock::now();
+
+        m_Stats = {};
+        m_Stats.m_Passes = static_cast<uint32_t>(m_Passes.size());
+        m_Stats.m_Textures = static_cast<uint32_t>(m_Textures.size());
+
+        CullPasses();
+        ComputeLifetimes();
+        BuildBarriers();
+        AliasTransients();
+
+        m_Compiled = true;
+        m_Stats.m_CompileMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    void RenderGraph::CullPasses() {
+        // Walking backwards, a pass survives when it has a side effect or writes a texture that is
+        // still needed; what it touches is then needed by the passes before it.
+        std::vector<uint8_t> needed(m_Textures.size(), 0);
+        for (size_t i = 0; i < m_Textures.size(); ++i)
+            needed[i] = m_Textures[i].m_Imported ? 1 : 0;
+
+        for (size_t p = m_Passes.size(); p-- > 0;) {
+            Pass& pass = m_Passes[p];
+            pass.m_Alive = pass.m_SideEffect || std::any_of(pass.m_Accesses.begin(), pass.m_Accesses.end(),
+                [&](const Access& access) { return access.m_Write && needed[access.m_Texture]; });
+
+            if (!pass.m_Alive) {
+                ++m_Stats.m_CulledPasses;
+                continue;
+            }
+            for (const Access& access : pass.m_Accesses)
+                needed[access.m_Texture] = 1;
+        }
+    }
+
+    void RenderGraph::ComputeLifetimes() {
+        for (uint32_t p = 0; p < m_Passes.size(); ++p) {
+            if (!m_Passes[p].m_Alive)
+                continue;
+            for (const Access& access : m_Passes[p].m_Accesses) {
+                Texture& texture = m_Textures[access.m_Texture];
+                if (texture.m_FirstPass == k_None) {
+                    texture.m_FirstPass = p;
+                    NV_ASSERT_MSG(texture.m_Imported || access.m_Write, "RenderGraph: transient texture read before it is written.");
+                }
+                texture.m_LastPass = p;
+            }
+        }
+    }
+
+    void RenderGraph::BuildBarriers() {
+        std::vector<RGState> states(m_Textures.size());
+        std::vector<uint8_t> written(m_Textures.size(), 0);
+        for (size_t i = 0; i < m_Textures.size(); ++i)
+            states[i] = m_Textures[i].m_Imported ? m_Textures[i].m_InitialState : RGState::Undefined;
+
+        for (Pass& pass : m_Passes) {
+            pass.m_Barriers.clear();
+            if (!pass.m_Alive)
+                continue;
+
+            for (const Access& access : pass.m_Accesses) {
+                RGState& state = states[access.m_Texture];
+                const RGTexture texture{ access.m_Texture };
+
+                // A texture declared twice in one pass (read then written) gets a single barrier to its last state.
+                const auto existing = std::find_if(pass.m_Barriers.begin(), pass.m_Barriers.end(),
+                    [&](const RGBarrier& b) { return b.m_Texture.m_Index == access.m_Texture; });
+                if (existing != pass.m_Barriers.end())
+                    existing->m_After = access.m_State;
+                // Same layout: only a write following a write needs ordering (read-after-read does not),
+                // and attachment writes are already ordered by rasterization order.
+                else if (state != access.m_State || (access.m_Write && written[access.m_Texture] && !IsAttachment(state)))
+                    pass.m_Barriers.push_back({ texture, state, access.m_State });
+
+                state = access.m_State;
+                written[access.m_Texture] = access.m_Write ? 1 : 0;
+            }
+
+            for (const RGBarrier& barrier : pass.m_Barriers) {
+                ++m_Stats.m_Barriers;
+                if (barrier.IsTransition())
+                    ++m_Stats.m_LayoutTransitions;
+            }
+        }
+
+        for (uint32_t i = 0; i < m_Textures.size(); ++i) {
+            const Texture& texture = m_Textures[i];
+            if (texture.m_Imported && states[i] != texture.m_FinalState && texture.m_FinalState != RGState::Undefined) {
+                m_FinalBarriers.push_back({ RGTexture{ i }, states[i], texture.m_FinalState });
+                ++m_Stats.m_Barriers;
+                ++m_Stats.m_LayoutTransitions;
+            }
+        }
+    }
+
+    uint64_t RenderGraph::AlignedBytes(const Texture& texture) {
+        return (texture.m_Desc.GetBytes() + k_PlacementAlignment - 1) / k_PlacementAlignment * k_PlacementAlignment;
+    }
+
+    void RenderGraph::AliasTransients() {
+        std::vector<uint32_t> transients;
+        for (uint32_t i = 0; i < m_Textures.size(); ++i) {
+            const Texture& texture = m_Textures[i];
+            if (!texture.m_Imported && texture.m_FirstPass != k_None) {
+                transients.push_back(i);
+                m_Stats.m_TransientBytes += AlignedBytes(texture);
+            }
+        }
+        m_Stats.m_TransientTextures = static_cast<uint32_t>(transients.size());
+
+        // Largest first, each at the lowest offset of the transient heap that no texture alive at the
+        // same time occupies.
+        std::sort(transients.begin(), transients.end(), [&](uint32_t a, uint32_t b) {
+            return AlignedBytes(m_Textures[a]) > AlignedBytes(m_Textures[b]);
+        });
+
+        std::vector<uint32_t> placed;
+        std::vector<uint32_t> conflicts;
+        for (const uint32_t index : transients) {
+            Texture& texture = m_Textures[index];
+            const uint64_t size = AlignedBytes(texture);
+
+            conflicts.clear();
+            for (const uint32_t other : placed) {
+                const Texture& o = m_Textures[other];
+                if (texture.m_FirstPass <= o.m_LastPass && o.m_FirstPass <= texture.m_LastPass)
+                    conflicts.push_back(other);
+            }
+            std::sort(conflicts.begin(), conflicts.end(), [&](uint32_t a, uint32_t b) { return m_Textures[a].m_Offset < m_Textures[b].m_Offset; });
+
+            uint64_t offset = 0;
+            for (const uint32_t other : conflicts) {
+                const Texture& o = m_Textures[other];
+                if (offset + size <= o.m_Offset)
+                    break;
+                offset = std::max(offset, o.m_Offset + AlignedBytes(o));
+            }
+
+            texture.m_Offset = offset;
+            placed.push_back(index);
+            m_Stats.m_AliasedBytes = std::max(m_Stats.m_AliasedBytes, offset + size);
+        }
+    }
+
+    void RenderGraph::Execute(const std::function<void(const RGBarrier&)>& barrier) {
+        NV_ASSERT_MSG(m_Compiled, "RenderGraph: Execute() before Compile().");
+
+        for (Pass& pass : m_Passes) {
+            if (!pass.m_Alive)
+                continue;
+            if (barrier) {
+                for (const RGBarrier& b : pass.m_Barriers)
+                    barrier(b);
+            }
+            if (pass.m_Execute)
+                pass.m_Execute();
+        }
+
+        if (barrier) {
+            for (const RGBarrier& b : m_FinalBarriers)
+                barrier(b);
+        }
+    }
+
+} // namespace Nova::App::Rendering
@@ -0,0 +1,177 @@
+#ifndef RENDERGRAPH_H
+#define RENDERGRAPH_H
+
+#include <vector>
+#include <cstdint>
+#include <functional>
+
+namespace Nova::App::Rendering {
+
+    enum class RGFormat : uint8_t {
+        R8,
+        RGBA8,
+        RG16F,
+        RGBA16F,
+        R11G11B10F,
+        R32UI,
+        Depth32F,
+        Depth24Stencil8,
+    };
+
+    uint32_t GetBytesPerPixel(RGFormat format);
+
+    // How a pass uses a texture; each state maps to one image layout (see ToVkImageLayout).
+    enum class RGState : uint8_t {
+        Undefined,         // contents discarded
+        ColorAttachment,
+        DepthAttachment,
+        DepthRead,
+        ShaderRead,
+        StorageWrite,
+        TransferSrc,
+        TransferDst,
+        Present,
+    };
+
+    // VkImageLayout value of a state, for backends that record the barriers themselves.
+    uint32_t ToVkImageLayout(RGState state);
+    const char* GetStateName(RGState state);
+
+    struct RGTextureDesc {
+        const char* m_Name{ "" };   // string literal
+        uint32_t m_Width{ 0 };
+        uint32_t m_Height{ 0 };
+        RGFormat m_Format{ RGFormat::RGBA8 };
+
+        uint64_t GetBytes() const { return static_cast<uint64_t>(m_Width) * m_Height * GetBytesPerPixel(m_Format); }
+    };
+
+    struct RGTexture {
+        static constexpr uint32_t k_Invalid = 0xFFFFFFFFu;
+        uint32_t m_Index{ k_Invalid };
+
+        bool IsValid() const { return m_Index != k_Invalid; }
+    };
+
+    // A layout transition (m_Before != m_After) or, between two storage/transfer writes in the same
+    // state, a plain execution/memory dependency.
+    struct RGBarrier {
+        RGTexture m_Texture;
+        RGState m_Before{ RGState::Undefined };
+        RGState m_After{ RGState::Undefined };
+
+        bool IsTransition() const { return m_Before != m_After; }
+    };
+
+    struct RenderGraphStats {
+        uint32_t m_Passes{ 0 };
+        uint32_t m_CulledPasses{ 0 };
+        uint32_t m_Textures{ 0 };
+        uint32_t m_TransientTextures{ 0 };   // of the textures used by surviving passes
+        uint32_t m_Barriers{ 0 };
+        uint32_t m_LayoutTransitions{ 0 };
+        uint64_t m_TransientBytes{ 0 };      // one allocation per transient texture
+        uint64_t m_AliasedBytes{ 0 };        // size of the shared transient heap
+        double   m_CompileMs{ 0.0 };
+    };
+
+    // Frame graph rebuilt every frame.
+    //
+    // Passes declare the textures they read, write and create; Compile() then
+    //   - culls the passes whose results reach neither an imported texture nor a side effect,
+    //   - derives the barrier each surviving pass needs before it runs, by tracking the state of
+    //     every texture through the pass order (imported textures also get their final transition),
+    //   - places transient textures in one shared heap, where textures whose lifetimes (first to
+    //     last surviving pass using them) do not overlap may occupy the same memory.
+    // A write keeps the previous contents, so earlier writers of a texture stay alive as long as
+    // a later one does. Passes run in declaration order.
+    class RenderGraph {
+    public:
+        using PassFunction = std::function<void()>;
+
+        class PassBuilder {
+        public:
+            // Transient texture, only alive between the passes using it.
+            RGTexture Create(const RGTextureDesc& desc);
+            void Read(RGTexture texture, RGState state = RGState::ShaderRead);
+            void Write(RGTexture texture, RGState state = RGState::ColorAttachment);
+            // The pass must run even if nothing reads what it writes (presentation, readback, UI).
+            void SetSideEffect();
+
+        private:
+            friend class RenderGraph;
+            PassBuilder(RenderGraph& graph, uint32_t pass) : m_Graph(graph), m_Pass(pass) {}
+
+            RenderGraph& m_Graph;
+            uint32_t m_Pass;
+        };
+
+        void Reset();
+
+        // Texture owned outside the graph; it is left in `finalState` at the end of the frame.
+        RGTexture Import(const RGTextureDesc& desc, RGState initialState, RGState finalState);
+
+        template <typename Setup>
+        void AddPass(const char* name, Setup&& setup, PassFunction execute) {
+            const uint32_t pass = AddPassInternal(name, std::move(execute));
+            PassBuilder builder(*this, pass);
+            setup(builder);
+        }
+
+        void Compile();
+        // Runs the surviving passes, handing each barrier to `barrier` right before its pass.
+        void Execute(const std::function<void(const RGBarrier&)>& barrier);
+
+        const RenderGraphStats& GetStats() const { return m_Stats; }
+        const RGTextureDesc& GetDesc(RGTexture texture) const { return m_Textures[texture.m_Index].m_Desc; }
+        // Offset of a transient texture in the shared heap, valid after Compile().
+        uint64_t GetHeapOffset(RGTexture texture) const { return m_Textures[texture.m_Index].m_Offset; }
+
+    private:
+        static constexpr uint32_t k_None = 0xFFFFFFFFu;
+
+        struct Access {
+            uint32_t m_Texture{ k_None };
+            RGState m_State{ RGState::Undefined };
+            bool m_Write{ false };
+        };
+
+        struct Pass {
+            const char* m_Name{ "" };
+            PassFunction m_Execute;
+            std::vector<Access> m_Accesses;
+            std::vector<RGBarrier> m_Barriers;   // filled by Compile()
+            bool m_SideEffect{ false };
+            bool m_Alive{ false };
+        };
+
+        struct Texture {
+            RGTextureDesc m_Desc;
+            bool m_Imported{ false };
+            RGState m_InitialState{ RGState::Undefined };
+            RGState m_FinalState{ RGState::Undefined };
+
+            // Transient placement, filled by Compile().
+            uint32_t m_FirstPass{ k_None };
+            uint32_t m_LastPass{ k_None };
+            uint64_t m_Offset{ 0 };   // in the transient heap
+        };
+
+        uint32_t AddPassInternal(const char* name, PassFunction execute);
+        static uint64_t AlignedBytes(const Texture& texture);
+
+        void CullPasses();
+        void ComputeLifetimes();
+        void BuildBarriers();
+        void AliasTransients();
+
+        std::vector<Pass> m_Passes;
+        std::vector<Texture> m_Textures;
+        std::vector<RGBarrier> m_FinalBarriers;
+        RenderGraphStats m_Stats;
+        bool m_Compiled{ false };
+    };
+
+} // namespace Nova::App::Rendering
+
+#endif // RENDERGRAPH_H
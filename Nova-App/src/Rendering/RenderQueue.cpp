@@ -0,0 +1,143 @@
+#include "Rendering/RenderQueue.h"
+
+#include <memory>
+#include <algorithm>
+
+namespace Nova::App::Rendering {
+
+    uint64_t SortKey::Encode(RenderPass pass, uint32_t shader, uint32_t material, uint32_t mesh, float normalizedDepth) {
+        const uint64_t depth = static_cast<uint64_t>(std::clamp(normalizedDepth, 0.0f, 1.0f) * static_cast<float>(k_DepthMax));
+
+        // Ids only order the draws; runs compare the full ids stored in the packets,
+        // so truncating them here never merges different materials or meshes.
+        const uint64_t passBits     = static_cast<uint64_t>(pass) & 0x3;
+        const uint64_t shaderBits   = static_cast<uint64_t>(shader) & 0x3F;
+        const uint64_t materialBits = static_cast<uint64_t>(material) & 0xFFFF;
+        const uint64_t meshBits     = static_cast<uint64_t>(mesh) & 0xFFFF;
+
+        uint64_t key = (passBits << 62) | (shaderBits << 56);
+        if (pass == RenderPass::Opaque)
+            key |= (materialBits << 40) | (meshBits << 24) | depth;
+        else
+            key |= ((k_DepthMax - depth) << 32) | (materialBits << 16) | meshBits;
+        return key;
+    }
+
+    void RenderQueue::Begin(const glm::mat4& view, float farPlane) {
+        m_View = view;
+        m_InvFarPlane = farPlane > 0.0f ? 1.0f / farPlane : 1.0f;
+
+        // Keep capacities from the previous frame: scenes rarely change size between frames.
+        m_MaterialIds.clear();
+        m_MeshIds.clear();
+        m_Materials.clear();
+        m_Meshes.clear();
+        m_Packets.clear();
+        m_PacketTransforms.clear();
+        m_PacketObjects.clear();
+        m_SortEntries.clear();
+        m_Runs.clear();
+        m_Transforms.clear();
+        m_Objects.clear();
+
+        m_UnsortedMaterialChanges = 0;
+        m_UnsortedMeshChanges = 0;
+    }
+
+    void RenderQueue::Submit(const GPUMeshRef& mesh, uint32_t indexCount, const MaterialBlockComponent& material, const glm::mat4& transform, uint32_t object) {
+        // A hash hit is confirmed on the content; colliding blocks each get an id of their own.
+        uint32_t materialId = static_cast<uint32_t>(m_Materials.size());
+        const auto [first, last] = m_MaterialIds.equal_range(material.m_Hash);
+        for (auto it = first; it != last; ++it) {
+            if (MaterialBlocksEqual(m_Materials[it->second]->m_Data, material.m_Data)) {
+                materialId = it->second;
+                break;
+            }
+        }
+        if (materialId == m_Materials.size()) {
+            m_MaterialIds.emplace(material.m_Hash, materialId);
+            m_Materials.push_back(&material);
+        }
+
+        auto [meshIt, newMesh] = m_MeshIds.try_emplace(std::to_address(mesh), static_cast<uint32_t>(m_Meshes.size()));
+        if (newMesh)
+            m_Meshes.push_back({ mesh, indexCount });
+
+        DrawPacket packet{};
+        packet.m_MaterialId = materialId;
+        packet.m_MeshId = meshIt->second;
+        packet.m_TransformIndex = static_cast<uint32_t>(m_PacketTransforms.size());
+        packet.m_Pass = material.m_Source.isOpaque ? RenderPass::Opaque : RenderPass::Transparent;
+
+        if (!m_Packets.empty()) {
+            const DrawPacket& previous = m_Packets.back();
+            m_UnsortedMaterialChanges += previous.m_MaterialId != packet.m_MaterialId;
+            m_UnsortedMeshChanges += previous.m_MeshId != packet.m_MeshId;
+        }
+
+        // View-space distance along the camera axis (the camera looks down -Z).
+        const glm::vec3 origin = glm::vec3(transform[3]);
+        const float viewDepth = -(m_View * glm::vec4(origin, 1.0f)).z;
+
+        const uint64_t key = SortKey::Encode(packet.m_Pass, 0, packet.m_MaterialId, packet.m_MeshId, viewDepth * m_InvFarPlane);
+
+        m_SortEntries.push_back({ key, static_cast<uint32_t>(m_Packets.size()) });
+        m_Packets.push_back(packet);
+        m_PacketTransforms.push_back(transform);
+        m_PacketObjects.push_back(object);
+    }
+
+    void RenderQueue::Sort(RenderStats& stats) {
+        RadixSort(m_SortEntries, m_SortScratch);
+
+        m_Transforms.reserve(m_SortEntries.size());
+        m_Objects.reserve(m_SortEntries.size());
+
+        uint32_t materialChanges = 0;
+        uint32_t meshChanges = 0;
+
+        for (const SortEntry& entry : m_SortEntries) {
+            const DrawPacket& packet = m_Packets[entry.m_Index];
+
+            if (!m_Runs.empty()) {
+                DrawRun& run = m_Runs.back();
+                const bool sameMaterial = run.m_MaterialId == packet.m_MaterialId;
+                const bool sameMesh = run.m_MeshId == packet.m_MeshId;
+
+                if (sameMaterial && sameMesh && run.m_Pass == packet.m_Pass) {
+                    ++run.m_InstanceCount;
+                    m_Transforms.push_back(m_PacketTransforms[packet.m_TransformIndex]);
+                    m_Objects.push_back(m_PacketObjects[packet.m_TransformIndex]);
+                    continue;
+                }
+
+                materialChanges += !sameMaterial;
+                meshChanges += !sameMesh;
+            }
+
+            DrawRun run{};
+            run.m_Pass = packet.m_Pass;
+            run.m_MaterialId = packet.m_MaterialId;
+            run.m_MeshId = packet.m_MeshId;
+            run.m_FirstInstance = static_cast<uint32_t>(m_Transforms.size());
+            run.m_InstanceCount = 1;
+            m_Runs.push_back(run);
+
+            m_Transforms.push_back(m_PacketTransforms[packet.m_TransformIndex]);
+            m_Objects.push_back(m_PacketObjects[packet.m_TransformIndex]);
+        }
+
+        stats.m_DrawPackets += static_cast<uint32_t>(m_Packets.size());
+        stats.m_MaterialChangesAvoided += m_UnsortedMaterialChanges > materialChanges ? m_UnsortedMaterialChanges - materialChanges : 0;
+        stats.m_MeshChangesAvoided += m_UnsortedMeshChanges > meshChanges ? m_UnsortedMeshChanges - meshChanges : 0;
+    }
+
+    std::span<const glm::mat4> RenderQueue::GetTransforms(const DrawRun& run) const {
+        return std::span<const glm::mat4>(m_Transforms).subspan(run.m_FirstInstance, run.m_InstanceCount);
+    }
+
+    std::span<const uint32_t> RenderQueue::GetObjects(const DrawRun& run) const {
+        return std::span<const uint32_t>(m_Objects).subspan(run.m_FirstInstance, run.m_InstanceCount);
+    }
+
+} // namespace Nova::App::Rendering
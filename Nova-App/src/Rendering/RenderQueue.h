@@ -0,0 +1,108 @@
+#ifndef RENDERQUEUE_H
+#define RENDERQUEUE_H
+
+#include <span>
+#include <vector>
+#include <cstdint>
+#include <unordered_map>
+
+#include <glm/glm.hpp>
+
+#include "Renderer/RHI/RHI_Renderer.h"
+
+#include "Rendering/RHICompat.h"
+#include "Rendering/MaterialBlock.h"
+#include "Rendering/RadixSort.h"
+#include "Rendering/RenderStats.h"
+
+namespace Nova::App::Rendering {
+
+    enum class RenderPass : uint8_t {
+        Opaque      = 0,
+        Transparent = 1,
+    };
+
+    // 64-bit draw sort key, most significant field first:
+    //
+    //   Opaque       | pass:2 | shader:6 | material:16 | mesh:16 | depth:24 (front-to-back) |
+    //   Transparent  | pass:2 | shader:6 | depth:24 (back-to-front) | material:16 | mesh:16 |
+    //
+    // Opaque draws are grouped by state first so identical (material, mesh) draws end up adjacent;
+    // transparent draws must respect depth order, state only breaks ties.
+    namespace SortKey {
+        constexpr uint32_t k_DepthBits = 24;
+        constexpr uint32_t k_DepthMax  = (1u << k_DepthBits) - 1;
+
+        uint64_t Encode(RenderPass pass, uint32_t shader, uint32_t material, uint32_t mesh, float normalizedDepth);
+    }
+
+    // Compact draw packet: everything else lives in per-frame tables indexed by these ids.
+    struct DrawPacket {
+        uint32_t m_MaterialId{ 0 };
+        uint32_t m_MeshId{ 0 };
+        uint32_t m_TransformIndex{ 0 };
+        RenderPass m_Pass{ RenderPass::Opaque };
+    };
+
+    // Consecutive sorted packets sharing pass, material and mesh: one state setup, one (instanced) draw.
+    struct DrawRun {
+        RenderPass m_Pass{ RenderPass::Opaque };
+        uint32_t m_MaterialId{ 0 };
+        uint32_t m_MeshId{ 0 };
+        uint32_t m_FirstInstance{ 0 };
+        uint32_t m_InstanceCount{ 0 };
+    };
+
+    // Sits between the ECS traversal and the RHI: collects draw packets, radix-sorts them by key,
+    // and exposes the result as runs whose model matrices are contiguous in sorted order
+    // (ready to be uploaded as the frame's instance buffer).
+    class RenderQueue {
+    public:
+        void Begin(const glm::mat4& view, float farPlane);
+        // `object` is the caller's index for the draw, carried into sorted order (see GetObjects).
+        void Submit(const GPUMeshRef& mesh, uint32_t indexCount, const MaterialBlockComponent& material, const glm::mat4& transform, uint32_t object = 0);
+
+        // Sorts the packets, builds the runs and accounts the state changes saved by sorting.
+        void Sort(RenderStats& stats);
+
+        const std::vector<DrawRun>& GetRuns() const { return m_Runs; }
+        std::span<const glm::mat4> GetTransforms(const DrawRun& run) const;
+        std::span<const uint32_t> GetObjects(const DrawRun& run) const;
+
+        const MaterialBlockComponent& GetMaterial(const DrawRun& run) const { return *m_Materials[run.m_MaterialId]; }
+        const GPUMeshRef& GetMesh(const DrawRun& run) const { return m_Meshes[run.m_MeshId].m_Mesh; }
+        uint32_t GetIndexCount(const DrawRun& run) const { return m_Meshes[run.m_MeshId].m_IndexCount; }
+
+    private:
+        struct MeshEntry {
+            GPUMeshRef m_Mesh{};
+            uint32_t m_IndexCount{ 0 };
+        };
+
+        glm::mat4 m_View{ 1.0f };
+        float m_InvFarPlane{ 1.0f };
+
+        // Per-frame id tables (material content hash / mesh address -> dense id).
+        std::unordered_multimap<uint64_t, uint32_t> m_MaterialIds;
+        std::unordered_map<const void*, uint32_t> m_MeshIds;
+        std::vector<const MaterialBlockComponent*> m_Materials;
+        std::vector<MeshEntry> m_Meshes;
+
+        std::vector<DrawPacket> m_Packets;
+        std::vector<glm::mat4> m_PacketTransforms;
+        std::vector<uint32_t> m_PacketObjects;
+        std::vector<SortEntry> m_SortEntries;
+        std::vector<SortEntry> m_SortScratch;
+
+        // State changes the traversal order would have caused, counted while submitting.
+        uint32_t m_UnsortedMaterialChanges{ 0 };
+        uint32_t m_UnsortedMeshChanges{ 0 };
+
+        std::vector<DrawRun> m_Runs;
+        std::vector<glm::mat4> m_Transforms;
+        std::vector<uint32_t> m_Objects;   // parallel to m_Transforms
+    };
+
+} // namespace Nova::App::Rendering
+
+#endif // RENDERQUEUE_H
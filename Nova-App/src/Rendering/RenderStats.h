@@ -0,0 +1,56 @@
+#ifndef RENDERSTATS_H
+#define RENDERSTATS_H
+
+#include <cstdint>
+
+namespace Nova::App::Rendering {
+
+    // Per-frame counters filled while the scene is rendered.
+    // Reset by AppLayer::BeginRenderScene, read by the Render Stats panel.
+    struct RenderStats {
+        uint32_t m_DrawCalls{ 0 };
+        uint32_t m_Instances{ 0 };          // meshes drawn, instanced or not
+        uint32_t m_InstancedBatches{ 0 };   // draws submitted with an instance buffer
+        float    m_SceneCpuTimeMs{ 0.0f };  // time spent in AppLayer::RenderScene
+        float    m_SubmitCpuTimeMs{ 0.0f }; // of which recording the draws (and the culling dispatch)
+
+        // ---- Transforms ----
+        uint32_t m_TransformsUpdated{ 0 };  // world matrices rewritten by the transform cache
+
+        // ---- Culling ----
+        uint32_t m_Visible{ 0 };
+        uint32_t m_Culled{ 0 };
+
+        // ---- LOD ----
+        uint64_t m_TrianglesBeforeLOD{ 0 };   // visible triangles at full detail
+        uint64_t m_TrianglesAfterLOD{ 0 };    // visible triangles actually drawn
+        uint32_t m_LODReduced{ 0 };           // visible meshes drawn below full detail
+
+        // ---- Bindless ----
+        uint32_t m_BindlessDraws{ 0 };        // draws that bound no material or transform
+
+        // ---- GPU-driven ----
+        uint32_t m_GpuObjects{ 0 };           // culled on the GPU, in neither m_Visible nor m_Culled
+        uint32_t m_IndirectDraws{ 0 };        // indirect-count draws, one per mesh
+
+        // ---- Vertex format ----
+
+        // ---- Render queue ----
+        uint32_t m_DrawPackets{ 0 };
+        uint32_t m_MaterialChangesAvoided{ 0 };  // vs. drawing in ECS traversal order
+        uint32_t m_MeshChangesAvoided{ 0 };
+
+        // ---- Materials ----
+        uint32_t m_MaterialBinds{ 0 };          // blocks actually uploaded to the shader
+        uint32_t m_MaterialBindsSkipped{ 0 };   // draws that reused the currently bound block
+        uint32_t m_MaterialBlocksUpdated{ 0 };  // blocks repacked because their material changed
+
+        // ---- Uniforms ----
+        uint64_t m_UniformBytesUploaded{ 0 };
+
+        void Reset() { *this = RenderStats{}; }
+    };
+
+} // namespace Nova::App::Rendering
+
+#endif // RENDERSTATS_H
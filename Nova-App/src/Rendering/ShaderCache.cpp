@@ -0,0 +1,237 @@
+#include "Rendering/ShaderCache.h"
+
+#include <regex>
+#include <format>
+#include <thread>
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <unordered_set>
+
+#include "Core/Log.h"
+
+namespace Nova::App::Rendering {
+
+    namespace fs = std::filesystem;
+
+    namespace {
+
+        constexpr const char* k_ShaderCacheDirectory = "Cache/Shaders";
+        constexpr uint32_t k_EntryMagic = 0x48534E4E;   // "NNSH"
+
+        struct EntryHeader {
+            uint32_t m_Magic{ k_EntryMagic };
+            uint32_t m_Version{ 0 };
+            uint64_t m_Key{ 0 };
+            uint64_t m_WordCount{ 0 };
+            double   m_CompileMs{ 0.0 };
+        };
+
+        bool ReadText(const fs::path& file, std::string& text) {
+            std::ifstream stream(file, std::ios::binary);
+            if (!stream)
+                return false;
+            std::ostringstream contents;
+            contents << stream.rdbuf();
+            text = std::move(contents).str();
+            return true;
+        }
+
+        fs::path ResolveInclude(const std::string& name, const fs::path& from, std::span<const fs::path> includeDirs) {
+            std::error_code error;
+            const fs::path local = from.parent_path() / name;
+            if (fs::exists(local, error))
+                return local;
+            for (const auto& dir : includeDirs) {
+                if (fs::exists(dir / name, error))
+                    return dir / name;
+            }
+            return {};
+        }
+
+    } // namespace
+
+    void ShaderKeyHasher::AddSourceTree(const fs::path& file, std::span<const fs::path> includeDirs) {
+        // #include "File.slang" and Slang's `import Module.Name;` (-> Module/Name.slang).
+        static const std::regex s_Include(R"(^\s*#\s*include\s*[<"]([^">]+)[">])");
+        static const std::regex s_Import(R"(^\s*(?:__)?import\s+([A-Za-z0-9_.]+)\s*;)");
+
+        std::unordered_set<std::string> visited;
+        std::vector<fs::path> pending{ file };
+
+        while (!pending.empty()) {
+            const fs::path current = pending.back();
+            pending.pop_back();
+
+            std::error_code error;
+            const fs::path canonical = fs::weakly_canonical(current, error);
+            if (!visited.insert((error ? current : canonical).generic_string()).second)
+                continue;
+
+            std::string source;
+            if (!ReadText(current, source)) {
+                // A missing file still has to change the key, or a stale binary would be served.
+                Add("<missing>");
+                Add(current.generic_string());
+                continue;
+            }
+
+            Add(current.filename().generic_string());
+            AddValue(static_cast<uint64_t>(source.size()));
+            Add(source);
+
+            std::istringstream lines(source);
+            for (std::string line; std::getline(lines, line);) {
+                std::smatch match;
+                std::string name;
+                if (std::regex_search(line, match, s_Include))
+                    name = match[1].str();
+                else if (std::regex_search(line, match, s_Import)) {
+                    name = match[1].str();
+                    std::replace(name.begin(), name.end(), '.', '/');
+                    name += ".slang";
+                }
+                else
+                    continue;
+
+                const fs::path resolved = ResolveInclude(name, current, includeDirs);
+                if (resolved.empty()) {
+                    Add("<unresolved>");
+                    Add(name);
+                    continue;
+                }
+                pending.push_back(resolved);
+            }
+        }
+    }
+
+    ShaderCache& ShaderCache::Get() {
+        static ShaderCache s_Instance;
+        return s_Instance;
+    }
+
+    ShaderCache::Binary ShaderCache::Find(uint64_t key) {
+        {
+            std::shared_lock lock(m_Mutex);
+            if (auto it = m_Entries.find(key); it != m_Entries.end()) {
+                RecordMemoryHit(it->second.m_CompileMs);
+                return it->second.m_Binary;
+            }
+        }
+
+        const auto start = std::chrono::steady_clock::now();
+        Entry entry;
+        if (!ReadEntry(key, entry))
+            return nullptr;
+        const double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+        {
+            std::lock_guard lock(m_StatsMutex);
+            ++m_Stats.m_DiskHits;
+            m_Stats.m_LoadMs += ms;
+            m_Stats.m_SavedMs += std::max(0.0, entry.m_CompileMs - ms);
+        }
+
+        std::unique_lock lock(m_Mutex);
+        // Another thread may have loaded or compiled it meanwhile; keep the first one.
+        return m_Entries.try_emplace(key, std::move(entry)).first->second.m_Binary;
+    }
+
+    ShaderCache::Binary ShaderCache::Store(uint64_t key, std::vector<uint32_t> binary, double compileMs) {
+        Entry entry{ std::make_shared<const std::vector<uint32_t>>(std::move(binary)), compileMs };
+        WriteEntry(key, entry);
+        RecordMiss(compileMs);
+
+        std::unique_lock lock(m_Mutex);
+        return m_Entries.insert_or_assign(key, std::move(entry)).first->second.m_Binary;
+    }
+
+    void ShaderCache::RecordMemoryHit(double savedMs) {
+        std::lock_guard lock(m_StatsMutex);
+        ++m_Stats.m_MemoryHits;
+        m_Stats.m_SavedMs += savedMs;
+    }
+
+    void ShaderCache::RecordMiss(double compileMs) {
+        std::lock_guard lock(m_StatsMutex);
+        ++m_Stats.m_Misses;
+        m_Stats.m_CompileMs += compileMs;
+    }
+
+    void ShaderCache::RecordUncached(double compileMs) {
+        std::lock_guard lock(m_StatsMutex);
+        ++m_Stats.m_Uncached;
+        m_Stats.m_UncachedMs += compileMs;
+    }
+
+    ShaderCacheStats ShaderCache::GetStats() const {
+        std::lock_guard lock(m_StatsMutex);
+        return m_Stats;
+    }
+
+    fs::path ShaderCache::GetEntryPath(uint64_t key) const {
+        return fs::path(k_ShaderCacheDirectory) / std::format("{:016x}.spv", key);
+    }
+
+    bool ShaderCache::ReadEntry(uint64_t key, Entry& entry) const {
+        const fs::path path = GetEntryPath(key);
+        std::error_code error;
+        const uint64_t fileSize = fs::file_size(path, error);
+        if (error || fileSize < sizeof(EntryHeader))
+            return false;
+
+        std::ifstream file(path, std::ios::binary);
+        if (!file)
+            return false;
+
+        EntryHeader header{};
+        file.read(reinterpret_cast<char*>(&header), sizeof(header));
+        if (!file || header.m_Magic != k_EntryMagic || header.m_Version != k_FormatVersion || header.m_Key != key)
+            return false;
+
+        // The binary is the rest of the file: a corrupt word count must not size the allocation.
+        const uint64_t payloadBytes = fileSize - sizeof(EntryHeader);
+        if (header.m_WordCount == 0 || header.m_WordCount != payloadBytes / sizeof(uint32_t) || payloadBytes % sizeof(uint32_t) != 0)
+            return false;
+
+        std::vector<uint32_t> words(header.m_WordCount);
+        file.read(reinterpret_cast<char*>(words.data()), static_cast<std::streamsize>(words.size() * sizeof(uint32_t)));
+        if (!file)
+            return false;
+
+        entry.m_Binary = std::make_shared<const std::vector<uint32_t>>(std::move(words));
+        entry.m_CompileMs = header.m_CompileMs;
+        return true;
+    }
+
+    void ShaderCache::WriteEntry(uint64_t key, const Entry& entry) const {
+        std::error_code error;
+        fs::create_directories(k_ShaderCacheDirectory, error);
+
+        EntryHeader header{};
+        header.m_Version = k_FormatVersion;
+        header.m_Key = key;
+        header.m_WordCount = entry.m_Binary->size();
+        header.m_CompileMs = entry.m_CompileMs;
+
+        // Unique temporary name per thread, then rename: concurrent writers and readers only
+        // ever see complete files.
+        const fs::path path = GetEntryPath(key);
+        const fs::path temporary = path.string() + std::format(".{}.tmp", std::hash<std::thread::id>{}(std::this_thread::get_id()));
+        {
+            std::ofstream file(temporary, std::ios::binary | std::ios::trunc);
+            file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+            file.write(reinterpret_cast<const char*>(entry.m_Binary->data()), static_cast<std::streamsize>(entry.m_Binary->size() * sizeof(uint32_t)));
+            if (!file) {
+                NV_LOG_ERROR(std::format("Shader cache: cannot write '{}'", path.string()));
+                fs::remove(temporary, error);
+                return;
+            }
+        }
+
+        fs::rename(temporary, path, error);
+        if (error)
+            fs::remove(temporary, error);
+    }
+
+} // namespace Nova::App::Rendering
@@ -0,0 +1,155 @@
+#ifndef SHADERCACHE_H
+#define SHADERCACHE_H
+
+#include <span>
+#include <mutex>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <concepts>
+#include <filesystem>
+#include <string_view>
+#include <shared_mutex>
+#include <unordered_map>
+
+#include "Common/Hash.h"
+
+// Version of the shader compiler the build links, folded into every cache key so binaries from
+// another compiler are never served. Set by the build (NOVA_APP_SHADER_COMPILER_VERSION); used when
+// the compiler cannot report its own version (ShaderCompilerVersionSupport).
+#ifndef NV_SHADER_COMPILER_VERSION
+#define NV_SHADER_COMPILER_VERSION ""
+#endif
+
+namespace Nova::App::Rendering {
+
+    struct ShaderCacheStats {
+        uint32_t m_MemoryHits{ 0 };
+        uint32_t m_DiskHits{ 0 };
+        uint32_t m_Misses{ 0 };
+        uint32_t m_Uncached{ 0 };      // compiled by the renderer from source, without the cache
+        double   m_CompileMs{ 0.0 };   // spent compiling on misses
+        double   m_UncachedMs{ 0.0 };  // spent compiling without the cache
+        double   m_LoadMs{ 0.0 };      // spent reading disk hits
+        double   m_SavedMs{ 0.0 };     // compile time the hits would have cost
+    };
+
+    // A compiler able to report its version (e.g. Slang's build tag).
+    template <typename Compiler>
+    concept ShaderCompilerVersionSupport = requires {
+        { Compiler::GetVersion() } -> std::convertible_to<std::string_view>;
+    };
+
+    // Incremental FNV-1a, used for shader cache keys.
+    class ShaderKeyHasher {
+    public:
+        void Add(std::span<const std::byte> bytes) { m_Hash = Fnv1a(bytes, m_Hash); }
+        void Add(std::string_view text) { Add(std::as_bytes(std::span(text.data(), text.size()))); }
+        template <typename T>
+        void AddValue(const T& value) { Add(std::as_bytes(std::span(&value, 1))); }
+
+        // Hashes the file and, transitively, everything it pulls in with #include "..." or import,
+        // resolved against the including file's directory first, then `includeDirs`.
+        void AddSourceTree(const std::filesystem::path& file, std::span<const std::filesystem::path> includeDirs);
+
+        uint64_t Get() const { return m_Hash; }
+
+    private:
+        uint64_t m_Hash{ k_Fnv1aOffset };
+    };
+
+    // Compiled shader binaries keyed by the content hash of everything that affects compilation:
+    // compiler version, source tree, stage, entry point and defines. An in-memory map sits on top of one file per key
+    // under Cache/Shaders. Safe to use from several threads; files are written atomically.
+    class ShaderCache {
+    public:
+        using Binary = std::shared_ptr<const std::vector<uint32_t>>;
+
+        static ShaderCache& Get();
+
+        // Cache key for an RHI_ShaderCompileInput-like description compiled by `Compiler`. Fields
+        // beyond m_File/m_Stage/m_IncludeDirs are hashed when the compile input has them.
+        template <typename Compiler, typename Input>
+        static uint64_t ComputeKey(const Input& input) {
+            ShaderKeyHasher hasher;
+            hasher.AddValue(k_FormatVersion);
+            if constexpr (ShaderCompilerVersionSupport<Compiler>)
+                hasher.Add(std::string_view(Compiler::GetVersion()));
+            else
+                hasher.Add(std::string_view(NV_SHADER_COMPILER_VERSION));
+            hasher.Add(";");
+            hasher.AddValue(static_cast<uint32_t>(input.m_Stage));
+
+            if constexpr (requires { std::string_view(input.m_EntryPoint); })
+                hasher.Add(std::string_view(input.m_EntryPoint));
+
+            if constexpr (requires { input.m_Defines.begin(); }) {
+                for (const auto& define : input.m_Defines) {
+                    if constexpr (requires { std::string_view(define.first); std::string_view(define.second); }) {
+                        hasher.Add(std::string_view(define.first));
+                        hasher.Add("=");
+                        hasher.Add(std::string_view(define.second));
+                    }
+                    else {
+                        hasher.Add(std::string_view(define));
+                    }
+                    hasher.Add(";");
+                }
+            }
+
+            const std::vector<std::filesystem::path> includeDirs(input.m_IncludeDirs.begin(), input.m_IncludeDirs.end());
+            hasher.AddSourceTree(input.m_File, includeDirs);
+            return hasher.Get();
+        }
+
+        // Memory first, then disk. Null on a miss.
+        Binary Find(uint64_t key);
+        Binary Store(uint64_t key, std::vector<uint32_t> binary, double compileMs);
+
+        // Returns the cached binary or runs `compile` (which returns std::vector<uint32_t>; empty on failure).
+        template <typename Compile>
+        Binary GetOrCompile(uint64_t key, Compile&& compile) {
+            if (Binary binary = Find(key))
+                return binary;
+
+            const auto start = std::chrono::steady_clock::now();
+            std::vector<uint32_t> binary = compile();
+            const double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+            if (binary.empty())
+                return nullptr;
+
+            return Store(key, std::move(binary), ms);
+        }
+
+        // For callers caching something built from shaders (e.g. shader objects) on top of this cache.
+        void RecordMemoryHit(double savedMs);
+        void RecordMiss(double compileMs);
+        // A shader compiled without going through the cache at all.
+        void RecordUncached(double compileMs);
+
+        ShaderCacheStats GetStats() const;
+
+    private:
+        static constexpr uint32_t k_FormatVersion = 2;   // 2: compiler version in the key
+
+        struct Entry {
+            Binary m_Binary;
+            double m_CompileMs{ 0.0 };
+        };
+
+        std::filesystem::path GetEntryPath(uint64_t key) const;
+        bool ReadEntry(uint64_t key, Entry& entry) const;
+        void WriteEntry(uint64_t key, const Entry& entry) const;
+
+        mutable std::shared_mutex m_Mutex;
+        std::unordered_map<uint64_t, Entry> m_Entries;
+
+        mutable std::mutex m_StatsMutex;
+        ShaderCacheStats m_Stats;
+    };
+
+} // namespace Nova::App::Rendering
+
+#endif // SHADERCACHE_H
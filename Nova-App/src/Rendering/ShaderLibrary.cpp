@@ -0,0 +1,68 @@
+#include "Rendering/ShaderLibrary.h"
+
+namespace Nova::App::Rendering {
+
+    using namespace Nova::Core::Renderer::RHI;
+
+    void ShaderLibrary::Prewarm(IRenderer& renderer, std::vector<FullscreenShaderDesc> descs) {
+        auto& jobs = Jobs::JobSystem::Get();
+
+        if (!ShaderBinaryCompileSupport<RHI_ShaderCompiler, RHI_ShaderCompileInput> || !jobs.IsInitialized()) {
+            for (const auto& desc : descs)
+                Release(AcquireFullscreen(renderer, desc.m_Vertex, desc.m_Fragment));
+            return;
+        }
+
+        jobs.Wait(m_PrewarmJobs);
+        m_PrewarmDescs = std::move(descs);
+        for (const auto& desc : m_PrewarmDescs)
+            jobs.Submit([&renderer, &desc]() { PrewarmFullscreenShader<RHI_ShaderCompiler>(renderer, desc.m_Vertex, desc.m_Fragment); }, &m_PrewarmJobs);
+    }
+
+    RHI_Shaders* ShaderLibrary::AcquireFullscreen(IRenderer& renderer, const RHI_ShaderCompileInput& vert, const RHI_ShaderCompileInput& frag) {
+        if (!m_PrewarmJobs.IsDone())
+            Jobs::JobSystem::Get().Wait(m_PrewarmJobs);
+
+        const uint64_t vertKey = ShaderCache::ComputeKey<RHI_ShaderCompiler>(vert);
+        const uint64_t fragKey = ShaderCache::ComputeKey<RHI_ShaderCompiler>(frag);
+        const uint64_t key = vertKey ^ (fragKey + 0x9E3779B97F4A7C15ull + (vertKey << 6) + (vertKey >> 2));
+
+        auto& entry = m_Fullscreen[key];
+        if (entry.m_Shader) {
+            ++entry.m_References;
+            ShaderCache::Get().RecordMemoryHit(entry.m_CreateMs);
+            return entry.m_Shader;
+        }
+
+        const auto start = std::chrono::steady_clock::now();
+        entry.m_Shader = CreateFullscreenShader<RHI_ShaderCompiler>(renderer, vert, frag, vertKey, fragKey);
+        entry.m_CreateMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+        if (!entry.m_Shader) {
+            m_Fullscreen.erase(key);
+            return nullptr;
+        }
+
+        entry.m_References = 1;
+        return entry.m_Shader;
+    }
+
+    void ShaderLibrary::Release(RHI_Shaders* shader) {
+        for (auto& [key, entry] : m_Fullscreen) {
+            if (entry.m_Shader == shader && entry.m_References > 0) {
+                --entry.m_References;
+                return;
+            }
+        }
+    }
+
+    void ShaderLibrary::Clear(IRenderer& renderer) {
+        if (!m_PrewarmJobs.IsDone())
+            Jobs::JobSystem::Get().Wait(m_PrewarmJobs);
+
+        for (auto& [key, entry] : m_Fullscreen)
+            renderer.DestroyFullscreenShader(entry.m_Shader);
+        m_Fullscreen.clear();
+    }
+
+} // namespace Nova::App::Rendering
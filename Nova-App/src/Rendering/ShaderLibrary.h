@@ -0,0 +1,120 @@
+#ifndef SHADERLIBRARY_H
+#define SHADERLIBRARY_H
+
+#include <span>
+#include <chrono>
+#include <vector>
+#include <cstdint>
+#include <concepts>
+#include <unordered_map>
+
+#include "Renderer/RHI/RHI_Renderer.h"
+#include "Renderer/RHI/RHI_Shaders.h"
+#include "Renderer/RHI/RHI_ShaderCompiler.h"
+
+#include "Rendering/ShaderCache.h"
+#include "Jobs/JobSystem.h"
+
+namespace Nova::App::Rendering {
+
+    // ---- Precompiled shaders ----
+    // A compiler entry point producing the SPIR-V of one stage, and a renderer entry point building a
+    // fullscreen shader from two binaries. With both, compilation goes through the ShaderCache;
+    // otherwise the renderer compiles from source and only shader objects are reused.
+    template <typename Compiler, typename Input>
+    concept ShaderBinaryCompileSupport = requires(const Input& input) {
+        { Compiler::CompileToSpirv(input) } -> std::convertible_to<std::vector<uint32_t>>;
+    };
+
+    template <typename Renderer>
+    concept FullscreenShaderFromBinarySupport = requires(Renderer& renderer, std::span<const uint32_t> code) {
+        renderer.CreateFullscreenShaderFromBinary(code, code);
+    };
+
+    // Builds the pipeline for two binaries into the renderer's pipeline cache. Must be callable from
+    // worker threads (vkCreateGraphicsPipelines is; the resulting pipeline is discarded).
+    template <typename Renderer>
+    concept FullscreenPipelinePrewarmSupport = requires(Renderer& renderer, std::span<const uint32_t> code) {
+        renderer.PrewarmFullscreenPipeline(code, code);
+    };
+
+    // Worker-thread half of a fullscreen shader: binaries into the ShaderCache and, when supported,
+    // the pipeline into the pipeline cache, so the main-thread creation later only hits caches.
+    template <typename Compiler, typename Renderer, typename Input>
+    void PrewarmFullscreenShader(Renderer& renderer, const Input& vert, const Input& frag) {
+        if constexpr (ShaderBinaryCompileSupport<Compiler, Input>) {
+            auto& cache = ShaderCache::Get();
+            const auto vertBinary = cache.GetOrCompile(ShaderCache::ComputeKey<Compiler>(vert), [&]() { return std::vector<uint32_t>(Compiler::CompileToSpirv(vert)); });
+            const auto fragBinary = cache.GetOrCompile(ShaderCache::ComputeKey<Compiler>(frag), [&]() { return std::vector<uint32_t>(Compiler::CompileToSpirv(frag)); });
+
+            if constexpr (FullscreenPipelinePrewarmSupport<Renderer>) {
+                if (vertBinary && fragBinary)
+                    renderer.PrewarmFullscreenPipeline(std::span<const uint32_t>(*vertBinary), std::span<const uint32_t>(*fragBinary));
+            }
+        }
+    }
+
+    template <typename Compiler, typename Renderer, typename Input>
+    auto CreateFullscreenShader(Renderer& renderer, const Input& vert, const Input& frag, uint64_t vertKey, uint64_t fragKey)
+        -> decltype(renderer.CreateFullscreenShader(vert, frag)) {
+        auto& cache = ShaderCache::Get();
+
+        if constexpr (ShaderBinaryCompileSupport<Compiler, Input> && FullscreenShaderFromBinarySupport<Renderer>) {
+            const auto vertBinary = cache.GetOrCompile(vertKey, [&]() { return std::vector<uint32_t>(Compiler::CompileToSpirv(vert)); });
+            const auto fragBinary = cache.GetOrCompile(fragKey, [&]() { return std::vector<uint32_t>(Compiler::CompileToSpirv(frag)); });
+            if (vertBinary && fragBinary)
+                return renderer.CreateFullscreenShaderFromBinary(std::span<const uint32_t>(*vertBinary), std::span<const uint32_t>(*fragBinary));
+        }
+
+        // Not a miss: the cache cannot serve this renderer (or the binaries failed to compile).
+        const auto start = std::chrono::steady_clock::now();
+        auto shader = renderer.CreateFullscreenShader(vert, frag);
+        cache.RecordUncached(std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
+        return shader;
+    }
+
+    // Shader objects built from cached binaries, shared by content key. Released shaders stay
+    // alive until Clear() so layers that are recreated (Play -> Stop) get them back for free.
+    class ShaderLibrary {
+    public:
+        using RHI_Shaders = Nova::Core::Renderer::RHI::RHI_Shaders;
+        using RHI_ShaderCompileInput = Nova::Core::Renderer::RHI::RHI_ShaderCompileInput;
+
+        struct FullscreenShaderDesc {
+            RHI_ShaderCompileInput m_Vertex;
+            RHI_ShaderCompileInput m_Fragment;
+        };
+
+        // Whether fullscreen shaders are built from ShaderCache binaries. Without it the renderer
+        // compiles every new shader from source; only shader objects are reused.
+        static constexpr bool IsBinaryCacheSupported() {
+            return ShaderBinaryCompileSupport<Nova::Core::Renderer::RHI::RHI_ShaderCompiler, RHI_ShaderCompileInput>
+                && FullscreenShaderFromBinarySupport<Nova::Core::Renderer::RHI::IRenderer>;
+        }
+
+        // Prepares shaders known at startup on the job system. When nothing can be done off the main
+        // thread, the shaders are created right away instead, so the cost lands before the first frame.
+        void Prewarm(Nova::Core::Renderer::RHI::IRenderer& renderer, std::vector<FullscreenShaderDesc> descs);
+
+        RHI_Shaders* AcquireFullscreen(Nova::Core::Renderer::RHI::IRenderer& renderer, const RHI_ShaderCompileInput& vert, const RHI_ShaderCompileInput& frag);
+        void Release(RHI_Shaders* shader);
+
+        // Destroys every shader; call before the renderer goes away.
+        void Clear(Nova::Core::Renderer::RHI::IRenderer& renderer);
+
+    private:
+        struct Entry {
+            RHI_Shaders* m_Shader{ nullptr };
+            uint32_t m_References{ 0 };
+            double m_CreateMs{ 0.0 };
+        };
+
+        std::unordered_map<uint64_t, Entry> m_Fullscreen;
+
+        std::vector<FullscreenShaderDesc> m_PrewarmDescs;   // read by the prewarm jobs
+        Jobs::JobCounter m_PrewarmJobs;
+    };
+
+} // namespace Nova::App::Rendering
+
+#endif // SHADERLIBRARY_H
@@ -0,0 +1,124 @@
+#include "Rendering/VertexPacking.h"
+
+#include <bit>
+#include <cmath>
+#include <algorithm>
+
+namespace Nova::App::Rendering {
+
+    namespace {
+
+        constexpr float k_UNorm16 = 65535.0f;
+        constexpr float k_SNorm16 = 32767.0f;
+
+        uint16_t QuantizeUNorm16(float value) {
+            return static_cast<uint16_t>(std::lround(std::clamp(value, 0.0f, 1.0f) * k_UNorm16));
+        }
+
+        int16_t QuantizeSNorm16(float value) {
+            return static_cast<int16_t>(std::lround(std::clamp(value, -1.0f, 1.0f) * k_SNorm16));
+        }
+
+        float SignNotZero(float value) { return value >= 0.0f ? 1.0f : -1.0f; }
+
+    } // namespace
+
+    VertexQuantization ComputeQuantization(std::span<const glm::vec3> positions) {
+        VertexQuantization quantization;
+        if (positions.empty())
+            return quantization;
+
+        glm::vec3 min = positions[0];
+        glm::vec3 max = positions[0];
+        for (const glm::vec3& p : positions) {
+            min = glm::min(min, p);
+            max = glm::max(max, p);
+        }
+
+        quantization.m_Offset = min;
+        const glm::vec3 size = max - min;
+        for (int axis = 0; axis < 3; ++axis)
+            quantization.m_Scale[axis] = size[axis] > 0.0f ? size[axis] / k_UNorm16 : 1.0f;
+        return quantization;
+    }
+
+    uint16_t FloatToHalf(float value) {
+        const uint32_t bits = std::bit_cast<uint32_t>(value);
+        const uint32_t sign = (bits >> 16) & 0x8000u;
+        const uint32_t magnitude = bits & 0x7FFFFFFFu;
+
+        if (magnitude >= 0x7F800000u)                     // inf / nan
+            return static_cast<uint16_t>(sign | 0x7C00u | (magnitude > 0x7F800000u ? 0x200u : 0u));
+        if (magnitude >= 0x477FF000u)                     // rounds past the largest half
+            return static_cast<uint16_t>(sign | 0x7C00u);
+        if (magnitude < 0x38800000u) {                    // subnormal half, or zero
+            const float scaled = std::bit_cast<float>(magnitude) * 16777216.0f;   // 2^24
+            return static_cast<uint16_t>(sign | static_cast<uint32_t>(std::lrint(scaled)));
+        }
+
+        // Round to nearest even on the 13 dropped mantissa bits.
+        const uint32_t rebased = magnitude - 0x38000000u;
+        const uint32_t rounded = rebased + 0x0FFFu + ((rebased >> 13) & 1u);
+        return static_cast<uint16_t>(sign | (rounded >> 13));
+    }
+
+    float HalfToFloat(uint16_t value) {
+        const uint32_t sign = uint32_t(value & 0x8000u) << 16;
+        const uint32_t exponent = (value >> 10) & 0x1Fu;
+        const uint32_t mantissa = value & 0x3FFu;
+
+        if (exponent == 0) {
+            const float magnitude = float(mantissa) / 16777216.0f;
+            return sign ? -magnitude : magnitude;
+        }
+        if (exponent == 31)
+            return std::bit_cast<float>(sign | 0x7F800000u | (mantissa << 13));
+        return std::bit_cast<float>(sign | ((exponent + 112) << 23) | (mantissa << 13));
+    }
+
+    glm::vec2 OctahedralEncode(const glm::vec3& normal) {
+        const float l1 = std::fabs(normal.x) + std::fabs(normal.y) + std::fabs(normal.z);
+        if (l1 <= 0.0f)
+            return glm::vec2(0.0f, 0.0f);
+
+        glm::vec2 p(normal.x / l1, normal.y / l1);
+        // The lower hemisphere is folded over the diagonals.
+        if (normal.z < 0.0f)
+            p = glm::vec2((1.0f - std::fabs(p.y)) * SignNotZero(p.x), (1.0f - std::fabs(p.x)) * SignNotZero(p.y));
+        return p;
+    }
+
+    glm::vec3 OctahedralDecode(const glm::vec2& encoded) {
+        glm::vec3 n(encoded.x, encoded.y, 1.0f - std::fabs(encoded.x) - std::fabs(encoded.y));
+        const float fold = std::max(-n.z, 0.0f);
+        n.x += n.x >= 0.0f ? -fold : fold;
+        n.y += n.y >= 0.0f ? -fold : fold;
+        return glm::normalize(n);
+    }
+
+    PackedVertex PackVertex(const glm::vec3& position, const glm::vec3& normal, const glm::vec2& uv, const VertexQuantization& quantization) {
+        PackedVertex packed;
+        for (int axis = 0; axis < 3; ++axis)
+            packed.m_Position[axis] = QuantizeUNorm16((position[axis] - quantization.m_Offset[axis]) / (quantization.m_Scale[axis] * k_UNorm16));
+
+        const glm::vec2 octahedral = OctahedralEncode(normal);
+        packed.m_Normal[0] = QuantizeSNorm16(octahedral.x);
+        packed.m_Normal[1] = QuantizeSNorm16(octahedral.y);
+
+        packed.m_UV[0] = FloatToHalf(uv.x);
+        packed.m_UV[1] = FloatToHalf(uv.y);
+        return packed;
+    }
+
+    glm::vec3 UnpackPosition(const PackedVertex& vertex, const VertexQuantization& quantization) {
+        return glm::vec3(quantization.m_Offset.x + vertex.m_Position[0] * quantization.m_Scale.x,
+                         quantization.m_Offset.y + vertex.m_Position[1] * quantization.m_Scale.y,
+                         quantization.m_Offset.z + vertex.m_Position[2] * quantization.m_Scale.z);
+    }
+
+    glm::vec3 UnpackNormal(const PackedVertex& vertex) {
+        return OctahedralDecode(glm::vec2(std::max(vertex.m_Normal[0] / k_SNorm16, -1.0f),
+                                          std::max(vertex.m_Normal[1] / k_SNorm16, -1.0f)));
+    }
+
+} // namespace Nova::App::Rendering
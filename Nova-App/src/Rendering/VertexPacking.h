@@ -0,0 +1,65 @@
+#ifndef VERTEXPACKING_H
+#define VERTEXPACKING_H
+
+#include <span>
+#include <vector>
+#include <cstdint>
+#include <type_traits>
+
+#include <glm/glm.hpp>
+
+#include "Rendering/RHICompat.h"
+
+namespace Nova::App::Rendering {
+
+    // Compressed vertex layout. CPU-side only for now: the mesh optimization benchmark measures its
+    // memory and fetch savings and precision, but meshes are still uploaded in the full layout, as
+    // the scene vertex shader (in Nova-Core) has no decode path for it.
+    //   position: 16-bit unorm per axis inside the mesh bounds, dequantized with VertexQuantization
+    //   normal:   octahedral encoding, 16-bit snorm per component
+    //   uv:       half floats
+    struct PackedVertex {
+        uint16_t m_Position[4]{};   // xyz, w unused (keeps the stride at 16 bytes)
+        int16_t  m_Normal[2]{};
+        uint16_t m_UV[2]{};
+    };
+    static_assert(std::is_trivially_copyable_v<PackedVertex>);
+    static_assert(sizeof(PackedVertex) == 16);
+
+    // position = offset + unorm16 * scale
+    struct VertexQuantization {
+        glm::vec3 m_Offset{ 0.0f };
+        glm::vec3 m_Scale{ 1.0f };
+    };
+
+    VertexQuantization ComputeQuantization(std::span<const glm::vec3> positions);
+
+    uint16_t FloatToHalf(float value);
+    float HalfToFloat(uint16_t value);
+
+    // Unit vector to the [-1, 1]^2 octahedral map and back.
+    glm::vec2 OctahedralEncode(const glm::vec3& normal);
+    glm::vec3 OctahedralDecode(const glm::vec2& encoded);
+
+    PackedVertex PackVertex(const glm::vec3& position, const glm::vec3& normal, const glm::vec2& uv, const VertexQuantization& quantization);
+    glm::vec3 UnpackPosition(const PackedVertex& vertex, const VertexQuantization& quantization);
+    glm::vec3 UnpackNormal(const PackedVertex& vertex);
+
+    template <typename Vertex>
+    std::vector<PackedVertex> PackVertices(std::span<const Vertex> vertices, VertexQuantization& quantization) {
+        std::vector<glm::vec3> positions;
+        positions.reserve(vertices.size());
+        for (const Vertex& vertex : vertices)
+            positions.push_back(VertexPosition(vertex));
+        quantization = ComputeQuantization(positions);
+
+        std::vector<PackedVertex> packed;
+        packed.reserve(vertices.size());
+        for (size_t i = 0; i < vertices.size(); ++i)
+            packed.push_back(PackVertex(positions[i], VertexNormal(vertices[i]), VertexUV(vertices[i]), quantization));
+        return packed;
+    }
+
+} // namespace Nova::App::Rendering
+
+#endif // VERTEXPACKING_H
@@ -0,0 +1,136 @@
+#include "Rendering/ViewportTargetPool.h"
+
+#include <cmath>
+#include <algorithm>
+
+namespace Nova::App::Rendering {
+
+    namespace {
+
+        uint32_t RoundUp(float value, uint32_t granularity) {
+            const uint32_t size = static_cast<uint32_t>(std::ceil(value));
+            return (size + granularity - 1) / granularity * granularity;
+        }
+
+    } // namespace
+
+    void ViewportTargetPool::SetAllocator(CreateFunction create, DestroyFunction destroy) {
+        Clear();
+        m_Create = std::move(create);
+        m_Destroy = std::move(destroy);
+    }
+
+    bool ViewportTargetPool::IsSettled(const glm::uvec2& size, Clock::time_point now) {
+        if (size != m_LastSize) {
+            m_LastSize = size;
+            m_StableSince = now;
+            return false;
+        }
+        return std::chrono::duration<double, std::milli>(now - m_StableSince).count() >= m_Settings.m_SettleMs;
+    }
+
+    const ViewportTarget* ViewportTargetPool::Acquire(const glm::uvec2& size, Clock::time_point now) {
+        if (size.x == 0 || size.y == 0 || !m_Create)
+            return nullptr;
+
+        ++m_Frame;
+        // Acquire() runs before the frame begins: a target released N calls ago was last drawn
+        // with N frames ago, whose fence the previous BeginFrame() waited on.
+        if (m_Frame > m_FramesInFlight)
+            DestroyRetired(m_Frame - m_FramesInFlight);
+
+        const bool changed = m_LastSize.x != 0 && size != m_LastSize;
+        const bool settled = IsSettled(size, now);
+
+        // Smallest pooled target the size fits in.
+        auto find = [&]() -> ViewportTarget* {
+            ViewportTarget* best = nullptr;
+            for (ViewportTarget& target : m_Targets) {
+                if (target.m_Width < size.x || target.m_Height < size.y)
+                    continue;
+                if (!best || uint64_t(target.m_Width) * target.m_Height < uint64_t(best->m_Width) * best->m_Height)
+                    best = &target;
+            }
+            return best;
+        };
+
+        ViewportTarget* target = find();
+        if (settled) {
+            // The final reallocation: the viewport keeps a tight target, and only that.
+            const bool tight = target && target->m_Width == size.x && target->m_Height == size.y;
+            for (size_t i = m_Targets.size(); i-- > 0;) {
+                if (!tight || &m_Targets[i] != target)
+                    Release(i);
+            }
+            target = tight ? &m_Targets.front() : Allocate(size.x, size.y);
+        }
+        else if (!target) {
+            // Outgrown: a bucket with room to keep growing. The very first target has nothing to
+            // grow from and is tight.
+            const bool first = m_Targets.empty();
+            const uint32_t width = first ? size.x : RoundUp(size.x * m_Settings.m_Headroom, m_Settings.m_Granularity);
+            const uint32_t height = first ? size.y : RoundUp(size.y * m_Settings.m_Headroom, m_Settings.m_Granularity);
+            target = Allocate(width, height);
+        }
+        else if (changed) {
+            ++m_Stats.m_Reused;
+        }
+
+        if (changed)
+            ++m_Stats.m_SizeChanges;
+        if (target)
+            target->m_LastUsed = m_Frame;
+        m_Stats.m_Settling = !settled;
+        return target;
+    }
+
+    ViewportTarget* ViewportTargetPool::Allocate(uint32_t width, uint32_t height) {
+        // Least recently used first, never the target in use this frame (there is none: allocation
+        // only happens when nothing pooled fits).
+        const size_t bytes = BytesOf(width, height);
+        while (!m_Targets.empty() && m_Stats.m_Bytes + bytes > m_Settings.m_MemoryCap) {
+            const auto oldest = std::min_element(m_Targets.begin(), m_Targets.end(),
+                [](const ViewportTarget& a, const ViewportTarget& b) { return a.m_LastUsed < b.m_LastUsed; });
+            Release(static_cast<size_t>(oldest - m_Targets.begin()));
+        }
+
+        const uint32_t id = m_Create(width, height);
+        if (id == 0)
+            return nullptr;
+
+        ++m_Stats.m_Allocations;
+        m_Stats.m_Bytes += bytes;
+        m_Stats.m_Targets = static_cast<uint32_t>(m_Targets.size() + 1);
+        return &m_Targets.emplace_back(ViewportTarget{ id, width, height, m_Frame });
+    }
+
+    void ViewportTargetPool::Release(size_t index) {
+        const ViewportTarget target = m_Targets[index];
+        m_Targets.erase(m_Targets.begin() + static_cast<std::ptrdiff_t>(index));
+
+        m_PendingDestroys.push_back({ target.m_Id, m_Frame });
+        ++m_Stats.m_Releases;
+        m_Stats.m_Bytes -= BytesOf(target.m_Width, target.m_Height);
+        m_Stats.m_Targets = static_cast<uint32_t>(m_Targets.size());
+        m_Stats.m_PendingDestroys = static_cast<uint32_t>(m_PendingDestroys.size());
+    }
+
+    void ViewportTargetPool::DestroyRetired(uint64_t frame) {
+        const auto retired = std::stable_partition(m_PendingDestroys.begin(), m_PendingDestroys.end(),
+            [frame](const PendingDestroy& pending) { return pending.m_Frame > frame; });
+        if (m_Destroy) {
+            for (auto it = retired; it != m_PendingDestroys.end(); ++it)
+                m_Destroy(it->m_Id);
+        }
+        m_PendingDestroys.erase(retired, m_PendingDestroys.end());
+        m_Stats.m_PendingDestroys = static_cast<uint32_t>(m_PendingDestroys.size());
+    }
+
+    void ViewportTargetPool::Clear() {
+        while (!m_Targets.empty())
+            Release(m_Targets.size() - 1);
+        DestroyRetired(UINT64_MAX);
+        m_LastSize = glm::uvec2(0, 0);
+    }
+
+} // namespace Nova::App::Rendering
@@ -0,0 +1,142 @@
+#ifndef VIEWPORTTARGETPOOL_H
+#define VIEWPORTTARGETPOOL_H
+
+#include <chrono>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <concepts>
+#include <functional>
+
+#include <glm/glm.hpp>
+
+namespace Nova::App::Rendering {
+
+    // ---- Renderer support ----
+    // Offscreen viewport targets (color + depth) created by the app. The bound target is rendered
+    // through a sub-rect: the scene is drawn into its top-left width x height, and
+    // GetViewportTextureID() returns it. DestroyViewportTarget() destroys at once: the pool only
+    // calls it once the frames in flight that used the target have retired.
+    template <typename Renderer>
+    concept ViewportTargetPoolSupport = requires(Renderer& renderer, uint32_t id, uint32_t size) {
+        { renderer.CreateViewportTarget(size, size) } -> std::convertible_to<uint32_t>;
+        renderer.DestroyViewportTarget(id);
+        renderer.BindViewportTarget(id, size, size);
+    };
+
+    struct ViewportTargetSettings {
+        uint32_t m_Granularity{ 256 };        // pooled sizes are rounded up to this, per axis
+        float    m_Headroom{ 1.25f };         // growth allowance of a target allocated while resizing
+        double   m_SettleMs{ 250.0 };         // size stability before the final, tight reallocation
+        size_t   m_MemoryCap{ 256ull * 1024 * 1024 };
+        uint32_t m_BytesPerPixel{ 8 };        // RGBA8 color + 32-bit depth
+    };
+
+    struct ViewportTarget {
+        uint32_t m_Id{ 0 };
+        uint32_t m_Width{ 0 };
+        uint32_t m_Height{ 0 };
+        uint64_t m_LastUsed{ 0 };   // Acquire() call
+    };
+
+    struct ViewportTargetStats {
+        uint32_t m_Targets{ 0 };
+        size_t   m_Bytes{ 0 };
+        uint32_t m_Allocations{ 0 };   // all time
+        uint32_t m_Releases{ 0 };
+        uint32_t m_PendingDestroys{ 0 };   // released, waiting for the frames in flight to retire
+        uint32_t m_SizeChanges{ 0 };   // frames whose size differed from the previous frame's
+        uint32_t m_Reused{ 0 };        // ... and were served without allocating
+        bool     m_Settling{ false };
+    };
+
+    // Render targets for a viewport that is being resized interactively. While the size changes,
+    // every frame is served by the smallest pooled target that holds it (rendered through a sub-rect),
+    // and only outgrowing all of them allocates, a bucket-sized target with headroom. Once the size
+    // has been stable for m_SettleMs, the viewport moves to a tight target and the rest of the pool
+    // is released. Pool memory is capped: least recently used targets go first. Released targets
+    // are destroyed once as many frames as are in flight have been acquired since.
+    class ViewportTargetPool {
+    public:
+        static constexpr uint32_t k_DefaultFramesInFlight = 2;
+
+        using Clock = std::chrono::steady_clock;
+        // Returns the new target's id, 0 on failure.
+        using CreateFunction = std::function<uint32_t(uint32_t width, uint32_t height)>;
+        using DestroyFunction = std::function<void(uint32_t id)>;
+
+        void SetAllocator(CreateFunction create, DestroyFunction destroy);
+        void SetSettings(const ViewportTargetSettings& settings) { m_Settings = settings; }
+        const ViewportTargetSettings& GetSettings() const { return m_Settings; }
+        // The renderer's frames in flight: how long a released target may still be read by the GPU.
+        void SetFramesInFlight(uint32_t frames) { m_FramesInFlight = frames; }
+
+        // Once per frame with the size to render at. Null when no target could be created.
+        const ViewportTarget* Acquire(const glm::uvec2& size, Clock::time_point now);
+        // Size-stability tracking alone, for renderers that can only resize their one target: true
+        // once `size` has been unchanged for m_SettleMs.
+        bool IsSettled(const glm::uvec2& size, Clock::time_point now);
+
+        // Destroys every target, released ones included, without waiting: the GPU must be idle.
+        void Clear();
+
+        const ViewportTargetStats& GetStats() const { return m_Stats; }
+
+    private:
+        ViewportTarget* Allocate(uint32_t width, uint32_t height);
+        void Release(size_t index);
+        // Destroys the released targets whose last frame has retired; all of them with UINT64_MAX.
+        void DestroyRetired(uint64_t frame);
+        size_t BytesOf(uint32_t width, uint32_t height) const {
+            return size_t(width) * height * m_Settings.m_BytesPerPixel;
+        }
+
+        ViewportTargetSettings m_Settings;
+        CreateFunction  m_Create;
+        DestroyFunction m_Destroy;
+
+        struct PendingDestroy {
+            uint32_t m_Id{ 0 };
+            uint64_t m_Frame{ 0 };   // Acquire() call it was released in
+        };
+
+        std::vector<ViewportTarget> m_Targets;
+        std::vector<PendingDestroy> m_PendingDestroys;
+        uint64_t m_Frame{ 0 };
+        uint32_t m_FramesInFlight{ k_DefaultFramesInFlight };
+
+        glm::uvec2 m_LastSize{ 0, 0 };
+        Clock::time_point m_StableSince{};
+
+        ViewportTargetStats m_Stats;
+    };
+
+    // The pool's allocator, bound to the renderer. Returns false when the renderer has no target
+    // pool support.
+    template <typename Renderer>
+    bool BindViewportTargetAllocator(ViewportTargetPool& pool, Renderer& renderer) {
+        if constexpr (ViewportTargetPoolSupport<Renderer>) {
+            pool.SetAllocator(
+                [&renderer](uint32_t width, uint32_t height) { return static_cast<uint32_t>(renderer.CreateViewportTarget(width, height)); },
+                [&renderer](uint32_t id) { renderer.DestroyViewportTarget(id); });
+            return true;
+        }
+        else {
+            return false;
+        }
+    }
+
+    template <typename Renderer>
+    bool BindViewportTarget(Renderer& renderer, const ViewportTarget& target, const glm::uvec2& size) {
+        if constexpr (ViewportTargetPoolSupport<Renderer>) {
+            renderer.BindViewportTarget(target.m_Id, size.x, size.y);
+            return true;
+        }
+        else {
+            return false;
+        }
+    }
+
+} // namespace Nova::App::Rendering
+
+#endif // VIEWPORTTARGETPOOL_H
@@ -0,0 +1,100 @@
+#include "Simulation/RenderSnapshot.h"
+
+#include <glm/gtc/matrix_transform.hpp>
+
+#include "Scene/ECS/Components/TransformComponent.h"
+#include "Scene/ECS/Components/MeshRendererComponent.h"
+
+#include "Profiling/Profiler.h"
+
+namespace Nova::App::Simulation {
+
+    using Nova::Core::Scene::ECS::Components::TransformComponent;
+    using Nova::Core::Scene::ECS::Components::MeshRendererComponent;
+
+    namespace {
+
+        // Translation, per-axis scale and rotation; shear from non-uniformly scaled parents is dropped.
+        void Decompose(const glm::mat4& world, RenderItem& item) {
+            item.m_Position = glm::vec3(world[3]);
+
+            glm::vec3 scale(glm::length(glm::vec3(world[0])), glm::length(glm::vec3(world[1])), glm::length(glm::vec3(world[2])));
+            if (glm::determinant(glm::mat3(world)) < 0.0f)
+                scale.x = -scale.x;
+            item.m_Scale = scale;
+
+            glm::mat3 rotation(world);
+            for (int axis = 0; axis < 3; ++axis)
+                if (scale[axis] != 0.0f)
+                    rotation[axis] /= scale[axis];
+            item.m_Rotation = glm::normalize(glm::quat_cast(rotation));
+        }
+
+    } // namespace
+
+    void ExtractRenderSnapshot(entt::registry& registry, World::TransformCache& transforms, Rendering::MaterialBlockTracker& materials, RenderSnapshot& snapshot) {
+        NV_PROFILE_SCOPE("Extract");
+
+        snapshot.m_Meshes.clear();
+        snapshot.m_Materials.clear();
+        snapshot.m_Items.clear();
+        snapshot.m_MeshIds.clear();
+        snapshot.m_MaterialIds.clear();
+
+        transforms.Update();
+        materials.Update();
+
+        auto view = registry.view<TransformComponent, MeshRendererComponent, Rendering::MaterialBlockComponent>();
+        for (auto entity : view) {
+            auto& mrc = view.get<MeshRendererComponent>(entity);
+            if (!mrc.m_MeshAsset || !mrc.m_MeshAsset->IsLoaded())
+                continue;
+
+            auto gpuMesh = mrc.m_MeshAsset->GetGPUMesh();
+            if (!gpuMesh)
+                continue;
+
+            RenderItem item;
+            item.m_Entity = entity;
+
+            const auto [mesh, newMesh] = snapshot.m_MeshIds.try_emplace(&*gpuMesh, static_cast<uint32_t>(snapshot.m_Meshes.size()));
+            if (newMesh)
+                snapshot.m_Meshes.push_back({ gpuMesh, static_cast<uint32_t>(gpuMesh->GetIndices().size()) });
+            item.m_Mesh = mesh->second;
+
+            // Blocks are repacked on the simulation side; the snapshot keeps one copy per content.
+            const auto& block = view.get<Rendering::MaterialBlockComponent>(entity);
+            item.m_Material = static_cast<uint32_t>(snapshot.m_Materials.size());
+            const auto [first, last] = snapshot.m_MaterialIds.equal_range(block.m_Hash);
+            for (auto it = first; it != last; ++it) {
+                if (Rendering::MaterialBlocksEqual(snapshot.m_Materials[it->second].m_Data, block.m_Data)) {
+                    item.m_Material = it->second;
+                    break;
+                }
+            }
+            if (item.m_Material == snapshot.m_Materials.size()) {
+                snapshot.m_MaterialIds.emplace(block.m_Hash, item.m_Material);
+                snapshot.m_Materials.push_back(block);
+            }
+
+            Decompose(transforms.GetWorldMatrix(entity), item);
+            snapshot.m_Items.push_back(item);
+        }
+    }
+
+    glm::mat4 InterpolateTransform(const RenderItem& previous, const RenderItem& current, float alpha) {
+        const glm::vec3 position = glm::mix(previous.m_Position, current.m_Position, alpha);
+        const glm::quat rotation = glm::slerp(previous.m_Rotation, current.m_Rotation, alpha);
+        const glm::vec3 scale = glm::mix(previous.m_Scale, current.m_Scale, alpha);
+        return glm::scale(glm::translate(glm::mat4(1.0f), position) * glm::mat4_cast(rotation), scale);
+    }
+
+    Nova::Core::Renderer::Graphics::Camera InterpolateCamera(const Nova::Core::Renderer::Graphics::Camera& previous, const Nova::Core::Renderer::Graphics::Camera& current, float alpha) {
+        Nova::Core::Renderer::Graphics::Camera camera = current;
+        camera.m_LookFrom = glm::mix(previous.m_LookFrom, current.m_LookFrom, alpha);
+        camera.m_LookAt = glm::mix(previous.m_LookAt, current.m_LookAt, alpha);
+        camera.m_FOV = glm::mix(previous.m_FOV, current.m_FOV, alpha);
+        return camera;
+    }
+
+} // namespace Nova::App::Simulation
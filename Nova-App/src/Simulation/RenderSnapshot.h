@@ -0,0 +1,63 @@
+#ifndef RENDERSNAPSHOT_H
+#define RENDERSNAPSHOT_H
+
+#include <chrono>
+#include <vector>
+#include <cstdint>
+#include <optional>
+#include <unordered_map>
+
+#include <glm/glm.hpp>
+#include <glm/gtc/quaternion.hpp>
+#include <entt/entt.hpp>
+
+#include "Scene/ECS/Components/CameraComponent.h"
+
+#include "Rendering/RHICompat.h"
+#include "Rendering/MaterialBlock.h"
+#include "World/TransformCache.h"
+
+namespace Nova::App::Simulation {
+
+    // World transform kept decomposed so two ticks can be interpolated.
+    struct RenderItem {
+        entt::entity m_Entity{ entt::null };
+        uint32_t  m_Mesh{ 0 };       // index into RenderSnapshot::m_Meshes
+        uint32_t  m_Material{ 0 };   // index into RenderSnapshot::m_Materials
+        glm::vec3 m_Position{ 0.0f };
+        glm::quat m_Rotation{ 1.0f, 0.0f, 0.0f, 0.0f };
+        glm::vec3 m_Scale{ 1.0f };
+    };
+
+    struct RenderMesh {
+        Rendering::GPUMeshRef m_Mesh{};
+        uint32_t m_IndexCount{ 0 };
+    };
+
+    // Everything the renderer needs from one simulation tick, and nothing else: it owns no
+    // reference into the registry, so it can be drawn while the next tick runs.
+    struct RenderSnapshot {
+        uint64_t m_Tick{ 0 };
+        std::chrono::steady_clock::time_point m_TickTime{};   // when the tick was due
+        uint64_t m_InputSequence{ 0 };                        // last input sampled by the tick
+        std::optional<Nova::Core::Renderer::Graphics::Camera> m_Camera;
+
+        std::vector<RenderMesh> m_Meshes;
+        std::vector<Rendering::MaterialBlockComponent> m_Materials;   // one per distinct material
+        std::vector<RenderItem> m_Items;
+
+        // Extraction lookups, kept with the slot to reuse their buckets.
+        std::unordered_map<const void*, uint32_t>   m_MeshIds;
+        std::unordered_multimap<uint64_t, uint32_t> m_MaterialIds;   // hash hits confirmed on content
+    };
+
+    // Refreshes the transform cache and material blocks, then copies every drawable entity
+    // (transform, mesh renderer, loaded mesh) into `snapshot`. Runs on the thread that owns the registry.
+    void ExtractRenderSnapshot(entt::registry& registry, World::TransformCache& transforms, Rendering::MaterialBlockTracker& materials, RenderSnapshot& snapshot);
+
+    glm::mat4 InterpolateTransform(const RenderItem& previous, const RenderItem& current, float alpha);
+    Nova::Core::Renderer::Graphics::Camera InterpolateCamera(const Nova::Core::Renderer::Graphics::Camera& previous, const Nova::Core::Renderer::Graphics::Camera& current, float alpha);
+
+} // namespace Nova::App::Simulation
+
+#endif // RENDERSNAPSHOT_H
@@ -0,0 +1,203 @@
+#include "Simulation/Simulation.h"
+
+#include <cmath>
+#include <algorithm>
+
+#include "Core/Assert.h"
+#include "Profiling/Profiler.h"
+
+namespace Nova::App::Simulation {
+
+    void Simulation::Start(entt::registry& registry, World::TransformCache& transforms, Rendering::MaterialBlockTracker& materials) {
+        Stop();
+
+        m_Registry = &registry;
+        m_Transforms = &transforms;
+        m_Materials = &materials;
+        m_Tick = 0;
+        m_Accumulator = 0.0f;
+        m_Snapshots.Reset();
+        m_FrameInput = m_PresentedInput = m_InputSequence.load(std::memory_order_relaxed);
+        m_SampledInput.store(m_FrameInput, std::memory_order_relaxed);
+        {
+            std::scoped_lock lock(m_StatsMutex);
+            m_Stats = {};
+            m_Stats.m_Mode = m_Mode;
+            m_WindowStart = Clock::now();
+            m_WindowTicks = m_WindowFrames = m_WindowInputs = 0;
+            m_WindowLatencyMs = m_WindowMaxLatencyMs = 0.0;
+        }
+
+        if (m_Mode == SimulationMode::Decoupled) {
+            // The first snapshot is extracted here so the first frame has something to draw.
+            const auto start = Clock::now();
+            RunTick(start);
+            m_Thread = std::jthread([this, start](std::stop_token stop) {
+                Profiling::Profiler::Get().SetThreadName("Simulation");
+                ThreadMain(stop, start + std::chrono::duration_cast<Clock::duration>(std::chrono::duration<float>(k_FixedTimestep)));
+            });
+        }
+    }
+
+    void Simulation::Stop() {
+        if (m_Thread.joinable()) {
+            m_Thread.request_stop();
+            m_Thread.join();
+        }
+        m_Registry = nullptr;
+        m_Transforms = nullptr;
+        m_Materials = nullptr;
+    }
+
+    void Simulation::ThreadMain(std::stop_token stop, Clock::time_point next) {
+        const auto step = std::chrono::duration_cast<Clock::duration>(std::chrono::duration<float>(k_FixedTimestep));
+
+        while (!stop.stop_requested()) {
+            std::this_thread::sleep_until(next);
+            RunTick(next);
+            next += step;
+
+            // Spiral-of-death guard: a tick longer than the budget must not queue up an ever growing backlog.
+            const auto now = Clock::now();
+            if (now - next > step * k_MaxTicksPerUpdate) {
+                const auto behind = static_cast<uint32_t>((now - next) / step);
+                next += step * behind;
+                std::scoped_lock lock(m_StatsMutex);
+                m_Stats.m_SkippedTicks += behind;
+            }
+        }
+    }
+
+    void Simulation::Advance(float dt) {
+        if (!m_Registry || m_Mode != SimulationMode::Coupled)
+            return;
+
+        m_Accumulator += dt;
+        uint32_t ticks = 0;
+        while (m_Accumulator >= k_FixedTimestep && ticks < k_MaxTicksPerUpdate) {
+            RunTick(Clock::now());
+            m_Accumulator -= k_FixedTimestep;
+            ++ticks;
+        }
+
+        if (m_Accumulator >= k_FixedTimestep) {
+            std::scoped_lock lock(m_StatsMutex);
+            m_Stats.m_SkippedTicks += static_cast<uint32_t>(m_Accumulator / k_FixedTimestep);
+            m_Accumulator = std::fmod(m_Accumulator, k_FixedTimestep);
+        }
+
+        m_FrameInput = m_SampledInput.load(std::memory_order_relaxed);
+    }
+
+    void Simulation::RunTick(Clock::time_point tickTime) {
+        NV_PROFILE_SCOPE("Simulation::Tick");
+        NV_ASSERT_MSG(m_Registry, "Simulation is not running.");
+
+        std::scoped_lock world(m_WorldMutex);
+
+        const uint64_t input = m_InputSequence.load(std::memory_order_acquire);
+
+        const auto start = Clock::now();
+        for (const System& system : m_Systems)
+            system(*m_Registry, k_FixedTimestep);
+        const auto simulated = Clock::now();
+
+        uint32_t items = 0;
+        if (m_Mode == SimulationMode::Decoupled) {
+            RenderSnapshot& snapshot = m_Snapshots.GetWriteSlot();
+            ExtractRenderSnapshot(*m_Registry, *m_Transforms, *m_Materials, snapshot);
+            snapshot.m_Tick = m_Tick;
+            snapshot.m_TickTime = tickTime;
+            snapshot.m_InputSequence = input;
+            {
+                std::scoped_lock lock(m_CameraMutex);
+                snapshot.m_Camera = m_SubmittedCamera;
+            }
+            items = static_cast<uint32_t>(snapshot.m_Items.size());
+            m_Snapshots.Publish();
+        }
+        else {
+            m_SampledInput.store(input, std::memory_order_relaxed);
+        }
+        const auto extracted = Clock::now();
+
+        ++m_Tick;
+
+        std::scoped_lock lock(m_StatsMutex);
+        ++m_Stats.m_Ticks;
+        ++m_WindowTicks;
+        m_Stats.m_TickMs = std::chrono::duration<double, std::milli>(simulated - start).count();
+        m_Stats.m_ExtractMs = std::chrono::duration<double, std::milli>(extracted - simulated).count();
+        m_Stats.m_Items = items;
+    }
+
+    void Simulation::RecordInput() {
+        const uint64_t sequence = m_InputSequence.load(std::memory_order_relaxed) + 1;
+        m_InputTimes[sequence % k_InputHistory] = Clock::now();
+        m_InputSequence.store(sequence, std::memory_order_release);
+    }
+
+    void Simulation::SubmitCamera(const Nova::Core::Renderer::Graphics::Camera& camera) {
+        std::scoped_lock lock(m_CameraMutex);
+        m_SubmittedCamera = camera;
+    }
+
+    std::optional<RenderFrame> Simulation::AcquireFrame() {
+        if (!IsDecoupled())
+            return std::nullopt;
+
+        m_Snapshots.Acquire();
+
+        RenderFrame frame;
+        frame.m_Current = &m_Snapshots.GetCurrent();
+        frame.m_Previous = m_Snapshots.HasPair() ? &m_Snapshots.GetPrevious() : frame.m_Current;
+
+        // Rendered one tick behind the latest snapshot, so the pair brackets the render time.
+        const auto span = frame.m_Current->m_TickTime - frame.m_Previous->m_TickTime;
+        if (span > Clock::duration::zero()) {
+            const auto renderTime = Clock::now() - span;
+            const double alpha = std::chrono::duration<double>(renderTime - frame.m_Previous->m_TickTime) / std::chrono::duration<double>(span);
+            frame.m_Alpha = static_cast<float>(std::clamp(alpha, 0.0, 1.0));
+        }
+
+        m_FrameInput = frame.m_Current->m_InputSequence;
+        return frame;
+    }
+
+    void Simulation::OnFramePresented() {
+        const auto now = Clock::now();
+
+        std::scoped_lock lock(m_StatsMutex);
+        ++m_WindowFrames;
+
+        // Inputs older than the history are no longer timed.
+        const uint64_t latest = m_FrameInput;
+        const uint64_t first = std::max(m_PresentedInput + 1, latest >= k_InputHistory ? latest - k_InputHistory + 1 : 1);
+        for (uint64_t sequence = first; sequence <= latest; ++sequence) {
+            const double latency = std::chrono::duration<double, std::milli>(now - m_InputTimes[sequence % k_InputHistory]).count();
+            m_WindowLatencyMs += latency;
+            m_WindowMaxLatencyMs = std::max(m_WindowMaxLatencyMs, latency);
+            ++m_WindowInputs;
+        }
+        m_PresentedInput = std::max(m_PresentedInput, latest);
+
+        const double elapsed = std::chrono::duration<double>(now - m_WindowStart).count();
+        if (elapsed >= 1.0) {
+            m_Stats.m_TicksPerSecond = m_WindowTicks / elapsed;
+            m_Stats.m_FramesPerSecond = m_WindowFrames / elapsed;
+            if (m_WindowInputs > 0) {
+                m_Stats.m_InputLatencyMs = m_WindowLatencyMs / m_WindowInputs;
+                m_Stats.m_MaxInputLatencyMs = m_WindowMaxLatencyMs;
+            }
+            m_WindowStart = now;
+            m_WindowTicks = m_WindowFrames = m_WindowInputs = 0;
+            m_WindowLatencyMs = m_WindowMaxLatencyMs = 0.0;
+        }
+    }
+
+    SimulationStats Simulation::GetStats() const {
+        std::scoped_lock lock(m_StatsMutex);
+        return m_Stats;
+    }
+
+} // namespace Nova::App::Simulation
@@ -0,0 +1,148 @@
+#ifndef SIMULATION_H
+#define SIMULATION_H
+
+#include <array>
+#include <mutex>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+#include <cstdint>
+#include <optional>
+#include <functional>
+
+#include <entt/entt.hpp>
+
+#include "Simulation/RenderSnapshot.h"
+#include "Simulation/SnapshotExchange.h"
+#include "World/TransformCache.h"
+#include "Rendering/MaterialBlock.h"
+
+namespace Nova::App::Simulation {
+
+    enum class SimulationMode : uint8_t {
+        Coupled,     // ticks run on the main thread before the frame; rendering reads the registry
+        Decoupled,   // ticks run on the simulation thread; rendering reads extracted snapshots
+    };
+
+    struct SimulationStats {
+        SimulationMode m_Mode{ SimulationMode::Coupled };
+        uint64_t m_Ticks{ 0 };
+        uint32_t m_SkippedTicks{ 0 };      // dropped after falling too far behind
+        double   m_TickMs{ 0.0 };          // systems, last tick
+        double   m_ExtractMs{ 0.0 };       // snapshot extraction, last tick
+        uint32_t m_Items{ 0 };             // drawables in the last snapshot
+
+        // Measured over the last second.
+        double   m_TicksPerSecond{ 0.0 };
+        double   m_FramesPerSecond{ 0.0 };
+        double   m_InputLatencyMs{ 0.0 };      // input event -> first frame presented after a tick sampled it
+        double   m_MaxInputLatencyMs{ 0.0 };
+    };
+
+    // Interpolation pair for the frame being rendered.
+    struct RenderFrame {
+        const RenderSnapshot* m_Previous{ nullptr };
+        const RenderSnapshot* m_Current{ nullptr };
+        float m_Alpha{ 1.0f };
+    };
+
+    // Fixed-timestep simulation of the scene registry, run while playing.
+    //
+    // Coupled, the due ticks run at the start of the main-thread update and the frame renders the
+    // registry as the last tick left it. Decoupled, a dedicated thread ticks on its own clock and
+    // ends every tick by extracting a RenderSnapshot; the renderer interpolates the two latest
+    // snapshots while the next tick runs. The registry is then owned by the simulation thread:
+    // main-thread code touching it must hold LockWorld(), which ticks hold for their whole duration.
+    //
+    // Input latency is measured from RecordInput() to the first presented frame whose tick
+    // sampled that input.
+    //
+    // Game logic plugs in through AddSystem(). The editor registers none yet: until it does, a tick
+    // only refreshes the transform cache and material blocks and extracts the snapshot, which is
+    // what the threading, interpolation and latency measurements run on.
+    class Simulation {
+    public:
+        using System = std::function<void(entt::registry&, float)>;
+
+        static constexpr float    k_FixedTimestep = 1.0f / 60.0f;
+        static constexpr uint32_t k_MaxTicksPerUpdate = 5;   // beyond that, ticks are skipped
+
+        Simulation() = default;
+        ~Simulation() { Stop(); }
+
+        Simulation(const Simulation&) = delete;
+        Simulation& operator=(const Simulation&) = delete;
+
+        // Systems and mode are only changed while stopped.
+        void AddSystem(System system) { m_Systems.push_back(std::move(system)); }
+        void ClearSystems() { m_Systems.clear(); }
+        size_t GetSystemCount() const { return m_Systems.size(); }
+        SimulationMode GetMode() const { return m_Mode; }
+        void SetMode(SimulationMode mode) { m_Mode = mode; }
+
+        void Start(entt::registry& registry, World::TransformCache& transforms, Rendering::MaterialBlockTracker& materials);
+        void Stop();
+        bool IsRunning() const { return m_Registry != nullptr; }
+        bool IsDecoupled() const { return IsRunning() && m_Mode == SimulationMode::Decoupled; }
+
+        // Coupled: runs the ticks due after `dt` on the calling thread.
+        void Advance(float dt);
+
+        std::unique_lock<std::mutex> LockWorld() { return std::unique_lock<std::mutex>(m_WorldMutex); }
+
+        // ---- Main thread ----
+        void RecordInput();
+        // Camera the next decoupled tick copies into its snapshot.
+        void SubmitCamera(const Nova::Core::Renderer::Graphics::Camera& camera);
+
+        // Decoupled: picks up the latest snapshot and the interpolation factor for now.
+        std::optional<RenderFrame> AcquireFrame();
+        void OnFramePresented();
+
+        SimulationStats GetStats() const;
+
+    private:
+        using Clock = std::chrono::steady_clock;
+
+        void ThreadMain(std::stop_token stop, Clock::time_point next);
+        void RunTick(Clock::time_point tickTime);
+
+        std::vector<System> m_Systems;
+        SimulationMode m_Mode{ SimulationMode::Decoupled };
+
+        entt::registry*        m_Registry{ nullptr };
+        World::TransformCache* m_Transforms{ nullptr };
+        Rendering::MaterialBlockTracker* m_Materials{ nullptr };
+        std::mutex   m_WorldMutex;
+        std::jthread m_Thread;
+
+        // ---- Ticks ----
+        uint64_t m_Tick{ 0 };
+        float    m_Accumulator{ 0.0f };   // coupled
+        SnapshotExchange<RenderSnapshot> m_Snapshots;
+
+        // ---- Input ----
+        static constexpr uint32_t k_InputHistory = 256;
+        std::atomic<uint64_t> m_InputSequence{ 0 };
+        std::array<Clock::time_point, k_InputHistory> m_InputTimes{};   // main thread
+        std::atomic<uint64_t> m_SampledInput{ 0 };      // by the last coupled tick
+        uint64_t m_FrameInput{ 0 };                     // sampled by the state being presented
+        uint64_t m_PresentedInput{ 0 };
+        std::mutex m_CameraMutex;
+        std::optional<Nova::Core::Renderer::Graphics::Camera> m_SubmittedCamera;
+
+        // ---- Stats ----
+        mutable std::mutex m_StatsMutex;
+        SimulationStats m_Stats;
+        Clock::time_point m_WindowStart{};
+        uint32_t m_WindowTicks{ 0 };
+        uint32_t m_WindowFrames{ 0 };
+        uint32_t m_WindowInputs{ 0 };
+        double   m_WindowLatencyMs{ 0.0 };
+        double   m_WindowMaxLatencyMs{ 0.0 };
+    };
+
+} // namespace Nova::App::Simulation
+
+#endif // SIMULATION_H
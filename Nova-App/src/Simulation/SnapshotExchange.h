@@ -0,0 +1,67 @@
+#ifndef SNAPSHOTEXCHANGE_H
+#define SNAPSHOTEXCHANGE_H
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+namespace Nova::App::Simulation {
+
+    // Lock-free hand-off of whole snapshots from one writer thread to one reader thread.
+    //
+    // Four slots: the one being written, the latest published one, and the two the reader holds
+    // (previous and current, for interpolation). Publishing swaps the written slot with the
+    // published one; acquiring swaps the reader's previous slot with the published one when it is
+    // newer. Neither side ever waits, and an unread snapshot is simply overwritten by the next.
+    template <typename T>
+    class SnapshotExchange {
+    public:
+        // ---- Writer ----
+        T& GetWriteSlot() { return m_Slots[m_Write]; }
+
+        void Publish() {
+            m_Write = m_Published.exchange(m_Write | k_Fresh, std::memory_order_acq_rel) & k_IndexMask;
+        }
+
+        // ---- Reader ----
+        // Returns true when a newer snapshot became current.
+        bool Acquire() {
+            if ((m_Published.load(std::memory_order_relaxed) & k_Fresh) == 0)
+                return false;
+
+            const uint32_t fresh = m_Published.exchange(m_Previous, std::memory_order_acq_rel) & k_IndexMask;
+            m_Previous = m_Current;
+            m_Current = fresh;
+            ++m_Acquired;
+            return true;
+        }
+
+        // Both are valid once Acquire() returned true twice.
+        bool HasPair() const { return m_Acquired >= 2; }
+        const T& GetPrevious() const { return m_Slots[m_Previous]; }
+        const T& GetCurrent() const { return m_Slots[m_Current]; }
+
+        // Not thread safe: only while the writer is stopped.
+        void Reset() {
+            m_Write = 0;
+            m_Published.store(1, std::memory_order_relaxed);
+            m_Previous = 2;
+            m_Current = 3;
+            m_Acquired = 0;
+        }
+
+    private:
+        static constexpr uint32_t k_Fresh = 0x4u;
+        static constexpr uint32_t k_IndexMask = 0x3u;
+
+        std::array<T, 4> m_Slots{};
+        uint32_t m_Write{ 0 };                  // writer only
+        std::atomic<uint32_t> m_Published{ 1 };
+        uint32_t m_Previous{ 2 };               // reader only
+        uint32_t m_Current{ 3 };
+        uint64_t m_Acquired{ 0 };
+    };
+
+} // namespace Nova::App::Simulation
+
+#endif // SNAPSHOTEXCHANGE_H
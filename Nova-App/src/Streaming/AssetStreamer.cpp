@@ -0,0 +1,280 @@
+#include "Streaming/AssetStreamer.h"
+
+#include <format>
+#include <thread>
+#include <utility>
+#include <vector>
+#include <fstream>
+#include <algorithm>
+#include <filesystem>
+
+#include "Core/Log.h"
+
+namespace Nova::App::Streaming {
+
+    uint64_t PrefetchFile(const std::string& path) {
+        std::error_code error;
+        if (!std::filesystem::is_regular_file(path, error))
+            return 0;
+
+        std::ifstream file(path, std::ios::binary);
+        if (!file)
+            return 0;
+
+        static thread_local std::vector<char> s_Buffer(1024 * 1024);
+
+        uint64_t total = 0;
+        while (file.read(s_Buffer.data(), static_cast<std::streamsize>(s_Buffer.size())) || file.gcount() > 0)
+            total += static_cast<uint64_t>(file.gcount());
+        return total;
+    }
+
+    AssetStreamer::AssetStreamer()
+        : m_Ring(k_DefaultStagingCapacity) {}
+
+    AssetStreamer& AssetStreamer::Get() {
+        static AssetStreamer s_Instance;
+        return s_Instance;
+    }
+
+    void AssetStreamer::Enqueue(const std::shared_ptr<StreamRequest>& request) {
+        m_Requests[request->GetPath()] = request;
+        ++m_Stats.m_Requested;
+        ++m_Stats.m_InFlight;
+
+        auto& jobs = Jobs::JobSystem::Get();
+        if (!jobs.IsInitialized()) {
+            Prepare(request);
+            return;
+        }
+
+        jobs.Submit([this, request]() { Prepare(request); }, &m_DecodeJobs);
+    }
+
+    void AssetStreamer::Prepare(const std::shared_ptr<StreamRequest>& request) {
+        request->m_Decoded = request->Decode();
+        m_BytesRead.fetch_add(request->m_BytesRead, std::memory_order_relaxed);
+
+        const size_t stagingSize = request->m_Decoded ? request->GetStagingSize() : 0;
+        {
+            std::lock_guard lock(m_Mutex);
+
+            if (stagingSize > 0) {
+                request->m_Staging = m_Ring.Allocate(stagingSize);
+
+                // Ring full: Update() retries once frames retire. Payloads larger than the whole
+                // ring skip staging and are loaded synchronously.
+                if (!request->m_Staging.IsValid() && stagingSize <= m_Ring.GetCapacity()) {
+                    m_WaitingForStaging.push_back(request);
+                    return;
+                }
+            }
+
+            m_Ready.push_back(request);
+        }
+
+        if (request->m_Staging.IsValid())
+            request->WriteStaging(request->m_Staging.Span());
+        request->m_Prepared.store(true, std::memory_order_release);
+    }
+
+    void AssetStreamer::Complete(const std::shared_ptr<StreamRequest>& pending) {
+        using Clock = StreamRequest::Clock;
+
+        StreamRequest& request = *pending;
+        bool loaded = false;
+        double uploadMs = 0.0;
+        if (request.m_Decoded) {
+            const auto start = Clock::now();
+            loaded = request.Upload(request.m_Staging.IsValid() ? request.m_Staging.Span() : std::span<std::byte>{});
+            uploadMs = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+        }
+
+        // A synchronous Load() parsed the file too: its time and bytes are no upload bandwidth.
+        if (request.IsSynchronousLoad()) {
+            m_Stats.m_SyncLoadMs += uploadMs;
+            if (loaded)
+                ++m_Stats.m_SyncLoads;
+        }
+        else {
+            m_Stats.m_UploadMs += uploadMs;
+        }
+
+        if (loaded) {
+            if (!request.IsSynchronousLoad()) {
+                const uint64_t bytes = request.GetUploadedBytes();
+                m_Stats.m_BytesUploaded += bytes;
+                m_Stats.m_BytesUploadedThisFrame += bytes;
+                ++m_Stats.m_UploadsThisFrame;
+            }
+
+            const double latency = std::chrono::duration<double, std::milli>(Clock::now() - request.m_RequestTime).count();
+            ++m_Stats.m_Completed;
+            m_Stats.m_LastLatencyMs = latency;
+            m_Stats.m_MaxLatencyMs = std::max(m_Stats.m_MaxLatencyMs, latency);
+            m_Stats.m_AverageLatencyMs += (latency - m_Stats.m_AverageLatencyMs) / m_Stats.m_Completed;
+
+            if (request.IsCookedLoad())
+                ++m_Stats.m_CookedLoads;
+            CountLODs(request.GetLODLevels());
+
+            if (m_CookOnLoad && request.NeedsCook()) {
+                auto cook = [this, pending]() {
+                    if (!pending->Cook())
+                        return;
+                    m_MeshesCooked.fetch_add(1, std::memory_order_relaxed);
+
+                    // The levels simplified while cooking are uploaded by the next Update().
+                    std::lock_guard lock(m_Mutex);
+                    m_Cooked.push_back(pending);
+                };
+
+                auto& jobs = Jobs::JobSystem::Get();
+                if (jobs.IsInitialized())
+                    jobs.Submit(cook, &m_DecodeJobs);
+                else
+                    cook();
+            }
+        }
+        else {
+            ++m_Stats.m_Failed;
+            NV_LOG_ERROR(std::format("Failed to stream asset '{}'", request.GetPath()));
+        }
+
+        --m_Stats.m_InFlight;
+        m_Requests.erase(request.GetPath());
+        request.m_State.store(loaded ? LoadState::Ready : LoadState::Failed, std::memory_order_release);
+    }
+
+    uint32_t AssetStreamer::UploadReady(size_t budget) {
+        uint32_t completed = 0;
+        size_t spent = 0;
+
+        for (;;) {
+            std::shared_ptr<StreamRequest> request;
+            {
+                std::lock_guard lock(m_Mutex);
+
+                // Strictly in order: staging memory is released in allocation order.
+                if (m_Ready.empty() || !m_Ready.front()->m_Prepared.load(std::memory_order_acquire))
+                    break;
+
+                // Without a staged or cooked payload the size is unknown until Load() ran: give it the whole frame.
+                const size_t uploadSize = m_Ready.front()->GetUploadSize();
+                const size_t cost = uploadSize > 0 ? uploadSize : budget;
+
+                // The first upload of a frame always goes through so oversized assets still make progress.
+                if (spent > 0 && cost > budget - spent)
+                    break;
+
+                spent += std::min(cost, budget - spent);
+                request = std::move(m_Ready.front());
+                m_Ready.pop_front();
+            }
+
+            Complete(request);
+            ++completed;
+
+            // Only what was consumed is fenced: requests still queued past the budget keep their staging
+            // live until the frame that uploads them.
+            if (request->m_Staging.IsValid()) {
+                std::lock_guard lock(m_Mutex);
+                m_Ring.FenceFrame(m_Frame, request->m_Staging.m_End);
+            }
+        }
+
+        return completed;
+    }
+
+    void AssetStreamer::Update() {
+        ++m_Frame;
+        m_Stats.m_BytesUploadedThisFrame = 0;
+        m_Stats.m_UploadsThisFrame = 0;
+
+        std::vector<std::shared_ptr<StreamRequest>> staged;
+        {
+            std::lock_guard lock(m_Mutex);
+
+            if (m_Frame > m_FramesInFlight)
+                m_Ring.Retire(m_Frame - m_FramesInFlight);
+
+            while (!m_WaitingForStaging.empty()) {
+                auto& request = m_WaitingForStaging.front();
+                request->m_Staging = m_Ring.Allocate(request->GetStagingSize());
+                if (!request->m_Staging.IsValid())
+                    break;
+
+                m_Ready.push_back(request);
+                staged.push_back(std::move(request));
+                m_WaitingForStaging.pop_front();
+            }
+        }
+
+        for (auto& request : staged) {
+            request->WriteStaging(request->m_Staging.Span());
+            request->m_Prepared.store(true, std::memory_order_release);
+        }
+
+        std::vector<std::shared_ptr<StreamRequest>> cooked;
+        {
+            std::lock_guard lock(m_Mutex);
+            cooked.swap(m_Cooked);
+        }
+        for (auto& request : cooked)
+            CountLODs(request->UploadCookedLODs());
+
+        UploadReady(m_UploadBudget);
+
+        std::lock_guard lock(m_Mutex);
+        m_Stats.m_BytesRead = m_BytesRead.load(std::memory_order_relaxed);
+        m_Stats.m_MeshesCooked = m_MeshesCooked.load(std::memory_order_relaxed);
+        m_Stats.m_StagingUsed = m_Ring.GetUsed();
+        m_Stats.m_StagingCapacity = m_Ring.GetCapacity();
+        m_Stats.m_UploadBudget = m_UploadBudget;
+    }
+
+    void AssetStreamer::CountLODs(uint32_t levels) {
+        if (levels == 0)
+            return;
+        ++m_Stats.m_LODChains;
+        m_Stats.m_LODLevelsUploaded += levels;
+    }
+
+    void AssetStreamer::Finish(StreamRequest& request) {
+        auto& jobs = Jobs::JobSystem::Get();
+
+        while (request.GetState() == LoadState::Loading) {
+            if (jobs.IsInitialized())
+                jobs.RunPending(1);
+
+            {
+                // Cannot wait for frames to retire here: let stalled payloads bypass the ring.
+                std::lock_guard lock(m_Mutex);
+                for (auto& waiting : m_WaitingForStaging) {
+                    m_Ready.push_back(waiting);
+                    waiting->m_Prepared.store(true, std::memory_order_release);
+                }
+                m_WaitingForStaging.clear();
+            }
+
+            if (UploadReady(SIZE_MAX) == 0 && request.GetState() == LoadState::Loading)
+                std::this_thread::yield();
+        }
+    }
+
+    void AssetStreamer::Shutdown() {
+        auto& jobs = Jobs::JobSystem::Get();
+        if (jobs.IsInitialized())
+            jobs.Wait(m_DecodeJobs);
+
+        std::lock_guard lock(m_Mutex);
+        m_Ready.clear();
+        m_WaitingForStaging.clear();
+        m_Cooked.clear();
+        m_Requests.clear();
+        m_Ring.FenceFrame(m_Frame);
+        m_Ring.Retire(UINT64_MAX);
+        m_Stats.m_InFlight = 0;
+    }
+
+} // namespace Nova::App::Streaming
@@ -0,0 +1,413 @@
+#ifndef ASSETSTREAMER_H
+#define ASSETSTREAMER_H
+
+#include <span>
+#include <deque>
+#include <vector>
+#include <mutex>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <format>
+#include <cstdint>
+#include <concepts>
+#include <type_traits>
+#include <unordered_map>
+
+#include "Asset/AssetManager.h"
+
+#include "Jobs/JobSystem.h"
+#include "Rendering/MeshLOD.h"
+#include "Streaming/StagingRing.h"
+#include "Streaming/CookedMesh.h"
+
+namespace Nova::App::Streaming {
+
+    template <typename TAsset>
+    using AssetRef = std::remove_cvref_t<decltype(Nova::Core::Asset::AssetManager::Get().Acquire<TAsset>(std::string{}).GetAssetRef())>;
+
+    // Optional split load path. Decode() reads and decodes the asset on any thread, WriteStaging()
+    // copies the GPU payload into staging memory and Upload() creates the GPU resources from it on
+    // the main thread. Assets without it have their file prefetched on a worker and are finished
+    // by their regular Load(), one per frame at most: parsing and decoding stay on the main thread.
+    // MeshAsset has no split path, so an uncooked mesh is not streamed; it never touches the staging
+    // ring and is counted apart (StreamingStats::m_SyncLoads). Only cooked meshes skip the decode.
+    template <typename TAsset>
+    concept StagedAssetLoad = requires(TAsset& asset, std::span<std::byte> staging, std::span<const std::byte> upload) {
+        { asset.Decode() } -> std::convertible_to<bool>;
+        { asset.GetStagingSize() } -> std::convertible_to<size_t>;
+        asset.WriteStaging(staging);
+        { asset.Upload(upload) } -> std::convertible_to<bool>;
+    };
+
+    // Optional cooked path: the GPU mesh is created straight from vertex/index bytes in its GPU
+    // layout, which a cooked .nvmesh provides from a file mapping without any decode or copy.
+    template <typename TAsset>
+    concept CookedMeshUpload = requires(TAsset& asset, std::span<const std::byte> vertices, std::span<const std::byte> indices) {
+        { asset.Upload(vertices, indices) } -> std::convertible_to<bool>;
+        asset.GetGPUMesh()->GetVertices()[0];
+        asset.GetGPUMesh()->GetIndices()[0];
+    };
+
+    // Loaded meshes that can be written out as .nvmesh for the next run.
+    template <typename TAsset>
+    concept CookableMesh = requires(TAsset& asset) {
+        { asset.GetGPUMesh() } -> std::convertible_to<Rendering::GPUMeshRef>;
+    };
+
+    enum class LoadState : uint8_t {
+        Loading,
+        Ready,
+        Failed
+    };
+
+    struct StreamingStats {
+        uint32_t m_Requested{ 0 };
+        uint32_t m_Completed{ 0 };
+        uint32_t m_Failed{ 0 };
+        uint32_t m_InFlight{ 0 };
+        uint32_t m_CookedLoads{ 0 };            // served from a mapped .nvmesh
+        uint32_t m_MeshesCooked{ 0 };
+        uint32_t m_LODChains{ 0 };              // meshes registered with simplified levels
+        uint32_t m_LODLevelsUploaded{ 0 };
+
+        uint64_t m_BytesRead{ 0 };              // by the workers
+        uint64_t m_BytesUploaded{ 0 };          // staged and cooked uploads
+        uint64_t m_BytesUploadedThisFrame{ 0 };
+        uint32_t m_UploadsThisFrame{ 0 };
+        double   m_UploadMs{ 0.0 };             // main-thread time spent uploading, all frames
+        // Finished by the asset's own Load() on the main thread, decode included; not in the upload figures.
+        uint32_t m_SyncLoads{ 0 };
+        double   m_SyncLoadMs{ 0.0 };
+
+        // Acquire() to Ready.
+        double m_LastLatencyMs{ 0.0 };
+        double m_AverageLatencyMs{ 0.0 };
+        double m_MaxLatencyMs{ 0.0 };
+
+        size_t m_StagingUsed{ 0 };
+        size_t m_StagingCapacity{ 0 };
+        size_t m_UploadBudget{ 0 };
+
+        double UploadBandwidthMBs() const {
+            return m_UploadMs > 0.0 ? (m_BytesUploaded / (1024.0 * 1024.0)) / (m_UploadMs * 1e-3) : 0.0;
+        }
+    };
+
+    // Reads a file-backed asset path once so a later Load() hits the OS cache. Returns the bytes read
+    // (0 for virtual paths such as Engine://).
+    uint64_t PrefetchFile(const std::string& path);
+
+    // Type-erased in-flight load.
+    class StreamRequest {
+    public:
+        using Clock = std::chrono::steady_clock;
+
+        explicit StreamRequest(std::string path) : m_Path(std::move(path)), m_RequestTime(Clock::now()) {}
+        virtual ~StreamRequest() = default;
+
+        // Worker thread. Returns false when the asset could not be read or decoded.
+        virtual bool Decode() = 0;
+        // Staging bytes the upload needs; 0 when the asset has no staged path.
+        virtual size_t GetStagingSize() const = 0;
+        virtual void WriteStaging(std::span<std::byte> staging) = 0;
+        // Bytes Upload() will push to the GPU, if known in advance; 0 otherwise.
+        virtual size_t GetUploadSize() const = 0;
+        // Main thread. An empty `staging` means the payload did not go through the ring: load synchronously.
+        virtual bool Upload(std::span<const std::byte> staging) = 0;
+        virtual size_t GetUploadedBytes() const = 0;
+
+        bool IsCookedLoad() const { return m_CookedLoad; }
+        // Set by Upload() when the asset went through its regular Load() instead.
+        bool IsSynchronousLoad() const { return m_SyncLoad; }
+        // Simplified levels uploaded with a cooked load.
+        virtual uint32_t GetLODLevels() const = 0;
+        // Set by Upload() when the asset was loaded the slow way and has no cooked file yet.
+        bool NeedsCook() const { return m_NeedsCook; }
+        // Worker thread.
+        virtual bool Cook() = 0;
+        // Main thread, once Cook() succeeded: uploads the levels it simplified. Returns how many.
+        virtual uint32_t UploadCookedLODs() = 0;
+
+        LoadState GetState() const { return m_State.load(std::memory_order_acquire); }
+        const std::string& GetPath() const { return m_Path; }
+
+    protected:
+        friend class AssetStreamer;
+
+        std::string m_Path;
+        Clock::time_point m_RequestTime;
+        uint64_t m_BytesRead{ 0 };
+
+        std::atomic<LoadState> m_State{ LoadState::Loading };
+        std::atomic<bool> m_Prepared{ false };   // decoded and staged, ready for Upload()
+        bool m_Decoded{ false };
+        bool m_CookedLoad{ false };
+        bool m_SyncLoad{ false };
+        bool m_NeedsCook{ false };
+        StagingRing::Allocation m_Staging;
+    };
+
+    template <typename TAsset>
+    class TypedStreamRequest final : public StreamRequest {
+    public:
+        TypedStreamRequest(std::string path, AssetRef<TAsset> asset) : StreamRequest(std::move(path)), m_Asset(std::move(asset)) {}
+
+        bool Decode() override {
+            if constexpr (StagedAssetLoad<TAsset>)
+                return m_Asset->Decode();
+            else {
+                if constexpr (CookedMeshUpload<TAsset>) {
+                    if (OpenCooked()) {
+                        m_BytesRead = m_Cooked.GetFileSize();
+                        return true;
+                    }
+                }
+                m_BytesRead = PrefetchFile(m_Path);
+                return true;
+            }
+        }
+
+        size_t GetStagingSize() const override {
+            if constexpr (StagedAssetLoad<TAsset>)
+                return m_Asset->GetStagingSize();
+            else
+                return 0;
+        }
+
+        void WriteStaging(std::span<std::byte> staging) override {
+            if constexpr (StagedAssetLoad<TAsset>)
+                m_Asset->WriteStaging(staging);
+        }
+
+        size_t GetUploadSize() const override {
+            if constexpr (StagedAssetLoad<TAsset>)
+                return m_Asset->GetStagingSize();
+            else if (m_Cooked.IsOpen())
+                return m_Cooked.GetVertexData().size() + m_Cooked.GetIndexData().size();
+            else
+                return 0;
+        }
+
+        bool Upload(std::span<const std::byte> staging) override {
+            if constexpr (StagedAssetLoad<TAsset>) {
+                if (!staging.empty())
+                    return m_Asset->Upload(staging);
+            }
+            if constexpr (CookedMeshUpload<TAsset>) {
+                if (m_Cooked.IsOpen()) {
+                    const bool uploaded = m_Asset->Upload(m_Cooked.GetVertexData(), m_Cooked.GetIndexData());
+                    if (uploaded)
+                        m_LODLevels = UploadLODs();
+                    m_Cooked.Close();
+                    m_CookedLoad = uploaded;
+                    if (uploaded)
+                        return true;
+                }
+            }
+
+            // Getting here means the cooked file is missing, stale or from an older version: write it again.
+            m_SyncLoad = true;
+            m_Asset->Load();
+            if constexpr (CookableMesh<TAsset>)
+                m_NeedsCook = m_Asset->IsLoaded();
+            return m_Asset->IsLoaded();
+        }
+
+        bool Cook() override {
+            if constexpr (CookableMesh<TAsset>)
+                return CookMesh(m_Path, m_Asset->GetGPUMesh());
+            else
+                return false;
+        }
+
+        uint32_t UploadCookedLODs() override {
+            if constexpr (CookedMeshUpload<TAsset>) {
+                if (!OpenCooked())
+                    return 0;
+                const uint32_t levels = UploadLODs();
+                m_Cooked.Close();
+                return levels;
+            }
+            else
+                return 0;
+        }
+
+        uint32_t GetLODLevels() const override { return m_LODLevels; }
+
+        size_t GetUploadedBytes() const override {
+            if constexpr (StagedAssetLoad<TAsset>)
+                return m_Asset->GetStagingSize();
+            else if constexpr (requires { m_Asset->GetGPUMesh()->GetVertices(); m_Asset->GetGPUMesh()->GetIndices(); }) {
+                const auto mesh = m_Asset->GetGPUMesh();
+                if (!mesh)
+                    return 0;
+                const auto& vertices = mesh->GetVertices();
+                const auto& indices = mesh->GetIndices();
+                return vertices.size() * sizeof(vertices[0]) + indices.size() * sizeof(indices[0]);
+            }
+            else
+                return 0;
+        }
+
+    private:
+        // Each simplified level of the mapped cooked file becomes a mesh asset of its own
+        // ("<path>#lod<n>"); the chain is registered against the full-detail GPU mesh.
+        uint32_t UploadLODs() {
+            const uint32_t count = m_Cooked.GetLODCount();
+            const auto mesh = m_Asset->GetGPUMesh();
+            if (count == 0 || !mesh)
+                return 0;
+
+            Rendering::MeshLODChain chain;
+            chain.m_Levels.push_back({ mesh, static_cast<uint32_t>(mesh->GetIndices().size()), 0.0f });
+            for (uint32_t i = 0; i < count; ++i) {
+                auto level = Nova::Core::Asset::AssetManager::Get().Acquire<TAsset>(std::format("{}#lod{}", m_Path, i + 1)).GetAssetRef();
+                if (!level->Upload(m_Cooked.GetLODVertexData(i), m_Cooked.GetLODIndexData(i)))
+                    break;
+                const CookedMeshLOD& lod = m_Cooked.GetLOD(i);
+                chain.m_Levels.push_back({ level->GetGPUMesh(), lod.m_IndexCount, lod.m_Error });
+            }
+
+            const uint32_t uploaded = static_cast<uint32_t>(chain.m_Levels.size() - 1);
+            Rendering::MeshLODLibrary::Get().Register(mesh, std::move(chain));
+            return uploaded;
+        }
+
+        // Maps the cooked file for this path, unless it is missing, stale or laid out differently.
+        bool OpenCooked() {
+            using Vertex = std::remove_cvref_t<decltype(m_Asset->GetGPUMesh()->GetVertices()[0])>;
+            using Index = std::remove_cvref_t<decltype(m_Asset->GetGPUMesh()->GetIndices()[0])>;
+
+            const std::string cookedPath = GetCookedMeshPath(m_Path);
+            if (!m_Cooked.Open(cookedPath, sizeof(Vertex), sizeof(Index)))
+                return false;
+
+            // Covers edits to a source file and cook or generator changes for virtual paths alike.
+            if (m_Cooked.GetHeader().m_SourceHash != HashCookSource(m_Path))
+                m_Cooked.Close();
+            return m_Cooked.IsOpen();
+        }
+
+        AssetRef<TAsset> m_Asset;
+        CookedMesh m_Cooked;
+        uint32_t m_LODLevels{ 0 };
+    };
+
+    // What Acquire() returns: the asset reference right away, plus the state of its load.
+    template <typename TAsset>
+    class StreamHandle {
+    public:
+        StreamHandle(AssetRef<TAsset> asset, std::shared_ptr<StreamRequest> request)
+            : m_Asset(std::move(asset)), m_Request(std::move(request)) {}
+
+        const AssetRef<TAsset>& GetAssetRef() const { return m_Asset; }
+        LoadState GetState() const { return m_Request ? m_Request->GetState() : LoadState::Ready; }
+        bool IsReady() const { return GetState() == LoadState::Ready; }
+
+    private:
+        friend class AssetStreamer;
+
+        AssetRef<TAsset> m_Asset;
+        std::shared_ptr<StreamRequest> m_Request;   // null when the asset was already loaded
+    };
+
+    // Asynchronous front end for AssetManager. Acquire() returns immediately; reads and decodes run
+    // on the job system, and GPU uploads are finished on the main thread by Update() within a
+    // per-frame byte budget, going through a staging ring that is recycled once frames retire.
+    class AssetStreamer {
+    public:
+        static constexpr size_t   k_DefaultStagingCapacity = 64ull * 1024 * 1024;
+        static constexpr size_t   k_DefaultUploadBudget = 8ull * 1024 * 1024;
+        static constexpr uint64_t k_DefaultFramesInFlight = 2;
+
+        AssetStreamer();
+
+        static AssetStreamer& Get();
+
+        // Main thread only.
+        template <typename TAsset>
+        StreamHandle<TAsset> Acquire(const std::string& path) {
+            auto asset = Nova::Core::Asset::AssetManager::Get().Acquire<TAsset>(path).GetAssetRef();
+            m_AssetPaths.insert_or_assign(static_cast<const void*>(&*asset), path);
+
+            if (auto it = m_Requests.find(path); it != m_Requests.end())
+                return { std::move(asset), it->second };
+            if (asset->IsLoaded())
+                return { std::move(asset), nullptr };
+
+            auto request = std::make_shared<TypedStreamRequest<TAsset>>(path, asset);
+            Enqueue(request);
+            return { std::move(asset), std::move(request) };
+        }
+
+        // Same as Acquire(), but the asset is loaded (or has failed) when this returns.
+        template <typename TAsset>
+        AssetRef<TAsset> AcquireBlocking(const std::string& path) {
+            auto handle = Acquire<TAsset>(path);
+            if (handle.m_Request)
+                Finish(*handle.m_Request);
+            return handle.GetAssetRef();
+        }
+
+        // Path an asset was acquired with, for serializing references. Null for assets that did not
+        // come through the streamer.
+        template <typename TAssetRef>
+        const std::string* FindAssetPath(const TAssetRef& asset) const {
+            if (!asset)
+                return nullptr;
+            auto it = m_AssetPaths.find(static_cast<const void*>(&*asset));
+            return it != m_AssetPaths.end() ? &it->second : nullptr;
+        }
+
+        // Once per frame on the main thread: retires staging memory and uploads what fits in the budget.
+        void Update();
+
+        // Waits for outstanding decode jobs and drops everything still queued.
+        void Shutdown();
+
+        // Meshes loaded without a cooked file get one written in the background for the next run.
+        void SetCookOnLoad(bool enabled) { m_CookOnLoad = enabled; }
+        bool IsCookOnLoadEnabled() const { return m_CookOnLoad; }
+
+        void SetUploadBudget(size_t bytesPerFrame) { m_UploadBudget = bytesPerFrame; }
+        size_t GetUploadBudget() const { return m_UploadBudget; }
+
+        // Staging is recycled this many frames after the frame that uploaded it: the renderer's frames in flight.
+        void SetFramesInFlight(uint64_t frames) { m_FramesInFlight = frames; }
+
+        const StreamingStats& GetStats() const { return m_Stats; }
+
+    private:
+        void Enqueue(const std::shared_ptr<StreamRequest>& request);
+        void Prepare(const std::shared_ptr<StreamRequest>& request);
+        void Complete(const std::shared_ptr<StreamRequest>& request);
+        // Uploads prepared requests in order until the budget is spent. Returns how many completed.
+        uint32_t UploadReady(size_t budget);
+        void Finish(StreamRequest& request);
+        void CountLODs(uint32_t levels);
+
+        std::unordered_map<std::string, std::shared_ptr<StreamRequest>> m_Requests;   // in flight, by path
+        std::unordered_map<const void*, std::string> m_AssetPaths;                     // every acquired asset
+
+        std::mutex m_Mutex;   // guards the ring and both queues
+        StagingRing m_Ring;
+        std::deque<std::shared_ptr<StreamRequest>> m_Ready;          // in staging allocation order
+        std::deque<std::shared_ptr<StreamRequest>> m_WaitingForStaging;
+        std::vector<std::shared_ptr<StreamRequest>> m_Cooked;        // cooked this run, levels not uploaded yet
+
+        Jobs::JobCounter m_DecodeJobs;
+        std::atomic<uint64_t> m_BytesRead{ 0 };
+        std::atomic<uint32_t> m_MeshesCooked{ 0 };
+        bool m_CookOnLoad{ true };
+
+        uint64_t m_Frame{ 0 };
+        uint64_t m_FramesInFlight{ k_DefaultFramesInFlight };
+        size_t m_UploadBudget{ k_DefaultUploadBudget };
+        StreamingStats m_Stats;
+    };
+
+} // namespace Nova::App::Streaming
+
+#endif // ASSETSTREAMER_H
@@ -0,0 +1,240 @@
+#include "Streaming/CookedMesh.h"
+
+#include <format>
+#include <fstream>
+#include <vector>
+#include <cstring>
+#include <algorithm>
+#include <filesystem>
+
+#include "Core/Log.h"
+#include "Common/Hash.h"
+#include "Rendering/MeshLOD.h"
+#include "Rendering/MeshOptimizer.h"
+
+namespace Nova::App::Streaming {
+
+    namespace {
+
+        constexpr const char* k_CookedMeshDirectory = "Cache/Meshes";
+
+        uint64_t AlignUp(uint64_t value, uint64_t alignment) {
+            return (value + alignment - 1) & ~(alignment - 1);
+        }
+
+    } // namespace
+
+    uint64_t HashAssetPath(const std::string& assetPath) {
+        return Fnv1a(assetPath);
+    }
+
+    uint64_t HashCookSource(const std::string& assetPath) {
+        uint64_t hash = Fnv1aOf(k_CookVersion, HashAssetPath(assetPath));
+
+        const Rendering::MeshLODSettings lod{};
+        hash = Fnv1aOf(lod.m_Reduction, hash);
+        hash = Fnv1aOf(lod.m_MaxError, hash);
+        hash = Fnv1aOf(lod.m_MinTriangles, hash);
+        hash = Fnv1aOf(lod.m_MinReduction, hash);
+
+        // Virtual paths have no file: they rely on k_CookVersion alone.
+        std::error_code error;
+        const uint64_t size = std::filesystem::file_size(assetPath, error);
+        if (!error) {
+            const auto written = std::filesystem::last_write_time(assetPath, error);
+            hash = Fnv1aOf(size, hash);
+            if (!error)
+                hash = Fnv1aOf(static_cast<int64_t>(written.time_since_epoch().count()), hash);
+        }
+        return hash;
+    }
+
+    std::string GetCookedMeshPath(const std::string& assetPath) {
+        return std::format("{}/{:016x}.nvmesh", k_CookedMeshDirectory, HashAssetPath(assetPath));
+    }
+
+    bool WriteCookedMesh(const std::string& cookedPath, uint64_t sourceHash,
+                         std::span<const std::byte> vertices, uint32_t vertexStride,
+                         std::span<const std::byte> indices, uint32_t indexSize,
+                         const Rendering::MeshBounds& bounds,
+                         std::span<const CookedLODBlobs> lods) {
+        lods = lods.first(std::min<size_t>(lods.size(), k_MaxCookedLODs));
+
+        CookedMeshHeader header{};
+        header.m_VertexStride = vertexStride;
+        header.m_IndexSize = indexSize;
+        header.m_VertexCount = static_cast<uint32_t>(vertices.size() / vertexStride);
+        header.m_IndexCount = static_cast<uint32_t>(indices.size() / indexSize);
+        header.m_VertexOffset = AlignUp(sizeof(CookedMeshHeader) + lods.size() * sizeof(CookedMeshLOD), k_CookedBlobAlignment);
+        header.m_IndexOffset = AlignUp(header.m_VertexOffset + vertices.size(), k_CookedBlobAlignment);
+        header.m_LODCount = static_cast<uint32_t>(lods.size());
+
+        std::vector<CookedMeshLOD> table(lods.size());
+        uint64_t end = header.m_IndexOffset + indices.size();
+        for (size_t i = 0; i < lods.size(); ++i) {
+            CookedMeshLOD& lod = table[i];
+            lod.m_VertexCount = static_cast<uint32_t>(lods[i].m_Vertices.size() / vertexStride);
+            lod.m_IndexCount = static_cast<uint32_t>(lods[i].m_Indices.size() / indexSize);
+            lod.m_VertexOffset = AlignUp(end, k_CookedBlobAlignment);
+            lod.m_IndexOffset = AlignUp(lod.m_VertexOffset + lods[i].m_Vertices.size(), k_CookedBlobAlignment);
+            lod.m_Error = lods[i].m_Error;
+            end = lod.m_IndexOffset + lods[i].m_Indices.size();
+        }
+        header.m_SourceHash = sourceHash;
+        std::memcpy(header.m_BoundsCenter, &bounds.m_Center, sizeof(header.m_BoundsCenter));
+        std::memcpy(header.m_BoundsExtents, &bounds.m_Extents, sizeof(header.m_BoundsExtents));
+        header.m_BoundsRadius = bounds.m_Radius;
+
+        std::error_code error;
+        std::filesystem::create_directories(std::filesystem::path(cookedPath).parent_path(), error);
+
+        // Written under a temporary name and renamed, so a reader never maps a half-written file.
+        const std::string temporaryPath = cookedPath + ".tmp";
+        {
+            std::ofstream file(temporaryPath, std::ios::binary | std::ios::trunc);
+            if (!file) {
+                NV_LOG_ERROR(std::format("Cannot write cooked mesh '{}'", cookedPath));
+                return false;
+            }
+
+            const char padding[k_CookedBlobAlignment]{};
+            auto pad = [&](uint64_t offset) {
+                file.write(padding, static_cast<std::streamsize>(offset - static_cast<uint64_t>(file.tellp())));
+            };
+
+            file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+            file.write(reinterpret_cast<const char*>(table.data()), static_cast<std::streamsize>(table.size() * sizeof(CookedMeshLOD)));
+            pad(header.m_VertexOffset);
+            file.write(reinterpret_cast<const char*>(vertices.data()), static_cast<std::streamsize>(vertices.size()));
+            pad(header.m_IndexOffset);
+            file.write(reinterpret_cast<const char*>(indices.data()), static_cast<std::streamsize>(indices.size()));
+            for (size_t i = 0; i < lods.size(); ++i) {
+                pad(table[i].m_VertexOffset);
+                file.write(reinterpret_cast<const char*>(lods[i].m_Vertices.data()), static_cast<std::streamsize>(lods[i].m_Vertices.size()));
+                pad(table[i].m_IndexOffset);
+                file.write(reinterpret_cast<const char*>(lods[i].m_Indices.data()), static_cast<std::streamsize>(lods[i].m_Indices.size()));
+            }
+
+            if (!file) {
+                NV_LOG_ERROR(std::format("Failed writing cooked mesh '{}'", cookedPath));
+                return false;
+            }
+        }
+
+        std::filesystem::rename(temporaryPath, cookedPath, error);
+        return !error;
+    }
+
+    bool CookMesh(const std::string& assetPath, const Rendering::GPUMeshRef& mesh) {
+        if (!mesh)
+            return false;
+
+        const auto& vertices = mesh->GetVertices();
+        const auto& indices = mesh->GetIndices();
+        using Index = std::remove_cvref_t<decltype(indices[0])>;
+
+        using Vertex = std::remove_cvref_t<decltype(vertices[0])>;
+
+        const Rendering::MeshBounds bounds = Rendering::ComputeMeshBounds(mesh);
+        auto levels = Rendering::BuildMeshLODs(std::span(vertices.data(), vertices.size()),
+                                               std::span(indices.data(), indices.size()), bounds.m_Radius);
+
+        // The GPU mesh keeps the order it was imported in; the cooked copy is what later runs draw.
+        std::vector<Vertex> baseVertices(vertices.begin(), vertices.end());
+        std::vector<uint32_t> baseIndices(indices.begin(), indices.end());
+        Rendering::OptimizeMesh(baseVertices, baseIndices);
+        for (auto& level : levels)
+            Rendering::OptimizeMesh(level.m_Vertices, level.m_Indices);
+
+        // Levels are stored with the index type of the full mesh.
+        const std::vector<Index> cookedIndices(baseIndices.begin(), baseIndices.end());
+        std::vector<std::vector<Index>> levelIndices(levels.size());
+        std::vector<CookedLODBlobs> lods(levels.size());
+        for (size_t i = 0; i < levels.size(); ++i) {
+            levelIndices[i].assign(levels[i].m_Indices.begin(), levels[i].m_Indices.end());
+            lods[i].m_Vertices = std::as_bytes(std::span(levels[i].m_Vertices));
+            lods[i].m_Indices = std::as_bytes(std::span(levelIndices[i]));
+            lods[i].m_Error = levels[i].m_Error;
+        }
+
+        return WriteCookedMesh(GetCookedMeshPath(assetPath), HashCookSource(assetPath),
+                               std::as_bytes(std::span(baseVertices)), static_cast<uint32_t>(sizeof(Vertex)),
+                               std::as_bytes(std::span(cookedIndices)), static_cast<uint32_t>(sizeof(Index)),
+                               bounds, lods);
+    }
+
+    bool CookedMesh::Open(const std::string& cookedPath, uint32_t expectedVertexStride, uint32_t expectedIndexSize) {
+        Close();
+
+        if (!m_File.Open(cookedPath))
+            return false;
+
+        const auto data = m_File.GetData();
+        if (data.size() < sizeof(CookedMeshHeader)) {
+            m_File.Close();
+            return false;
+        }
+
+        // The mapping is page aligned, so the header can be read in place.
+        const auto* header = reinterpret_cast<const CookedMeshHeader*>(data.data());
+        const uint64_t vertexBytes = uint64_t(header->m_VertexCount) * header->m_VertexStride;
+        const uint64_t indexBytes = uint64_t(header->m_IndexCount) * header->m_IndexSize;
+
+        const bool valid = header->m_Magic == CookedMeshHeader::k_Magic
+            && header->m_Version == CookedMeshHeader::k_Version
+            && header->m_VertexStride == expectedVertexStride
+            && header->m_IndexSize == expectedIndexSize
+            && header->m_VertexOffset % k_CookedBlobAlignment == 0
+            && header->m_IndexOffset % k_CookedBlobAlignment == 0
+            && header->m_VertexOffset <= data.size() && vertexBytes <= data.size() - header->m_VertexOffset
+            && header->m_IndexOffset <= data.size() && indexBytes <= data.size() - header->m_IndexOffset
+            && header->m_LODCount <= k_MaxCookedLODs
+            && sizeof(CookedMeshHeader) + header->m_LODCount * sizeof(CookedMeshLOD) <= header->m_VertexOffset;
+
+        const auto* lods = reinterpret_cast<const CookedMeshLOD*>(data.data() + sizeof(CookedMeshHeader));
+        bool lodsValid = valid;
+        for (uint32_t i = 0; lodsValid && i < header->m_LODCount; ++i) {
+            const CookedMeshLOD& lod = lods[i];
+            const uint64_t lodVertexBytes = uint64_t(lod.m_VertexCount) * header->m_VertexStride;
+            const uint64_t lodIndexBytes = uint64_t(lod.m_IndexCount) * header->m_IndexSize;
+            lodsValid = lod.m_VertexOffset % k_CookedBlobAlignment == 0
+                && lod.m_IndexOffset % k_CookedBlobAlignment == 0
+                && lod.m_VertexOffset <= data.size() && lodVertexBytes <= data.size() - lod.m_VertexOffset
+                && lod.m_IndexOffset <= data.size() && lodIndexBytes <= data.size() - lod.m_IndexOffset;
+        }
+
+        if (!lodsValid) {
+            m_File.Close();
+            return false;
+        }
+
+        m_Header = header;
+        m_LODs = lods;
+        return true;
+    }
+
+    std::span<const std::byte> CookedMesh::GetVertexData() const {
+        return m_File.GetData().subspan(m_Header->m_VertexOffset, size_t(m_Header->m_VertexCount) * m_Header->m_VertexStride);
+    }
+
+    std::span<const std::byte> CookedMesh::GetIndexData() const {
+        return m_File.GetData().subspan(m_Header->m_IndexOffset, size_t(m_Header->m_IndexCount) * m_Header->m_IndexSize);
+    }
+
+    std::span<const std::byte> CookedMesh::GetLODVertexData(uint32_t lod) const {
+        return m_File.GetData().subspan(m_LODs[lod].m_VertexOffset, size_t(m_LODs[lod].m_VertexCount) * m_Header->m_VertexStride);
+    }
+
+    std::span<const std::byte> CookedMesh::GetLODIndexData(uint32_t lod) const {
+        return m_File.GetData().subspan(m_LODs[lod].m_IndexOffset, size_t(m_LODs[lod].m_IndexCount) * m_Header->m_IndexSize);
+    }
+
+    Rendering::MeshBounds CookedMesh::GetBounds() const {
+        Rendering::MeshBounds bounds{};
+        std::memcpy(&bounds.m_Center, m_Header->m_BoundsCenter, sizeof(m_Header->m_BoundsCenter));
+        std::memcpy(&bounds.m_Extents, m_Header->m_BoundsExtents, sizeof(m_Header->m_BoundsExtents));
+        bounds.m_Radius = m_Header->m_BoundsRadius;
+        return bounds;
+    }
+
+} // namespace Nova::App::Streaming
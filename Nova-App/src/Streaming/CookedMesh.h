@@ -0,0 +1,112 @@
+#ifndef COOKEDMESH_H
+#define COOKEDMESH_H
+
+#include <span>
+#include <string>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include "Rendering/MeshBounds.h"
+#include "Streaming/MappedFile.h"
+
+namespace Nova::App::Streaming {
+
+    // Cooked mesh container (.nvmesh): a fixed header and the LOD table, followed by the vertex and
+    // index blobs of the full mesh and of each simplified level, each starting on a
+    // k_CookedBlobAlignment boundary so they can be handed to GPU staging straight from the mapping.
+    // Blobs hold the GPU layout verbatim.
+    struct CookedMeshHeader {
+        static constexpr uint32_t k_Magic = 0x48534D4E;   // "NMSH"
+        static constexpr uint32_t k_Version = 3;   // 3: blobs in vertex cache / overdraw / fetch order
+
+        uint32_t m_Magic{ k_Magic };
+        uint32_t m_Version{ k_Version };
+        uint32_t m_VertexStride{ 0 };
+        uint32_t m_IndexSize{ 0 };
+        uint32_t m_VertexCount{ 0 };
+        uint32_t m_IndexCount{ 0 };
+        uint64_t m_VertexOffset{ 0 };
+        uint64_t m_IndexOffset{ 0 };
+        uint64_t m_SourceHash{ 0 };   // HashCookSource() of the asset path the mesh was cooked from
+
+        float m_BoundsCenter[3]{};
+        float m_BoundsExtents[3]{};
+        float m_BoundsRadius{ 0.0f };
+        uint32_t m_LODCount{ 0 };   // simplified levels, in the table right after the header
+    };
+    static_assert(std::is_trivially_copyable_v<CookedMeshHeader>);
+    static_assert(sizeof(CookedMeshHeader) == 80);
+
+    struct CookedMeshLOD {
+        uint64_t m_VertexOffset{ 0 };
+        uint64_t m_IndexOffset{ 0 };
+        uint32_t m_VertexCount{ 0 };
+        uint32_t m_IndexCount{ 0 };
+        float    m_Error{ 0.0f };   // object space
+        uint32_t m_Reserved{ 0 };
+    };
+    static_assert(std::is_trivially_copyable_v<CookedMeshLOD>);
+    static_assert(sizeof(CookedMeshLOD) == 32);
+
+    inline constexpr uint32_t k_MaxCookedLODs = 8;
+
+    // Blobs of one simplified level, for WriteCookedMesh().
+    struct CookedLODBlobs {
+        std::span<const std::byte> m_Vertices;
+        std::span<const std::byte> m_Indices;
+        float m_Error{ 0.0f };
+    };
+
+    inline constexpr size_t k_CookedBlobAlignment = 256;
+
+    // Bumped whenever a cook would produce something else from the same source: a change to the
+    // simplifier or optimizer, or to the meshes the engine generates itself (Engine:// paths).
+    inline constexpr uint32_t k_CookVersion = 1;
+
+    // Where the cooked version of an asset path lives (Cache/Meshes/<hash>.nvmesh).
+    std::string GetCookedMeshPath(const std::string& assetPath);
+    uint64_t HashAssetPath(const std::string& assetPath);
+    // What a cooked file is valid for: the asset path, k_CookVersion, the default LOD settings and,
+    // for a source file on disk, its size and write time. A cooked file recording another value is stale.
+    uint64_t HashCookSource(const std::string& assetPath);
+
+    bool WriteCookedMesh(const std::string& cookedPath, uint64_t sourceHash,
+                         std::span<const std::byte> vertices, uint32_t vertexStride,
+                         std::span<const std::byte> indices, uint32_t indexSize,
+                         const Rendering::MeshBounds& bounds,
+                         std::span<const CookedLODBlobs> lods = {});
+
+    // Writes the cooked file for a loaded GPU mesh, in its GPU vertex/index layout, with its LOD
+    // chain simplified here (see BuildMeshLODs) and every level reordered by OptimizeMesh.
+    bool CookMesh(const std::string& assetPath, const Rendering::GPUMeshRef& mesh);
+
+    // A mapped, validated cooked mesh. The blob spans point into the mapping: no copies.
+    class CookedMesh {
+    public:
+        // Fails on missing files, version or layout mismatches, and truncated blobs.
+        bool Open(const std::string& cookedPath, uint32_t expectedVertexStride, uint32_t expectedIndexSize);
+        void Close() { m_File.Close(); m_Header = nullptr; m_LODs = nullptr; }
+
+        bool IsOpen() const { return m_Header != nullptr; }
+
+        const CookedMeshHeader& GetHeader() const { return *m_Header; }
+        std::span<const std::byte> GetVertexData() const;
+        std::span<const std::byte> GetIndexData() const;
+        Rendering::MeshBounds GetBounds() const;
+
+        uint32_t GetLODCount() const { return m_Header->m_LODCount; }
+        const CookedMeshLOD& GetLOD(uint32_t lod) const { return m_LODs[lod]; }
+        std::span<const std::byte> GetLODVertexData(uint32_t lod) const;
+        std::span<const std::byte> GetLODIndexData(uint32_t lod) const;
+        size_t GetFileSize() const { return m_File.GetSize(); }
+
+    private:
+        MappedFile m_File;
+        const CookedMeshHeader* m_Header{ nullptr };
+        const CookedMeshLOD* m_LODs{ nullptr };
+    };
+
+} // namespace Nova::App::Streaming
+
+#endif // COOKEDMESH_H
@@ -0,0 +1,41 @@
+#ifndef MAPPEDFILE_H
+#define MAPPEDFILE_H
+
+#include <span>
+#include <string>
+#include <cstddef>
+#include <cstdint>
+
+namespace Nova::App::Streaming {
+
+    // Read-only memory mapping of a whole file. Pages are faulted in on first access.
+    class MappedFile {
+    public:
+        MappedFile() = default;
+        ~MappedFile() { Close(); }
+
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+        MappedFile(MappedFile&& other) noexcept;
+        MappedFile& operator=(MappedFile&& other) noexcept;
+
+        bool Open(const std::string& path);
+        void Close();
+
+        bool IsOpen() const { return m_Data != nullptr; }
+        std::span<const std::byte> GetData() const { return { m_Data, m_Size }; }
+        size_t GetSize() const { return m_Size; }
+
+    private:
+        const std::byte* m_Data{ nullptr };
+        size_t m_Size{ 0 };
+
+#if defined(_WIN32)
+        void* m_File{ nullptr };
+        void* m_Mapping{ nullptr };
+#endif
+    };
+
+} // namespace Nova::App::Streaming
+
+#endif // MAPPEDFILE_H
@@ -0,0 +1,63 @@
+#include "Streaming/StagingRing.h"
+
+#include "Core/Assert.h"
+
+namespace Nova::App::Streaming {
+
+    namespace {
+
+        constexpr size_t k_CapacityGranularity = 256;
+
+    } // namespace
+
+    StagingRing::StagingRing(size_t capacity)
+        : m_Capacity((capacity + k_CapacityGranularity - 1) & ~(k_CapacityGranularity - 1)) {
+        m_Memory = std::make_unique<std::byte[]>(m_Capacity);
+    }
+
+    StagingRing::Allocation StagingRing::Allocate(size_t size, size_t alignment) {
+        NV_ASSERT_MSG(alignment != 0 && (alignment & (alignment - 1)) == 0 && alignment <= k_CapacityGranularity,
+                      "Staging alignment must be a power of two no larger than 256.");
+
+        if (size == 0 || size > m_Capacity)
+            return {};
+
+        // The capacity is a multiple of the alignment, so aligning the position aligns the offset.
+        uint64_t start = (m_Head + alignment - 1) & ~static_cast<uint64_t>(alignment - 1);
+        size_t offset = static_cast<size_t>(start % m_Capacity);
+
+        // Never split an allocation across the end of the ring: skip to the start instead.
+        if (offset + size > m_Capacity) {
+            start += m_Capacity - offset;
+            offset = 0;
+        }
+
+        if (start + size - m_Tail > m_Capacity)
+            return {};
+
+        m_Head = start + size;
+        return { m_Memory.get() + offset, size, m_Head };
+    }
+
+    void StagingRing::FenceFrame(uint64_t frame, uint64_t end) {
+        NV_ASSERT_MSG(end <= m_Head, "Staging fence past the last allocation.");
+
+        // Already covered by an earlier fence.
+        const uint64_t fenced = m_Fences.empty() ? m_Tail : m_Fences.back().m_Head;
+        if (end <= fenced)
+            return;
+
+        if (!m_Fences.empty() && m_Fences.back().m_Frame == frame)
+            m_Fences.back().m_Head = end;
+        else
+            m_Fences.push_back({ frame, end });
+    }
+
+    void StagingRing::Retire(uint64_t completedFrame) {
+        while (!m_Fences.empty() && m_Fences.front().m_Frame <= completedFrame) {
+            m_Tail = m_Fences.front().m_Head;
+            m_Fences.pop_front();
+        }
+    }
+
+} // namespace Nova::App::Streaming
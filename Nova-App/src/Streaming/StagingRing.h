@@ -0,0 +1,58 @@
+#ifndef STAGINGRING_H
+#define STAGINGRING_H
+
+#include <span>
+#include <deque>
+#include <memory>
+#include <cstddef>
+#include <cstdint>
+
+namespace Nova::App::Streaming {
+
+    // Fixed-size ring of upload staging memory. Allocations are released in the order they were
+    // made, once the frame that consumed them is no longer in flight. Not thread-safe.
+    class StagingRing {
+    public:
+        struct Allocation {
+            std::byte* m_Data{ nullptr };
+            size_t     m_Size{ 0 };
+            uint64_t   m_End{ 0 };    // ring position just past the allocation, see FenceFrame
+
+            bool IsValid() const { return m_Data != nullptr; }
+            std::span<std::byte> Span() const { return { m_Data, m_Size }; }
+        };
+
+        explicit StagingRing(size_t capacity);
+
+        // Returns an invalid allocation when the ring has no room left (or `size` exceeds the capacity).
+        Allocation Allocate(size_t size, size_t alignment = 16);
+
+        // The allocations up to ring position `end` (an Allocation::m_End) are consumed by `frame`.
+        // Later allocations stay live until a fence covers them.
+        void FenceFrame(uint64_t frame, uint64_t end);
+        // Everything allocated so far is consumed by `frame`.
+        void FenceFrame(uint64_t frame) { FenceFrame(frame, m_Head); }
+        // Releases the allocations fenced by frames up to and including `completedFrame`.
+        void Retire(uint64_t completedFrame);
+
+        size_t GetCapacity() const { return m_Capacity; }
+        size_t GetUsed() const { return static_cast<size_t>(m_Head - m_Tail); }
+
+    private:
+        struct Fence {
+            uint64_t m_Frame{ 0 };
+            uint64_t m_Head{ 0 };
+        };
+
+        std::unique_ptr<std::byte[]> m_Memory;
+        size_t m_Capacity{ 0 };
+
+        // Monotonic byte positions; the ring offset is position % capacity.
+        uint64_t m_Head{ 0 };
+        uint64_t m_Tail{ 0 };
+        std::deque<Fence> m_Fences;
+    };
+
+} // namespace Nova::App::Streaming
+
+#endif // STAGINGRING_H
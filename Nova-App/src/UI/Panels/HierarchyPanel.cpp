@@ -1,15 +1,84 @@
 #include "UI/Panels/HierarchyPanel.h"
 
+#include <chrono>
+#include <string>
+#include <vector>
+
 #include "imgui.h"
 
+#include "App/AppLayer.h"
+#include "World/NameComponent.h"
+
 namespace Nova::App::UI::Panels::HierarchyPanel {
 
+    // Panel CPU time above which the footer turns red.
+    static constexpr double k_BudgetMs = 1.0;
+
+    static char        s_Filter[128] = {};
+    static std::string s_AppliedFilter;
+    static uint64_t    s_AppliedRevision = 0;
+    static std::vector<entt::entity> s_Matches;
+    static double      s_SearchMs = 0.0;
+
     void Render() {
+        const auto start = std::chrono::steady_clock::now();
+
         ImGui::Begin("Hierarchy");
 
-        ImGui::TextDisabled("TODO: display list of entities.");
-        ImGui::Separator();
-        ImGui::TextUnformatted("placeholder.");
+        AppLayer* app = Nova::App::g_AppLayer;
+        if (!app) {
+            ImGui::End();
+            return;
+        }
+
+        World::HierarchyIndex& index = app->GetHierarchyIndex();
+        // Half of the panel's budget goes to the index; queued changes beyond it wait a frame.
+        index.Update(k_BudgetMs * 0.5);
+
+        ImGui::SetNextItemWidth(-FLT_MIN);
+        ImGui::InputTextWithHint("##Filter", "Filter by name", s_Filter, sizeof(s_Filter));
+
+        // The search only reruns when the query or the index changed.
+        const bool filtered = s_Filter[0] != '\0';
+        if (filtered && (s_AppliedFilter != s_Filter || s_AppliedRevision != index.GetRevision())) {
+            const auto searchStart = std::chrono::steady_clock::now();
+            index.Search(s_Filter, s_Matches);
+            s_SearchMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - searchStart).count();
+            s_AppliedFilter = s_Filter;
+            s_AppliedRevision = index.GetRevision();
+        }
+
+        const size_t rowCount = filtered ? s_Matches.size() : index.Size();
+        const auto& registry = app->GetScene().GetRegistry();
+
+        // Only the visible rows are submitted.
+        const float footerHeight = ImGui::GetFrameHeightWithSpacing();
+        if (ImGui::BeginChild("##Entities", ImVec2(0.0f, -footerHeight))) {
+            ImGuiListClipper clipper;
+            clipper.Begin(static_cast<int>(rowCount));
+            while (clipper.Step()) {
+                for (int row = clipper.DisplayStart; row < clipper.DisplayEnd; ++row) {
+                    const entt::entity entity = filtered ? s_Matches[row] : index.At(row);
+                    const auto* name = registry.try_get<World::NameComponent>(entity);
+
+                    ImGui::PushID(static_cast<int>(entt::to_integral(entity)));
+                    const bool selected = app->GetSelectedEntity() == entity;
+                    if (ImGui::Selectable(name && !name->m_Name.empty() ? name->m_Name.c_str() : "(unnamed)", selected))
+                        app->SetSelectedEntity(entity);
+                    ImGui::PopID();
+                }
+            }
+        }
+        ImGui::EndChild();
+
+        const double panelMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        const ImVec4 color = panelMs > k_BudgetMs ? ImVec4(1.0f, 0.4f, 0.4f, 1.0f) : ImGui::GetStyleColorVec4(ImGuiCol_TextDisabled);
+        if (filtered)
+            ImGui::TextColored(color, "%zu / %zu entities | search %.2f ms | panel %.2f ms", rowCount, index.Size(), s_SearchMs, panelMs);
+        else if (index.GetPendingCount() > 0)
+            ImGui::TextColored(color, "%zu entities (%zu changes queued) | index %.2f ms | panel %.2f ms", rowCount, index.GetPendingCount(), index.GetLastUpdateMs(), panelMs);
+        else
+            ImGui::TextColored(color, "%zu entities | index %.2f ms | panel %.2f ms", rowCount, index.GetLastUpdateMs(), panelMs);
 
         ImGui::End();
     }
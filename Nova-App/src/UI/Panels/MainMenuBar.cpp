@@ -1,7 +1,21 @@
 #include "UI/Panels/MainMenuBar.h"
 
+#include <string>
+#include <format>
+
 #include "imgui.h"
 
+#include "App/AppLayer.h"
+#include "Bench/CullingBenchmark.h"
+#include "Bench/TransformBenchmark.h"
+#include "Bench/JobSystemBenchmark.h"
+#include "Bench/CookedMeshBenchmark.h"
+#include "Bench/SceneSerializationBenchmark.h"
+#include "Bench/HierarchyIndexBenchmark.h"
+#include "Bench/SceneSnapshotBenchmark.h"
+#include "Bench/RenderGraphBenchmark.h"
+#include "Bench/MeshOptimizationBenchmark.h"
+
 namespace Nova::App::UI::Panels::MainMenuBar {
 
     void Render() {
@@ -15,9 +29,14 @@ namespace Nova::App::UI::Panels::MainMenuBar {
                 ImGui::Separator();
 
                 ImGui::MenuItem("New Scene", "Ctrl+N");
-                ImGui::MenuItem("Open Scene", "Ctrl+O");
-                ImGui::MenuItem("Save Scene", "Ctrl+S");
-                ImGui::MenuItem("Save Scene As", "Ctrl+Shift+S");
+                AppLayer* app = Nova::App::g_AppLayer;
+                const bool editing = app && app->GetSceneState() == AppLayer::SceneState::Edit;
+                if (ImGui::MenuItem("Open Scene", "Ctrl+O", false, editing))
+                    app->ShowSceneFileDialog(AppLayer::SceneFileAction::Open);
+                if (ImGui::MenuItem("Save Scene", "Ctrl+S", false, editing))
+                    app->SaveScene(app->GetScenePath());
+                if (ImGui::MenuItem("Save Scene As", "Ctrl+Shift+S", false, editing))
+                    app->ShowSceneFileDialog(AppLayer::SceneFileAction::Save);
 
                 ImGui::Separator();
 
@@ -88,7 +107,110 @@ namespace Nova::App::UI::Panels::MainMenuBar {
             }
 
             if (ImGui::BeginMenu("Tools")) {
-                ImGui::MenuItem("Profiler");
+                AppLayer* app = Nova::App::g_AppLayer;
+                bool profiler = app && app->IsProfilerVisible();
+                if (ImGui::MenuItem("Profiler", nullptr, &profiler, app != nullptr))
+                    app->SetProfilerVisible(profiler);
+
+                ImGui::Separator();
+
+                bool instancing = app && app->IsInstancingEnabled();
+                if (ImGui::MenuItem("GPU Instancing", nullptr, &instancing, app && app->IsInstancingSupported()))
+                    app->SetInstancingEnabled(instancing);
+
+                bool bindless = app && app->IsBindlessEnabled();
+                if (ImGui::MenuItem("Bindless Draws", nullptr, &bindless, app && app->IsBindlessSupported()))
+                    app->SetBindlessEnabled(bindless);
+                if (app && !app->IsBindlessSupported() && ImGui::IsItemHovered(ImGuiHoveredFlags_AllowWhenDisabled))
+                    ImGui::SetTooltip("Unsupported by this renderer");
+
+                bool gpuDriven = app && app->IsGpuDrivenEnabled();
+                if (ImGui::MenuItem("GPU-Driven Culling", nullptr, &gpuDriven, app && app->IsGpuDrivenSupported()))
+                    app->SetGpuDrivenEnabled(gpuDriven);
+                if (app && !app->IsGpuDrivenSupported() && ImGui::IsItemHovered(ImGuiHoveredFlags_AllowWhenDisabled))
+                    ImGui::SetTooltip("Unsupported by this renderer");
+
+                bool occlusion = app && app->IsOcclusionCullingEnabled();
+                if (ImGui::MenuItem("Occlusion Culling", nullptr, &occlusion, app && app->IsGpuDrivenEnabled() && app->IsOcclusionCullingSupported()))
+                    app->SetOcclusionCullingEnabled(occlusion);
+
+                bool culling = app && app->IsFrustumCullingEnabled();
+                if (ImGui::MenuItem("Frustum Culling", nullptr, &culling, app != nullptr))
+                    app->SetFrustumCullingEnabled(culling);
+
+                bool lods = app && app->IsMeshLODEnabled();
+                if (ImGui::MenuItem("Mesh LODs", nullptr, &lods, app != nullptr))
+                    app->SetMeshLODEnabled(lods);
+
+                // Applies from the next Play.
+                bool decoupled = app && app->GetSimulation().GetMode() == Simulation::SimulationMode::Decoupled;
+                if (ImGui::MenuItem("Decoupled Simulation", nullptr, &decoupled, app && app->GetSceneState() == AppLayer::SceneState::Edit))
+                    app->GetSimulation().SetMode(decoupled ? Simulation::SimulationMode::Decoupled : Simulation::SimulationMode::Coupled);
+
+                if (ImGui::BeginMenu("Presentation", app != nullptr)) {
+                    auto& pacer = app->GetFramePacer();
+                    Rendering::FramePacingSettings settings = pacer.GetSettings();
+                    bool changed = false;
+
+                    // Without renderer support the mode is fixed at startup (NOVA_PRESENT_MODE).
+                    const bool modeSupported = Rendering::PresentModeSupport<Nova::Core::Renderer::RHI::IRenderer>;
+                    for (Rendering::PresentMode mode : { Rendering::PresentMode::Fifo, Rendering::PresentMode::Mailbox, Rendering::PresentMode::Immediate }) {
+                        if (ImGui::MenuItem(Rendering::GetPresentModeName(mode), nullptr, settings.m_PresentMode == mode, modeSupported)) {
+                            settings.m_PresentMode = mode;
+                            changed = true;
+                        }
+                    }
+
+                    ImGui::Separator();
+                    const bool framesSupported = Rendering::FramesInFlightSupport<Nova::Core::Renderer::RHI::IRenderer>;
+                    for (uint32_t frames = 1; frames <= Rendering::FramePacer::k_MaxFramesInFlight; ++frames) {
+                        const std::string label = std::format("{} Frame{} in Flight", frames, frames > 1 ? "s" : "");
+                        if (ImGui::MenuItem(label.c_str(), nullptr, pacer.GetFramesInFlight() == frames, framesSupported)) {
+                            settings.m_FramesInFlight = frames;
+                            changed = true;
+                        }
+                    }
+
+                    ImGui::Separator();
+                    if (ImGui::MenuItem("Low Latency", nullptr, &settings.m_LowLatency))
+                        changed = true;
+
+                    if (changed)
+                        pacer.SetSettings(settings);
+                    ImGui::EndMenu();
+                }
+
+                if (ImGui::BeginMenu("Benchmarks", app != nullptr)) {
+                    const bool running = app->GetInstancingBenchmark().IsRunning() || app->GetGpuDrivenBenchmark().IsRunning();
+                    if (ImGui::MenuItem("Instancing (10k cubes)", nullptr, false, !running))
+                        app->StartInstancingBenchmark(10'000);
+                    if (ImGui::MenuItem("Instancing (100k cubes)", nullptr, false, !running))
+                        app->StartInstancingBenchmark(100'000);
+                    if (ImGui::MenuItem("GPU-Driven Submission (100k objects)", nullptr, false, !running))
+                        app->StartGpuDrivenBenchmark(100'000);
+
+                    ImGui::Separator();
+                    if (ImGui::MenuItem("Frustum Culling (100k / 1M bounds)"))
+                        Bench::RunCullingBenchmark();
+                    if (ImGui::MenuItem("Transform Cache (100k, 1% dirty)"))
+                        Bench::RunTransformBenchmark();
+                    if (ImGui::MenuItem("Job System Scaling (1..N threads)"))
+                        Bench::RunJobSystemBenchmark();
+                    if (ImGui::MenuItem("Cooked Mesh Load (cold / warm)"))
+                        Bench::RunCookedMeshBenchmark();
+                    if (ImGui::MenuItem("Scene Save / Load (10k / 100k / 1M)"))
+                        Bench::RunSceneSerializationBenchmark();
+                    if (ImGui::MenuItem("Hierarchy Index (1M names)"))
+                        Bench::RunHierarchyIndexBenchmark();
+                    if (ImGui::MenuItem("Play Snapshot (100k / 1M)"))
+                        Bench::RunSceneSnapshotBenchmark();
+                    if (ImGui::MenuItem("Render Graph (deferred 1080p frame)"))
+                        Bench::RunRenderGraphBenchmark();
+                    if (ImGui::MenuItem("Mesh Optimization (1M-triangle sphere)"))
+                        Bench::RunMeshOptimizationBenchmark();
+                    ImGui::EndMenu();
+                }
+
                 ImGui::EndMenu();
             }
 
@@ -0,0 +1,209 @@
+#include "UI/Panels/ProfilerPanel.h"
+
+#include <map>
+#include <string>
+#include <algorithm>
+
+#include "imgui.h"
+
+#include "Profiling/Profiler.h"
+
+namespace Nova::App::UI::Panels::ProfilerPanel {
+
+    using Nova::App::Profiling::FrameCapture;
+    using Nova::App::Profiling::ProfileEvent;
+    using Nova::App::Profiling::Profiler;
+
+    static int   s_SelectedFrame = -1;   // index into the history; -1 follows the latest frame
+    static float s_Zoom = 1.0f;
+
+    static ImU32 GetZoneColor(const char* name) {
+        // Stable per-name colour: hash of the literal's contents, not its address.
+        uint32_t hash = 2166136261u;
+        for (const char* c = name; c && *c; ++c)
+            hash = (hash ^ static_cast<uint8_t>(*c)) * 16777619u;
+
+        const float hue = (hash % 360) / 360.0f;
+        float r, g, b;
+        ImGui::ColorConvertHSVtoRGB(hue, 0.45f, 0.80f, r, g, b);
+        return ImGui::GetColorU32(ImVec4(r, g, b, 1.0f));
+    }
+
+    static void DrawFrameGraph(const std::deque<FrameCapture>& history) {
+        const float height = 60.0f;
+        const ImVec2 origin = ImGui::GetCursorScreenPos();
+        const float width = ImGui::GetContentRegionAvail().x;
+
+        ImGui::InvisibleButton("##FrameGraph", ImVec2(width, height));
+        ImDrawList* draw = ImGui::GetWindowDrawList();
+        draw->AddRectFilled(origin, ImVec2(origin.x + width, origin.y + height), ImGui::GetColorU32(ImGuiCol_FrameBg));
+
+        if (history.empty())
+            return;
+
+        // Scaled so 33 ms fills the graph; 16.6 ms marked.
+        const float maxMs = 33.3f;
+        const float barWidth = width / Profiler::k_HistoryFrames;
+        const float y60 = origin.y + height - height * (16.6f / maxMs);
+        draw->AddLine(ImVec2(origin.x, y60), ImVec2(origin.x + width, y60), IM_COL32(255, 255, 255, 60));
+
+        const int selected = s_SelectedFrame >= 0 ? s_SelectedFrame : static_cast<int>(history.size()) - 1;
+        for (size_t i = 0; i < history.size(); ++i) {
+            const float ms = static_cast<float>(history[i].GetDurationMs());
+            const float barHeight = std::min(ms / maxMs, 1.0f) * height;
+            const float x = origin.x + i * barWidth;
+
+            ImU32 color = ms > 33.3f ? IM_COL32(220, 80, 70, 255) : ms > 16.7f ? IM_COL32(230, 180, 60, 255) : IM_COL32(90, 180, 90, 255);
+            if (static_cast<int>(i) == selected)
+                color = IM_COL32(240, 240, 240, 255);
+            draw->AddRectFilled(ImVec2(x, origin.y + height - barHeight), ImVec2(x + std::max(barWidth - 1.0f, 1.0f), origin.y + height), color);
+        }
+
+        if (ImGui::IsItemHovered()) {
+            const int hovered = static_cast<int>((ImGui::GetIO().MousePos.x - origin.x) / barWidth);
+            if (hovered >= 0 && hovered < static_cast<int>(history.size())) {
+                ImGui::SetTooltip("Frame %llu: %.2f ms", static_cast<unsigned long long>(history[hovered].m_Frame), history[hovered].GetDurationMs());
+
+                // Selecting a frame pauses capture so the selection stays put.
+                if (ImGui::IsItemClicked()) {
+                    s_SelectedFrame = hovered;
+                    Profiler::Get().SetPaused(true);
+                }
+            }
+        }
+    }
+
+    static void DrawLane(ImDrawList* draw, const std::vector<ProfileEvent>& events, uint64_t frameStartNs, const ImVec2& origin, float nsToPixels, float rowHeight, uint32_t& maxDepth) {
+        for (const ProfileEvent& event : events) {
+            maxDepth = std::max(maxDepth, event.m_Depth);
+
+            const float x0 = origin.x + (static_cast<int64_t>(event.m_StartNs - frameStartNs)) * nsToPixels;
+            const float x1 = std::max(origin.x + (static_cast<int64_t>(event.m_EndNs - frameStartNs)) * nsToPixels, x0 + 1.0f);
+            const float y0 = origin.y + event.m_Depth * rowHeight;
+            const ImVec2 min(x0, y0), max(x1, y0 + rowHeight - 1.0f);
+
+            draw->AddRectFilled(min, max, GetZoneColor(event.m_Name));
+            if (x1 - x0 > 30.0f) {
+                draw->PushClipRect(min, max, true);
+                draw->AddText(ImVec2(x0 + 3.0f, y0 + 1.0f), IM_COL32(20, 20, 20, 255), event.m_Name);
+                draw->PopClipRect();
+            }
+
+            if (ImGui::IsMouseHoveringRect(min, max))
+                ImGui::SetTooltip("%s\n%.3f ms", event.m_Name, (event.m_EndNs - event.m_StartNs) * 1e-6);
+        }
+    }
+
+    static void DrawTimeline(const FrameCapture& frame) {
+        Profiler& profiler = Profiler::Get();
+
+        const float rowHeight = ImGui::GetTextLineHeight() + 3.0f;
+        const float labelWidth = 90.0f;
+
+        ImGui::BeginChild("##Timeline", ImVec2(0.0f, 0.0f), true, ImGuiWindowFlags_HorizontalScrollbar);
+
+        const float width = std::max(ImGui::GetContentRegionAvail().x - labelWidth, 100.0f) * s_Zoom;
+        const double frameNs = static_cast<double>(std::max<uint64_t>(frame.m_EndNs - frame.m_StartNs, 1));
+        const float nsToPixels = static_cast<float>(width / frameNs);
+        ImDrawList* draw = ImGui::GetWindowDrawList();
+
+        auto drawTrack = [&](const char* label, const std::vector<ProfileEvent>& events, uint64_t frameStartNs) {
+            const ImVec2 cursor = ImGui::GetCursorScreenPos();
+            draw->AddText(cursor, ImGui::GetColorU32(ImGuiCol_Text), label);
+
+            uint32_t maxDepth = 0;
+            DrawLane(draw, events, frameStartNs, ImVec2(cursor.x + labelWidth, cursor.y), nsToPixels, rowHeight, maxDepth);
+            ImGui::Dummy(ImVec2(labelWidth + width, (maxDepth + 1) * rowHeight + 4.0f));
+        };
+
+        for (const auto& track : frame.m_Threads) {
+            const std::string name = profiler.GetThreadName(track.m_Thread);
+            drawTrack(name.c_str(), track.m_Events, frame.m_StartNs);
+        }
+
+        if (!frame.m_Gpu.empty())
+            drawTrack("GPU", frame.m_Gpu, 0);
+
+        ImGui::EndChild();
+    }
+
+    static void DrawZoneTable(const FrameCapture& frame) {
+        struct ZoneTotal { uint32_t m_Calls{ 0 }; uint64_t m_Ns{ 0 }; };
+        std::map<std::string, ZoneTotal> totals;
+        for (const auto& track : frame.m_Threads) {
+            for (const ProfileEvent& event : track.m_Events) {
+                auto& total = totals[event.m_Name ? event.m_Name : "?"];
+                ++total.m_Calls;
+                total.m_Ns += event.m_EndNs - event.m_StartNs;
+            }
+        }
+
+        if (!ImGui::BeginTable("##Zones", 3, ImGuiTableFlags_RowBg | ImGuiTableFlags_BordersInnerV | ImGuiTableFlags_ScrollY, ImVec2(0.0f, 150.0f)))
+            return;
+
+        ImGui::TableSetupColumn("Zone");
+        ImGui::TableSetupColumn("Calls");
+        ImGui::TableSetupColumn("Total ms");
+        ImGui::TableHeadersRow();
+        for (const auto& [name, total] : totals) {
+            ImGui::TableNextRow();
+            ImGui::TableNextColumn(); ImGui::TextUnformatted(name.c_str());
+            ImGui::TableNextColumn(); ImGui::Text("%u", total.m_Calls);
+            ImGui::TableNextColumn(); ImGui::Text("%.3f", total.m_Ns * 1e-6);
+        }
+        ImGui::EndTable();
+    }
+
+    void Render(bool* open) {
+        if (!ImGui::Begin("Profiler", open)) {
+            ImGui::End();
+            return;
+        }
+
+        Profiler& profiler = Profiler::Get();
+        const auto& history = profiler.GetHistory();
+
+#if !NV_PROFILER_ENABLED
+        ImGui::TextDisabled("Built without NOVA_APP_ENABLE_PROFILER: CPU zones are compiled out.");
+#endif
+
+        bool paused = profiler.IsPaused();
+        if (ImGui::Checkbox("Pause", &paused)) {
+            profiler.SetPaused(paused);
+            if (!paused)
+                s_SelectedFrame = -1;
+        }
+
+        ImGui::SameLine();
+        if (ImGui::Button("Export Chrome Trace"))
+            profiler.ExportChromeTrace("Captures/NovaProfile.json");
+
+        ImGui::SameLine();
+        ImGui::SetNextItemWidth(120.0f);
+        ImGui::SliderFloat("Zoom", &s_Zoom, 1.0f, 32.0f, "%.1fx", ImGuiSliderFlags_Logarithmic);
+
+        ImGui::SameLine();
+        ImGui::TextDisabled("%zu frames, %llu dropped", history.size(), static_cast<unsigned long long>(profiler.GetDroppedEvents()));
+
+        DrawFrameGraph(history);
+
+        if (s_SelectedFrame >= static_cast<int>(history.size()))
+            s_SelectedFrame = -1;
+
+        if (!history.empty()) {
+            const FrameCapture& frame = history[s_SelectedFrame >= 0 ? s_SelectedFrame : history.size() - 1];
+            ImGui::Text("Frame %llu: %.3f ms", static_cast<unsigned long long>(frame.m_Frame), frame.GetDurationMs());
+
+            if (ImGui::CollapsingHeader("Zones"))
+                DrawZoneTable(frame);
+
+            DrawTimeline(frame);
+        }
+        else {
+            ImGui::TextDisabled("No frames captured yet.");
+        }
+
+        ImGui::End();
+    }
+
+} // namespace Nova::App::UI::Panels::ProfilerPanel
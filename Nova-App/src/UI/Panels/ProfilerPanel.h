@@ -0,0 +1,11 @@
+#ifndef PROFILERPANEL_H
+#define PROFILERPANEL_H
+
+namespace Nova::App::UI::Panels::ProfilerPanel {
+
+    // Frame graph, per-thread zone timeline of the selected frame and Chrome trace export.
+    void Render(bool* open);
+
+} // namespace Nova::App::UI::Panels::ProfilerPanel
+
+#endif // PROFILERPANEL_H
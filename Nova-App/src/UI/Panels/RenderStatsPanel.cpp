@@ -0,0 +1,211 @@
+#include "UI/Panels/RenderStatsPanel.h"
+
+#include "imgui.h"
+
+#include "App/AppLayer.h"
+#include "Bench/MicroBenchmark.h"
+#include "Rendering/FrustumCulling.h"
+#include "Rendering/ShaderCache.h"
+#include "Rendering/ShaderLibrary.h"
+#include "Streaming/AssetStreamer.h"
+
+namespace Nova::App::UI::Panels::RenderStatsPanel {
+
+    void Render(const Nova::App::Rendering::RenderStats& stats, const Nova::App::Bench::InstancingBenchmark& benchmark) {
+        ImGui::Begin("Render Stats");
+
+        ImGui::Text("Draw calls: %u", stats.m_DrawCalls);
+        ImGui::Text("Instances: %u (%u instanced draws)", stats.m_Instances, stats.m_InstancedBatches);
+        ImGui::Text("Scene CPU: %.3f ms (%.3f ms submit)", stats.m_SceneCpuTimeMs, stats.m_SubmitCpuTimeMs);
+
+        ImGui::Text("Transforms updated: %u", stats.m_TransformsUpdated);
+
+        ImGui::SeparatorText("Culling");
+        ImGui::Text("Visible: %u", stats.m_Visible);
+        ImGui::Text("Culled: %u", stats.m_Culled);
+        ImGui::Text("Kernel: %s", Nova::App::Rendering::GetCullingKernelName(Nova::App::Rendering::GetBestCullingKernel()));
+
+        ImGui::SeparatorText("LOD");
+        ImGui::Text("Triangles: %llu -> %llu", static_cast<unsigned long long>(stats.m_TrianglesBeforeLOD), static_cast<unsigned long long>(stats.m_TrianglesAfterLOD));
+        ImGui::Text("Reduced meshes: %u", stats.m_LODReduced);
+
+        if (const auto* app = Nova::App::g_AppLayer; app && !app->IsBindlessSupported()) {
+            ImGui::SeparatorText("Bindless");
+            ImGui::TextDisabled("Unsupported: the renderer lacks the bindless hooks (Rendering/GpuScene.h)");
+        }
+        else if (app && app->IsBindlessEnabled()) {
+            const auto& scene = app->GetGpuSceneStats();
+            ImGui::SeparatorText("Bindless");
+            ImGui::Text("Draws: %u (%u runs)", scene.m_Draws, stats.m_BindlessDraws);
+            ImGui::Text("Slots: %u transforms, %u materials", scene.m_Transforms, scene.m_Materials);
+            ImGui::Text("Uploaded: %u transforms, %u materials, %u draws", scene.m_TransformsUploaded, scene.m_MaterialsUploaded, scene.m_DrawsUploaded);
+            ImGui::Text("%u ranges, %.1f KB", scene.m_Ranges, scene.m_BytesUploaded / 1024.0);
+        }
+
+        if (const auto* app = Nova::App::g_AppLayer; app && !app->IsGpuDrivenSupported()) {
+            ImGui::SeparatorText("GPU-driven");
+            ImGui::TextDisabled("Unsupported: the renderer lacks the culling hooks (Rendering/GpuCulling.h)");
+        }
+        else if (app && app->IsGpuDrivenEnabled()) {
+            const auto& culling = app->GetGpuCullingStats();
+            ImGui::SeparatorText("GPU-driven");
+            ImGui::Text("Objects: %u, culled on the GPU%s", stats.m_GpuObjects, culling.m_Occlusion ? " (frustum + occlusion)" : "");
+            ImGui::Text("Indirect draws: %u (%u LOD levels, %u command slots)", stats.m_IndirectDraws, culling.m_LODs, culling.m_Commands);
+            ImGui::Text("Uploaded: %u objects, %u ranges, %.1f KB", culling.m_ObjectsUploaded, culling.m_Ranges, culling.m_BytesUploaded / 1024.0);
+        }
+
+        ImGui::SeparatorText("Render queue");
+        ImGui::Text("Packets: %u", stats.m_DrawPackets);
+        ImGui::Text("Material changes avoided: %u", stats.m_MaterialChangesAvoided);
+        ImGui::Text("Mesh changes avoided: %u", stats.m_MeshChangesAvoided);
+
+        ImGui::SeparatorText("Materials");
+        ImGui::Text("Binds: %u", stats.m_MaterialBinds);
+        ImGui::Text("Binds skipped: %u", stats.m_MaterialBindsSkipped);
+        ImGui::Text("Blocks updated: %u", stats.m_MaterialBlocksUpdated);
+
+        ImGui::SeparatorText("Uniforms");
+        ImGui::Text("Bytes uploaded: %llu", static_cast<unsigned long long>(stats.m_UniformBytesUploaded));
+
+        if (const auto* app = Nova::App::g_AppLayer) {
+            const auto& pipelines = app->GetPipelineCacheStats();
+            ImGui::SeparatorText("Startup");
+            ImGui::Text("Startup: %.1f ms, first frame: %.1f ms", app->GetStartupMs(), app->GetFirstFrameMs());
+            ImGui::Text("Pipeline cache: %s", pipelines.m_Status.c_str());
+            if (pipelines.m_Supported)
+                ImGui::Text("Loaded %.1f KB (%.2f ms), saved %.1f KB (%.2f ms)",
+                    pipelines.m_LoadedBytes / 1024.0, pipelines.m_LoadMs, pipelines.m_SavedBytes / 1024.0, pipelines.m_SaveMs);
+
+            const auto& graph = app->GetRenderGraphStats();
+            ImGui::SeparatorText("Render graph");
+            ImGui::Text("Passes: %u (%u culled), compile: %.3f ms", graph.m_Passes, graph.m_CulledPasses, graph.m_CompileMs);
+            ImGui::Text("Barriers: %u (%u layout transitions)", graph.m_Barriers, graph.m_LayoutTransitions);
+            if (graph.m_TransientTextures > 0)
+                ImGui::Text("Transients: %u, %.1f MB aliased into %.1f MB", graph.m_TransientTextures,
+                    graph.m_TransientBytes / (1024.0 * 1024.0), graph.m_AliasedBytes / (1024.0 * 1024.0));
+
+            const auto& targets = app->GetViewportTargets().GetStats();
+            if (targets.m_Allocations > 0) {
+                ImGui::SeparatorText("Viewport targets");
+                ImGui::Text("Pooled: %u (%.1f MB of %.0f MB)%s", targets.m_Targets, targets.m_Bytes / (1024.0 * 1024.0),
+                    app->GetViewportTargets().GetSettings().m_MemoryCap / (1024.0 * 1024.0), targets.m_Settling ? ", settling" : "");
+                ImGui::Text("Allocations: %u, released: %u (%u awaiting GPU)", targets.m_Allocations, targets.m_Releases, targets.m_PendingDestroys);
+                ImGui::Text("Resized frames: %u (%u without allocating)", targets.m_SizeChanges, targets.m_Reused);
+            }
+
+            const auto& pacer = app->GetFramePacer();
+            const auto& pacing = pacer.GetStats();
+            ImGui::SeparatorText("Presentation");
+            ImGui::Text("%s%s, %u frames in flight%s, %.1f fps", Nova::App::Rendering::GetPresentModeName(pacer.GetSettings().m_PresentMode),
+                pacing.m_PresentModeApplied ? "" : " (startup)", pacing.m_FramesInFlight, pacer.IsLowLatency() ? ", low latency" : "", pacing.m_FramesPerSecond);
+            ImGui::Text("Input -> present: %.1f ms, -> GPU done: %.1f ms avg, %.1f ms max",
+                pacing.m_SampleToSubmitMs, pacing.m_SampleToRetireMs, pacing.m_MaxSampleToRetireMs);
+            ImGui::Text("Fence wait: %.2f ms/frame", pacing.m_FenceWaitMs);
+
+            const auto input = app->GetEventQueue().GetStats();
+            ImGui::SeparatorText("Input events");
+            ImGui::Text("This frame: %u received, %u dispatched (%u coalesced), %.3f ms",
+                input.m_Received, input.m_Dispatched, input.m_Coalesced, input.m_DispatchMs);
+            ImGui::Text("Total: %llu received, %llu dispatched, peak %u/frame", static_cast<unsigned long long>(input.m_TotalReceived),
+                static_cast<unsigned long long>(input.m_TotalDispatched), input.m_MaxReceived);
+            if (input.m_Rejected > 0)
+                ImGui::Text("Queue full: %u pushes rejected", input.m_Rejected);
+
+            const auto& dynamicResolution = app->GetDynamicResolution();
+            if (dynamicResolution.IsEnabled()) {
+                const auto& dynres = dynamicResolution.GetStats();
+                const glm::uvec2 renderSize = app->GetRenderSize();
+                ImGui::SeparatorText("Dynamic resolution");
+                ImGui::Text("Scale: %.0f%% (%ux%u), %u changes", dynamicResolution.GetScale() * 100.0f, renderSize.x, renderSize.y, dynres.m_ScaleChanges);
+                ImGui::Text("%s frame: %.2f ms (filtered %.2f, target %.1f)", dynres.m_GpuTimed ? "GPU" : "CPU work",
+                    dynres.m_FrameMs, dynres.m_FilteredFrameMs, dynamicResolution.GetSettings().m_TargetFrameMs);
+                ImGui::Text("Upscale: %s", app->IsViewportUpscaleSupported() ? "sharpened bilinear (renderer pass)" : "bilinear ImGui stretch, unsharpened (no renderer hook)");
+                if (dynres.m_DisplayIntervalMs > 0.0f)
+                    ImGui::Text("Display: %.2f ms, no downscale within it", dynres.m_DisplayIntervalMs);
+            }
+
+            const auto& snapshot = app->GetPlaySnapshotStats();
+            if (snapshot.m_Entities > 0) {
+                ImGui::SeparatorText("Play snapshot");
+                ImGui::Text("%u entities, %u components, %.1f MB", snapshot.m_Entities, snapshot.m_Components, snapshot.m_Bytes / (1024.0 * 1024.0));
+                ImGui::Text("Capture: %.2f ms, restore: %.2f ms", snapshot.m_CaptureMs, snapshot.m_RestoreMs);
+                ImGui::Text("Columns: %u copied, %u reinserted", snapshot.m_ColumnsCopied, snapshot.m_ColumnsReinserted);
+            }
+
+            const auto simulation = app->GetSimulation().GetStats();
+            if (simulation.m_Ticks > 0) {
+                const bool decoupled = simulation.m_Mode == Simulation::SimulationMode::Decoupled;
+                ImGui::SeparatorText(decoupled ? "Simulation (decoupled)" : "Simulation (coupled)");
+                ImGui::Text("%.1f ticks/s, %.1f fps, %u skipped", simulation.m_TicksPerSecond, simulation.m_FramesPerSecond, simulation.m_SkippedTicks);
+                ImGui::Text("Tick: %.2f ms, extract: %.2f ms (%u items)", simulation.m_TickMs, simulation.m_ExtractMs, simulation.m_Items);
+                ImGui::Text("Input latency: %.1f ms avg, %.1f ms max", simulation.m_InputLatencyMs, simulation.m_MaxInputLatencyMs);
+            }
+        }
+
+        const auto shaders = Nova::App::Rendering::ShaderCache::Get().GetStats();
+        ImGui::SeparatorText("Shader cache");
+        if (!Nova::App::Rendering::ShaderLibrary::IsBinaryCacheSupported())
+            ImGui::TextDisabled("Unavailable: the renderer compiles shaders from source");
+        ImGui::Text("Hits: %u memory, %u disk", shaders.m_MemoryHits, shaders.m_DiskHits);
+        ImGui::Text("Misses: %u (%.1f ms compiling)", shaders.m_Misses, shaders.m_CompileMs);
+        if (shaders.m_Uncached > 0)
+            ImGui::Text("Uncached: %u (%.1f ms compiling)", shaders.m_Uncached, shaders.m_UncachedMs);
+        ImGui::Text("Time saved: %.1f ms", shaders.m_SavedMs);
+
+        const auto& streaming = Nova::App::Streaming::AssetStreamer::Get().GetStats();
+        ImGui::SeparatorText("Streaming");
+        ImGui::Text("Assets: %u loaded, %u in flight, %u failed", streaming.m_Completed, streaming.m_InFlight, streaming.m_Failed);
+        ImGui::Text("Cooked: %u mapped loads, %u meshes cooked", streaming.m_CookedLoads, streaming.m_MeshesCooked);
+        ImGui::Text("Not streamed: %u loaded on the main thread (%.1f ms)", streaming.m_SyncLoads, streaming.m_SyncLoadMs);
+        ImGui::Text("LOD chains: %u (%u levels)", streaming.m_LODChains, streaming.m_LODLevelsUploaded);
+        ImGui::Text("Load latency: %.2f ms avg, %.2f ms max, %.2f ms last",
+            streaming.m_AverageLatencyMs, streaming.m_MaxLatencyMs, streaming.m_LastLatencyMs);
+        ImGui::Text("Uploaded: %.2f MB (%.1f MB/s), %.1f KB this frame",
+            streaming.m_BytesUploaded / (1024.0 * 1024.0), streaming.UploadBandwidthMBs(), streaming.m_BytesUploadedThisFrame / 1024.0);
+        ImGui::Text("Staging: %.1f / %.1f MB, budget %.1f MB/frame",
+            streaming.m_StagingUsed / (1024.0 * 1024.0), streaming.m_StagingCapacity / (1024.0 * 1024.0), streaming.m_UploadBudget / (1024.0 * 1024.0));
+
+        ImGui::SeparatorText("Instancing benchmark");
+        if (benchmark.IsRunning()) {
+            ImGui::TextUnformatted("Running...");
+        }
+        else if (const auto& result = benchmark.GetResult(); result.m_Valid) {
+            ImGui::Text("Cubes: %u", result.m_CubeCount);
+            ImGui::Text("Instanced:     %.2f ms/frame, %.2f ms scene CPU, %u draws",
+                result.m_InstancedFrameMs, result.m_InstancedSceneCpuMs, result.m_InstancedDrawCalls);
+            ImGui::Text("Non-instanced: %.2f ms/frame, %.2f ms scene CPU, %u draws",
+                result.m_BatchedFrameMs, result.m_BatchedSceneCpuMs, result.m_BatchedDrawCalls);
+        }
+        else {
+            ImGui::TextDisabled("Tools > Benchmarks to run.");
+        }
+
+        if (const auto* app = Nova::App::g_AppLayer) {
+            const auto& gpuDriven = app->GetGpuDrivenBenchmark();
+            if (gpuDriven.IsRunning() || gpuDriven.GetResult().m_Valid) {
+                ImGui::SeparatorText("GPU-driven benchmark");
+                if (gpuDriven.IsRunning()) {
+                    ImGui::TextUnformatted("Running...");
+                }
+                else {
+                    const auto& result = gpuDriven.GetResult();
+                    ImGui::Text("Objects: %u%s", result.m_ObjectCount, result.m_GpuSupported ? "" : " (GPU-driven unsupported)");
+                    ImGui::Text("CPU submission: %.3f ms submit, %.2f ms scene CPU, %.2f ms/frame, %u draws",
+                        result.m_Cpu.m_SubmitCpuMs, result.m_Cpu.m_SceneCpuMs, result.m_Cpu.m_FrameMs, result.m_Cpu.m_DrawCalls);
+                    ImGui::Text("GPU-driven:     %.3f ms submit, %.2f ms scene CPU, %.2f ms/frame, %u draws",
+                        result.m_Gpu.m_SubmitCpuMs, result.m_Gpu.m_SceneCpuMs, result.m_Gpu.m_FrameMs, result.m_Gpu.m_DrawCalls);
+                }
+            }
+        }
+
+        const auto& results = Nova::App::Bench::GetReportedResults();
+        if (!results.empty()) {
+            ImGui::SeparatorText("Micro-benchmarks");
+            for (const auto& result : results)
+                ImGui::TextWrapped("%s: %.3f ms (%.1f M items/s)", result.m_Name.c_str(), result.m_Milliseconds, result.ItemsPerSecond() * 1e-6);
+        }
+
+        ImGui::End();
+    }
+
+} // namespace Nova::App::UI::Panels::RenderStatsPanel
@@ -0,0 +1,13 @@
+#ifndef RENDERSTATSPANEL_H
+#define RENDERSTATSPANEL_H
+
+#include "Rendering/RenderStats.h"
+#include "Bench/InstancingBenchmark.h"
+
+namespace Nova::App::UI::Panels::RenderStatsPanel {
+
+    void Render(const Nova::App::Rendering::RenderStats& stats, const Nova::App::Bench::InstancingBenchmark& benchmark);
+
+} // namespace Nova::App::UI::Panels::RenderStatsPanel
+
+#endif // RENDERSTATSPANEL_H
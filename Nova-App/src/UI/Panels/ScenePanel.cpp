@@ -66,6 +66,43 @@ namespace Nova::App::UI::Panels::ScenePanel {
         ImGui::SetNextItemWidth(130.0f);
         ImGui::Combo("##rnd", &s_RenderMode, rndItems, IM_ARRAYSIZE(rndItems));
 
+        // Dynamic resolution: toggle, with the budget and scale bounds in a popup.
+        if (AppLayer* app = Nova::App::g_AppLayer) {
+            auto& dynamicResolution = app->GetDynamicResolution();
+
+            ImGui::SameLine();
+            bool enabled = dynamicResolution.IsEnabled();
+            if (ImGui::Checkbox("Dynamic Res", &enabled))
+                dynamicResolution.SetEnabled(enabled);
+
+            ImGui::SameLine();
+            if (ImGui::ArrowButton("##dynresSettings", ImGuiDir_Down))
+                ImGui::OpenPopup("##dynresPopup");
+
+            if (enabled) {
+                const glm::uvec2 renderSize = app->GetRenderSize();
+                ImGui::SameLine();
+                ImGui::TextDisabled("%.0f%% (%ux%u)", dynamicResolution.GetScale() * 100.0f, renderSize.x, renderSize.y);
+            }
+
+            if (ImGui::BeginPopup("##dynresPopup")) {
+                Rendering::DynamicResolutionSettings settings = dynamicResolution.GetSettings();
+                bool changed = false;
+                changed |= ImGui::SliderFloat("Target (ms)", &settings.m_TargetFrameMs, 4.0f, 50.0f, "%.1f");
+                changed |= ImGui::SliderFloat("Min scale", &settings.m_MinScale, 0.25f, 1.0f, "%.2f");
+                changed |= ImGui::SliderFloat("Max scale", &settings.m_MaxScale, 0.25f, 1.0f, "%.2f");
+                // Only the renderer's upscale pass sharpens; ImGui's stretch is plain bilinear.
+                ImGui::BeginDisabled(!app->IsViewportUpscaleSupported());
+                changed |= ImGui::SliderFloat("Sharpness", &settings.m_Sharpness, 0.0f, 1.0f, "%.2f");
+                ImGui::EndDisabled();
+                if (!app->IsViewportUpscaleSupported())
+                    ImGui::TextDisabled("Upscale: bilinear stretch, no sharpening (renderer has no upscale hook)");
+                if (changed)
+                    dynamicResolution.SetSettings(settings);
+                ImGui::EndPopup();
+            }
+        }
+
         ImGui::EndChild();
     }
 
@@ -107,9 +144,11 @@ namespace Nova::App::UI::Panels::ScenePanel {
                 // OpenGL FBOs have Y=0 at the bottom, so a V-flip is required.
                 // Vulkan/Metal/DX have Y=0 at the top: no flip needed.
                 const GraphicsAPI api = Nova::Core::Application::Get().GetWindow().GetGraphicsAPI();
+                // A pooled target is larger than the panel: only its sub-rect holds the image.
                 const bool needsVFlip = (api == GraphicsAPI::OpenGL);
-                const ImVec2 uv0 = needsVFlip ? ImVec2(0, 1) : ImVec2(0, 0);
-                const ImVec2 uv1 = needsVFlip ? ImVec2(1, 0) : ImVec2(1, 1);
+                const glm::vec2 uv = Nova::App::g_AppLayer->GetViewportUV();
+                const ImVec2 uv0 = needsVFlip ? ImVec2(0, uv.y) : ImVec2(0, 0);
+                const ImVec2 uv1 = needsVFlip ? ImVec2(uv.x, 0) : ImVec2(uv.x, uv.y);
                 ImGui::Image(textureId, size, uv0, uv1);
             }
         }
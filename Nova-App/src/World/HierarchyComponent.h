@@ -0,0 +1,23 @@
+#ifndef HIERARCHYCOMPONENT_H
+#define HIERARCHYCOMPONENT_H
+
+#include <entt/entt.hpp>
+
+namespace Nova::App::World {
+
+    // Parent link of an entity. The world matrix of a child is parent world * child local.
+    // Change it through SetParent (or registry.patch) so the TransformCache sees the update.
+    struct HierarchyComponent {
+        entt::entity m_Parent{ entt::null };
+    };
+
+    inline void SetParent(entt::registry& registry, entt::entity child, entt::entity parent) {
+        if (registry.all_of<HierarchyComponent>(child))
+            registry.patch<HierarchyComponent>(child, [parent](HierarchyComponent& h) { h.m_Parent = parent; });
+        else
+            registry.emplace<HierarchyComponent>(child, parent);
+    }
+
+} // namespace Nova::App::World
+
+#endif // HIERARCHYCOMPONENT_H
@@ -0,0 +1,393 @@
+#include "World/HierarchyIndex.h"
+
+#include <bit>
+#include <chrono>
+#include <algorithm>
+
+#include "World/NameComponent.h"
+
+namespace Nova::App::World {
+
+    namespace {
+
+        char ToLower(char c) {
+            return (c >= 'A' && c <= 'Z') ? static_cast<char>(c - 'A' + 'a') : c;
+        }
+
+        bool IsAlpha(char c) { return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z'); }
+        bool IsDigit(char c) { return c >= '0' && c <= '9'; }
+        bool IsUpper(char c) { return c >= 'A' && c <= 'Z'; }
+        bool IsLower(char c) { return c >= 'a' && c <= 'z'; }
+
+        // A word starts after a separator, at a lower-to-upper case change ("benchCube") and where
+        // letters and digits meet ("Cube12").
+        bool IsWordStart(std::string_view name, size_t i) {
+            const char c = name[i];
+            if (!IsAlpha(c) && !IsDigit(c))
+                return false;
+            if (i == 0)
+                return true;
+
+            const char previous = name[i - 1];
+            if (!IsAlpha(previous) && !IsDigit(previous))
+                return true;
+            return (IsUpper(c) && IsLower(previous)) || (IsDigit(c) != IsDigit(previous));
+        }
+
+        size_t IndexOf(entt::entity entity) {
+            return static_cast<size_t>(entt::to_entity(entity));
+        }
+
+        // Drops the applied front of a queue once it is most of it.
+        void TrimQueue(std::vector<entt::entity>& queue, size_t& cursor) {
+            if (cursor == queue.size())
+                queue.clear();
+            else if (cursor > queue.size() / 2)
+                queue.erase(queue.begin(), queue.begin() + static_cast<std::ptrdiff_t>(cursor));
+            else
+                return;
+            cursor = 0;
+        }
+
+    } // namespace
+
+    void HierarchyIndex::Connect(entt::registry& registry) {
+        Disconnect();
+        m_Registry = &registry;
+
+        registry.on_construct<NameComponent>().connect<&HierarchyIndex::OnNameConstruct>(*this);
+        registry.on_update<NameComponent>().connect<&HierarchyIndex::OnNameUpdate>(*this);
+        registry.on_destroy<NameComponent>().connect<&HierarchyIndex::OnNameDestroy>(*this);
+
+        // Pick up whatever already exists in the registry.
+        m_NeedsRebuild = true;
+    }
+
+    void HierarchyIndex::Disconnect() {
+        if (!m_Registry)
+            return;
+
+        m_Registry->on_construct<NameComponent>().disconnect(this);
+        m_Registry->on_update<NameComponent>().disconnect(this);
+        m_Registry->on_destroy<NameComponent>().disconnect(this);
+        m_Registry = nullptr;
+
+        m_SlotPages.clear();
+        m_Sorted.Clear();
+        m_Words.Clear();
+        m_PendingInsertions.clear();
+        m_PendingRemovals.clear();
+        m_InsertionCursor = 0;
+        m_RemovalCursor = 0;
+        m_Marks.clear();
+        m_NeedsRebuild = false;
+        ++m_Revision;
+    }
+
+    // ---- Signals ----
+
+    void HierarchyIndex::OnNameConstruct(entt::registry&, entt::entity entity) {
+        if (!m_NeedsRebuild)
+            m_PendingInsertions.push_back(entity);
+    }
+
+    void HierarchyIndex::OnNameUpdate(entt::registry&, entt::entity entity) {
+        if (m_NeedsRebuild)
+            return;
+        m_PendingRemovals.push_back(entity);
+        m_PendingInsertions.push_back(entity);
+    }
+
+    void HierarchyIndex::OnNameDestroy(entt::registry&, entt::entity entity) {
+        if (!m_NeedsRebuild)
+            m_PendingRemovals.push_back(entity);
+    }
+
+    // ---- Ordering ----
+
+    namespace {
+
+        // First 16 bytes of `key`, big-endian and zero-padded: orders like the string itself.
+        template <typename Prefix>
+        Prefix PrefixOf(std::string_view key) {
+            Prefix prefix;
+            for (size_t i = 0; i < 8; ++i) {
+                prefix.m_High = (prefix.m_High << 8) | (i < key.size() ? static_cast<uint8_t>(key[i]) : 0u);
+                prefix.m_Low = (prefix.m_Low << 8) | (i + 8 < key.size() ? static_cast<uint8_t>(key[i + 8]) : 0u);
+            }
+            return prefix;
+        }
+
+        // Keeps the first `length` bytes of a prefix.
+        template <typename Prefix>
+        Prefix Truncate(Prefix prefix, size_t length) {
+            auto mask = [](size_t bytes) { return bytes >= 8 ? ~0ull : (bytes == 0 ? 0ull : ~(~0ull >> (8 * bytes))); };
+            prefix.m_High &= mask(length);
+            prefix.m_Low &= mask(length > 8 ? length - 8 : 0);
+            return prefix;
+        }
+
+    } // namespace
+
+    std::string_view HierarchyIndex::KeyOf(entt::entity entity) const {
+        return SlotAt(IndexOf(entity)).m_Key;
+    }
+
+    bool HierarchyIndex::Less(const Entry& a, const Entry& b) const {
+        if (a.m_Prefix != b.m_Prefix)
+            return a.m_Prefix < b.m_Prefix;
+        const int order = KeyOf(a.m_Entity).compare(KeyOf(b.m_Entity));
+        return order != 0 ? order < 0 : entt::to_integral(a.m_Entity) < entt::to_integral(b.m_Entity);
+    }
+
+    bool HierarchyIndex::Less(const WordRef& a, const WordRef& b) const {
+        if (a.m_Prefix != b.m_Prefix)
+            return a.m_Prefix < b.m_Prefix;
+        const int order = SuffixOf(a).compare(SuffixOf(b));
+        return order != 0 ? order < 0 : entt::to_integral(a.m_Entity) < entt::to_integral(b.m_Entity);
+    }
+
+    bool HierarchyIndex::IsIndexed(entt::entity entity) const {
+        const size_t index = IndexOf(entity);
+        return index < SlotCapacity() && SlotAt(index).m_Entity == entity;
+    }
+
+    void HierarchyIndex::ReserveSlots(size_t count) {
+        while (SlotCapacity() < count)
+            m_SlotPages.push_back(std::make_unique<Slot[]>(k_SlotsPerPage));
+    }
+
+    bool HierarchyIndex::IndexEntity(entt::entity entity) {
+        const auto* name = m_Registry->try_get<NameComponent>(entity);
+        if (!name)
+            return false;
+
+        Slot& slot = SlotAt(IndexOf(entity));
+        slot.m_Entity = entity;
+        slot.m_Key.resize(name->m_Name.size());
+        std::transform(name->m_Name.begin(), name->m_Name.end(), slot.m_Key.begin(), ToLower);
+
+        // Word starts need the original case (camelCase boundaries), so they are kept with the key.
+        slot.m_WordStarts = 0;
+        for (size_t i = 0; i < std::min<size_t>(name->m_Name.size(), 64); ++i)
+            if (IsWordStart(name->m_Name, i))
+                slot.m_WordStarts |= 1ull << i;
+        return true;
+    }
+
+    HierarchyIndex::Entry HierarchyIndex::EntryOf(entt::entity entity) const {
+        return { PrefixOf<Prefix>(KeyOf(entity)), entity };
+    }
+
+    template <typename Visit>
+    void HierarchyIndex::ForEachWord(entt::entity entity, Visit visit) const {
+        const std::string_view key = KeyOf(entity);
+        for (uint64_t starts = SlotAt(IndexOf(entity)).m_WordStarts; starts != 0; starts &= starts - 1) {
+            const uint32_t offset = static_cast<uint32_t>(std::countr_zero(starts));
+            visit(WordRef{ PrefixOf<Prefix>(key.substr(offset)), entity, offset });
+        }
+    }
+
+    // ---- Update ----
+
+    bool HierarchyIndex::Update(double budgetMs) {
+        if (!m_Registry)
+            return false;
+
+        using Clock = std::chrono::steady_clock;
+        const auto start = Clock::now();
+
+        bool changed = false;
+        const size_t pending = GetPendingCount();
+        if (m_NeedsRebuild) {
+            Rebuild();
+            changed = true;
+        }
+        else if (pending >= k_MinMergeChanges && pending >= m_Sorted.Size() / k_MergeFraction) {
+            ApplyRemovals(std::span(m_PendingRemovals).subspan(m_RemovalCursor));
+            ApplyInsertions(std::span(m_PendingInsertions).subspan(m_InsertionCursor));
+            m_RemovalCursor = m_PendingRemovals.size();
+            m_InsertionCursor = m_PendingInsertions.size();
+            changed = true;
+        }
+        else if (pending > 0) {
+            const auto deadline = start + std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double, std::milli>(budgetMs));
+            size_t applied = 0;
+            auto outOfTime = [&]() { return ++applied % k_ChangesPerClockCheck == 0 && Clock::now() >= deadline; };
+
+            while (m_RemovalCursor < m_PendingRemovals.size() && !outOfTime())
+                RemoveEntity(m_PendingRemovals[m_RemovalCursor++]);
+
+            // An entity renamed in this queue is only re-inserted after its removal was applied.
+            if (m_RemovalCursor == m_PendingRemovals.size())
+                while (m_InsertionCursor < m_PendingInsertions.size() && !outOfTime())
+                    InsertEntity(m_PendingInsertions[m_InsertionCursor++]);
+            changed = true;
+        }
+        TrimQueue(m_PendingRemovals, m_RemovalCursor);
+        TrimQueue(m_PendingInsertions, m_InsertionCursor);
+
+        if (changed)
+            ++m_Revision;
+        m_LastUpdateMs = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+        return changed;
+    }
+
+    void HierarchyIndex::Rebuild() {
+        m_NeedsRebuild = false;
+
+        m_SlotPages.clear();
+        m_Sorted.Clear();
+        m_Words.Clear();
+        m_PendingInsertions.clear();
+        m_PendingRemovals.clear();
+        m_InsertionCursor = 0;
+        m_RemovalCursor = 0;
+
+        auto view = m_Registry->view<NameComponent>();
+        const std::vector<entt::entity> entities(view.begin(), view.end());
+        ApplyInsertions(entities);
+    }
+
+    void HierarchyIndex::RemoveEntity(entt::entity entity) {
+        if (!IsIndexed(entity))
+            return;
+
+        m_Sorted.Erase(EntryOf(entity), [this](const Entry& a, const Entry& b) { return Less(a, b); });
+        ForEachWord(entity, [this](const WordRef& word) {
+            m_Words.Erase(word, [this](const WordRef& a, const WordRef& b) { return Less(a, b); });
+        });
+        SlotAt(IndexOf(entity)) = {};
+    }
+
+    void HierarchyIndex::InsertEntity(entt::entity entity) {
+        // Skips duplicates (construct then update in the same frame) and entities destroyed since.
+        if (IsIndexed(entity) || !m_Registry->valid(entity))
+            return;
+
+        ReserveSlots(IndexOf(entity) + 1);
+        if (!IndexEntity(entity))
+            return;
+
+        m_Sorted.Insert(EntryOf(entity), [this](const Entry& a, const Entry& b) { return Less(a, b); });
+        ForEachWord(entity, [this](const WordRef& word) {
+            m_Words.Insert(word, [this](const WordRef& a, const WordRef& b) { return Less(a, b); });
+        });
+    }
+
+    void HierarchyIndex::ApplyRemovals(std::span<const entt::entity> entities) {
+        // Many removals (a cleared scene): one pass over the index with the removed slots marked.
+        if (m_Marks.size() < SlotCapacity())
+            m_Marks.resize(SlotCapacity(), 0);
+
+        bool any = false;
+        for (const entt::entity entity : entities) {
+            if (IsIndexed(entity)) {
+                m_Marks[IndexOf(entity)] = 1;
+                any = true;
+            }
+        }
+        if (!any)
+            return;
+
+        // A slot holds one indexed entity at a time, so the mark of its index identifies it.
+        m_Sorted.EraseIf([this](const Entry& entry) { return m_Marks[IndexOf(entry.m_Entity)] != 0; });
+        m_Words.EraseIf([this](const WordRef& word) { return m_Marks[IndexOf(word.m_Entity)] != 0; });
+
+        for (const entt::entity entity : entities) {
+            const size_t index = IndexOf(entity);
+            if (index < m_Marks.size() && m_Marks[index]) {
+                m_Marks[index] = 0;
+                SlotAt(index) = {};
+            }
+        }
+    }
+
+    void HierarchyIndex::ApplyInsertions(std::span<const entt::entity> entities) {
+        if (entities.empty())
+            return;
+
+        // Slots are sized once for the whole batch.
+        size_t maxIndex = 0;
+        for (const entt::entity entity : entities)
+            maxIndex = std::max(maxIndex, IndexOf(entity));
+        ReserveSlots(maxIndex + 1);
+
+        // Skips duplicates (construct then update in the same frame) and entities destroyed since.
+        std::vector<Entry> added;
+        added.reserve(entities.size());
+        for (const entt::entity entity : entities) {
+            if (IsIndexed(entity) || !m_Registry->valid(entity))
+                continue;
+            if (IndexEntity(entity))
+                added.push_back(EntryOf(entity));
+        }
+        if (added.empty())
+            return;
+
+        const auto lessEntry = [this](const Entry& a, const Entry& b) { return Less(a, b); };
+        const auto lessWord = [this](const WordRef& a, const WordRef& b) { return Less(a, b); };
+
+        // Sort the batch, then merge it in: O(k log k + n) instead of k single insertions.
+        std::vector<WordRef> words;
+        words.reserve(added.size() * 2);
+        for (const Entry& entry : added)
+            ForEachWord(entry.m_Entity, [&](const WordRef& word) { words.push_back(word); });
+
+        std::sort(added.begin(), added.end(), lessEntry);
+        m_Sorted.MergeSorted(added, lessEntry);
+
+        std::sort(words.begin(), words.end(), lessWord);
+        m_Words.MergeSorted(words, lessWord);
+    }
+
+    // ---- Search ----
+
+    void HierarchyIndex::Search(std::string_view query, std::vector<entt::entity>& out) {
+        out.clear();
+
+        std::string key(query.size(), '\0');
+        std::transform(query.begin(), query.end(), key.begin(), ToLower);
+        if (key.empty())
+            return;
+
+        if (m_Marks.size() < SlotCapacity())
+            m_Marks.resize(SlotCapacity(), 0);
+
+        // Words are sorted by their suffix: the matches are one contiguous range, found and walked
+        // on the prefixes alone when the query fits in them.
+        const Prefix prefix = PrefixOf<Prefix>(key);
+        const auto first = m_Words.PartitionPoint([&](const WordRef& word) {
+            return word.m_Prefix != prefix ? word.m_Prefix < prefix : SuffixOf(word) < key;
+        });
+        m_Words.VisitFrom(first, [&](const WordRef& word) {
+            if (Truncate(word.m_Prefix, key.size()) != prefix)
+                return false;
+            if (key.size() > 16 && !SuffixOf(word).starts_with(key))
+                return false;
+
+            uint8_t& mark = m_Marks[IndexOf(word.m_Entity)];
+            if (!mark) {
+                mark = 1;
+                out.push_back(word.m_Entity);
+            }
+            return true;
+        });
+
+        // Back into name order: sort a few matches, walk the whole list for many.
+        if (out.size() > m_Sorted.Size() / 16) {
+            out.clear();
+            m_Sorted.ForEach([&](const Entry& entry) {
+                if (m_Marks[IndexOf(entry.m_Entity)])
+                    out.push_back(entry.m_Entity);
+            });
+        }
+        else {
+            std::sort(out.begin(), out.end(), [this](entt::entity a, entt::entity b) { return Less(EntryOf(a), EntryOf(b)); });
+        }
+
+        for (const entt::entity entity : out)
+            m_Marks[IndexOf(entity)] = 0;
+    }
+
+} // namespace Nova::App::World
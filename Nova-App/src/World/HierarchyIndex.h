@@ -0,0 +1,141 @@
+#ifndef HIERARCHYINDEX_H
+#define HIERARCHYINDEX_H
+
+#include <string>
+#include <span>
+#include <vector>
+#include <cstdint>
+#include <string_view>
+
+#include <entt/entt.hpp>
+
+#include "World/SortedBlockList.h"
+
+namespace Nova::App::World {
+
+    // Name-sorted list of every entity with a NameComponent, kept up to date from registry signals,
+    // plus a word index for the Hierarchy panel's filter.
+    //
+    // Signals only queue the entity; Update() applies the queue once per frame within a time budget
+    // and leaves the rest queued for the next frame. Edits and renames are inserted and erased one
+    // by one in SortedBlockLists, so they cost O(log n) each rather than moving the whole index;
+    // batches that replace a large part of the index (scene load, clear) take the O(n) merge path
+    // at once, as the load itself already does. Renames must go through registry.patch/replace to
+    // be seen.
+    //
+    // Entities are ordered by lower-case name, then by id. The word index holds one entry per word
+    // start in each name ("BenchCube 12" -> "benchcube 12", "cube 12", "12"), sorted the same way,
+    // so a filter is a binary search for the entries starting with the query.
+    class HierarchyIndex {
+    public:
+        HierarchyIndex() = default;
+        ~HierarchyIndex() { Disconnect(); }
+
+        HierarchyIndex(const HierarchyIndex&) = delete;
+        HierarchyIndex& operator=(const HierarchyIndex&) = delete;
+
+        void Connect(entt::registry& registry);
+        void Disconnect();
+
+        static constexpr double k_FrameBudgetMs = 1.0;
+
+        // Applies queued changes for about `budgetMs`; returns true when the index changed.
+        bool Update(double budgetMs = k_FrameBudgetMs);
+
+        // Changes still queued after the last Update().
+        size_t GetPendingCount() const {
+            return (m_PendingRemovals.size() - m_RemovalCursor) + (m_PendingInsertions.size() - m_InsertionCursor);
+        }
+
+        size_t Size() const { return m_Sorted.Size(); }
+        entt::entity At(size_t position) const { return m_Sorted[position].m_Entity; }
+
+        // Bumped by every Update() that changes the index.
+        uint64_t GetRevision() const { return m_Revision; }
+        double GetLastUpdateMs() const { return m_LastUpdateMs; }
+
+        // Entities with a word starting with `query` (case-insensitive; spaces allowed), in index order.
+        void Search(std::string_view query, std::vector<entt::entity>& out);
+
+    private:
+        // A queue takes the merge path when it holds this many changes and at least 1/k_MergeFraction
+        // of the index; the clock is read every k_ChangesPerClockCheck changes.
+        static constexpr size_t k_MinMergeChanges = 4096;
+        static constexpr size_t k_MergeFraction = 4;
+        static constexpr size_t k_ChangesPerClockCheck = 16;
+        static constexpr size_t k_SlotsPerPage = 4096;
+
+        struct Slot {
+            entt::entity m_Entity{ entt::null };   // null when the slot is not indexed
+            std::string  m_Key;                    // lower-case name
+            uint64_t     m_WordStarts{ 0 };        // bit i: a word starts at m_Key[i] (first 64 characters)
+        };
+
+        // Entries carry the first 16 bytes of their key, big-endian, so most comparisons are integer
+        // compares on contiguous memory; only longer keys with equal prefixes look at the keys.
+        struct Prefix {
+            uint64_t m_High{ 0 };
+            uint64_t m_Low{ 0 };
+            auto operator<=>(const Prefix&) const = default;
+        };
+
+        struct Entry {
+            Prefix       m_Prefix;
+            entt::entity m_Entity;
+        };
+
+        struct WordRef {
+            Prefix       m_Prefix;
+            entt::entity m_Entity;
+            uint32_t     m_Offset;   // into the key
+        };
+
+        void OnNameConstruct(entt::registry& registry, entt::entity entity);
+        void OnNameUpdate(entt::registry& registry, entt::entity entity);
+        void OnNameDestroy(entt::registry& registry, entt::entity entity);
+
+        void Rebuild();
+        void ApplyRemovals(std::span<const entt::entity> entities);
+        void ApplyInsertions(std::span<const entt::entity> entities);
+        void RemoveEntity(entt::entity entity);
+        void InsertEntity(entt::entity entity);
+
+        // Fills the slot of `entity`; false when it has no name.
+        bool IndexEntity(entt::entity entity);
+        Entry EntryOf(entt::entity entity) const;
+        template <typename Visit>
+        void ForEachWord(entt::entity entity, Visit visit) const;
+        bool IsIndexed(entt::entity entity) const;
+
+        size_t SlotCapacity() const { return m_SlotPages.size() * k_SlotsPerPage; }
+        void ReserveSlots(size_t count);
+        Slot& SlotAt(size_t index) { return m_SlotPages[index / k_SlotsPerPage][index % k_SlotsPerPage]; }
+        const Slot& SlotAt(size_t index) const { return m_SlotPages[index / k_SlotsPerPage][index % k_SlotsPerPage]; }
+
+        std::string_view KeyOf(entt::entity entity) const;
+        std::string_view SuffixOf(const WordRef& word) const { return KeyOf(word.m_Entity).substr(word.m_Offset); }
+        bool Less(const Entry& a, const Entry& b) const;
+        bool Less(const WordRef& a, const WordRef& b) const;
+
+        entt::registry* m_Registry{ nullptr };
+
+        // Slots indexed by entt::to_entity, in fixed pages so growing never moves the filled ones.
+        std::vector<std::unique_ptr<Slot[]>> m_SlotPages;
+        SortedBlockList<Entry>    m_Sorted;
+        SortedBlockList<WordRef>  m_Words;
+
+        // Removals are applied before insertions; the cursors mark how far each queue got.
+        std::vector<entt::entity> m_PendingInsertions;
+        std::vector<entt::entity> m_PendingRemovals;
+        size_t                    m_InsertionCursor{ 0 };
+        size_t                    m_RemovalCursor{ 0 };
+        std::vector<uint8_t>      m_Marks;    // scratch, indexed by entt::to_entity
+
+        uint64_t m_Revision{ 0 };
+        double   m_LastUpdateMs{ 0.0 };
+        bool     m_NeedsRebuild{ false };
+    };
+
+} // namespace Nova::App::World
+
+#endif // HIERARCHYINDEX_H
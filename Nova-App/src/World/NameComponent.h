@@ -0,0 +1,26 @@
+#ifndef NAMECOMPONENT_H
+#define NAMECOMPONENT_H
+
+#include <string>
+#include <utility>
+
+#include <entt/entt.hpp>
+
+namespace Nova::App::World {
+
+    // Display name of an entity, as shown in the editor and stored in scene files.
+    struct NameComponent {
+        std::string m_Name;
+    };
+
+    // Scene::CreateEntity plus the name the editor side reads back.
+    template <typename Scene>
+    entt::entity CreateNamedEntity(Scene& scene, std::string name) {
+        const entt::entity entity = scene.CreateEntity(name.c_str());
+        scene.GetRegistry().template emplace<NameComponent>(entity, std::move(name));
+        return entity;
+    }
+
+} // namespace Nova::App::World
+
+#endif // NAMECOMPONENT_H
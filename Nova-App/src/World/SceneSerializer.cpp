@@ -0,0 +1,781 @@
+#include "World/SceneSerializer.h"
+
+#include <span>
+#include <chrono>
+#include <format>
+#include <string>
+#include <cstring>
+#include <fstream>
+#include <concepts>
+#include <numeric>
+#include <algorithm>
+#include <string_view>
+#include <unordered_map>
+
+#include "Core/Log.h"
+
+#include "Asset/Assets/MeshAsset.h"
+#include "Scene/ECS/Components/TransformComponent.h"
+#include "Scene/ECS/Components/MeshRendererComponent.h"
+#include "Scene/ECS/Components/CameraComponent.h"
+
+#include "Jobs/JobSystem.h"
+#include "Streaming/AssetStreamer.h"
+#include "Streaming/MappedFile.h"
+#include "World/HierarchyComponent.h"
+#include "World/NameComponent.h"
+
+namespace Nova::App::World {
+
+    using Nova::Core::Scene::ECS::Components::TransformComponent;
+    using Nova::Core::Scene::ECS::Components::MeshRendererComponent;
+    using Nova::Core::Scene::ECS::Components::CameraComponent;
+    using Nova::Core::Asset::Assets::MeshAsset;
+
+    namespace {
+
+        using Clock = std::chrono::steady_clock;
+        using MeshRef = std::remove_cvref_t<decltype(std::declval<MeshRendererComponent&>().m_MeshAsset)>;
+        using Material = std::remove_cvref_t<decltype(std::declval<MeshRendererComponent&>().m_Material)>;
+
+        constexpr uint32_t FourCC(const char (&code)[5]) {
+            return static_cast<uint32_t>(code[0]) | (static_cast<uint32_t>(code[1]) << 8) |
+                   (static_cast<uint32_t>(code[2]) << 16) | (static_cast<uint32_t>(code[3]) << 24);
+        }
+
+        constexpr uint32_t k_AssetColumn     = FourCC("ASST");
+        constexpr uint32_t k_TransformColumn = FourCC("XFRM");
+        constexpr uint32_t k_HierarchyColumn = FourCC("HIER");
+        constexpr uint32_t k_MeshColumn      = FourCC("MESH");
+        constexpr uint32_t k_CameraColumn    = FourCC("CAMR");
+        constexpr uint32_t k_NameColumn      = FourCC("NAME");
+
+        constexpr uint32_t k_NoIndex = 0xFFFFFFFFu;
+
+        // ---- On-disk records (version 1 of each column) ----
+
+        struct TransformRecord {
+            float m_Position[3];
+            float m_Rotation[3];
+            float m_Scale[3];
+        };
+        static_assert(sizeof(TransformRecord) == 36);
+
+        // Version 2 is followed by a MaterialRecord. Version 1 was followed by the raw Material bytes,
+        // which are not read back: only its base colour is.
+        struct MeshRecord {
+            uint32_t m_Asset;   // index into the asset table, k_NoIndex for none
+            float    m_BaseColor[3];
+        };
+        static_assert(sizeof(MeshRecord) == 16);
+
+        // Material fields by how they are stored: float, three floats, or a bit of m_Flags.
+#define NV_MATERIAL_SCALARS(X) \
+    X(base) X(diffuseRoughness) X(metalness) \
+    X(specular) X(specularRoughness) X(specularIOR) X(specularAnisotropy) X(specularRotation) \
+    X(transmission) X(subsurface) X(subsurfaceScale) X(subsurfaceAnisotropy) X(sheen) X(sheenRoughness) \
+    X(coat) X(coatRoughness) X(coatAnisotropy) X(coatRotation) X(coatIOR) X(coatAffectColor) X(coatAffectRoughness) \
+    X(emission)
+#define NV_MATERIAL_COLORS(X) \
+    X(baseColor) X(metalColor) X(specularColor) X(transmissionColor) X(subsurfaceColor) X(subsurfaceRadius) \
+    X(sheenColor) X(coatColor) X(emissionColor) X(opacity)
+#define NV_MATERIAL_FLAGS(X) X(thinWalled) X(isOpaque)
+#define NV_COUNT_FIELD(field) + 1
+
+        constexpr uint32_t k_MaterialScalars = 0 NV_MATERIAL_SCALARS(NV_COUNT_FIELD);
+        constexpr uint32_t k_MaterialColors = 0 NV_MATERIAL_COLORS(NV_COUNT_FIELD);
+#undef NV_COUNT_FIELD
+
+        // Every field written explicitly, so the record does not depend on Material's layout.
+        struct MaterialRecord {
+            float    m_Scalars[k_MaterialScalars];
+            float    m_Colors[k_MaterialColors][3];
+            uint32_t m_Flags;
+        };
+        static_assert(sizeof(MaterialRecord) == 212);
+
+        constexpr uint32_t k_MeshColumnVersion = 2;
+
+        struct CameraRecord {
+            float    m_LookFrom[3];
+            float    m_LookAt[3];
+            float    m_Up[3];
+            float    m_FOV;
+            float    m_AspectRatio;
+            float    m_NearPlane;
+            float    m_FarPlane;
+            uint32_t m_Perspective;
+            uint32_t m_Primary;
+        };
+        static_assert(sizeof(CameraRecord) == 60);
+
+        // The camera column needs the Camera behind the component and its primary flag.
+        template <typename Component>
+        concept CameraComponentAccess = requires(const Component& component) {
+            component.m_Camera->m_LookFrom;
+            component.m_Camera->m_FOV;
+            { component.m_IsPrimary } -> std::convertible_to<bool>;
+        };
+
+        void StoreVec3(float (&out)[3], const glm::vec3& value) { out[0] = value.x; out[1] = value.y; out[2] = value.z; }
+        glm::vec3 LoadVec3(const float (&in)[3]) { return { in[0], in[1], in[2] }; }
+
+        MaterialRecord StoreMaterial(const Material& material) {
+            MaterialRecord record{};
+            uint32_t scalar = 0, color = 0, flag = 0;
+#define NV_STORE_SCALAR(field) record.m_Scalars[scalar++] = static_cast<float>(material.field);
+#define NV_STORE_COLOR(field) StoreVec3(record.m_Colors[color++], glm::vec3(material.field));
+#define NV_STORE_FLAG(field) record.m_Flags |= (material.field ? 1u : 0u) << flag++;
+            NV_MATERIAL_SCALARS(NV_STORE_SCALAR)
+            NV_MATERIAL_COLORS(NV_STORE_COLOR)
+            NV_MATERIAL_FLAGS(NV_STORE_FLAG)
+#undef NV_STORE_SCALAR
+#undef NV_STORE_COLOR
+#undef NV_STORE_FLAG
+            return record;
+        }
+
+        Material LoadMaterial(const MaterialRecord& record) {
+            Material material{};
+            uint32_t scalar = 0, color = 0, flag = 0;
+#define NV_LOAD_SCALAR(field) material.field = static_cast<decltype(material.field)>(record.m_Scalars[scalar++]);
+#define NV_LOAD_COLOR(field) material.field = decltype(material.field)(LoadVec3(record.m_Colors[color++]));
+#define NV_LOAD_FLAG(field) material.field = static_cast<decltype(material.field)>((record.m_Flags >> flag++) & 1u);
+            NV_MATERIAL_SCALARS(NV_LOAD_SCALAR)
+            NV_MATERIAL_COLORS(NV_LOAD_COLOR)
+            NV_MATERIAL_FLAGS(NV_LOAD_FLAG)
+#undef NV_LOAD_SCALAR
+#undef NV_LOAD_COLOR
+#undef NV_LOAD_FLAG
+            return material;
+        }
+
+#undef NV_MATERIAL_SCALARS
+#undef NV_MATERIAL_COLORS
+#undef NV_MATERIAL_FLAGS
+
+        // File number to created entity; null for numbers outside the file's range.
+        entt::entity ToEntity(std::span<const entt::entity> created, uint32_t number) {
+            if (number < created.size())
+                return created[number];
+            return entt::null;
+        }
+
+        template <typename T>
+        T ReadRecord(const std::byte* data) {
+            T value;
+            std::memcpy(&value, data, sizeof(T));
+            return value;
+        }
+
+        // ---- Writing ----
+
+        class SceneWriter {
+        public:
+            SceneWriter() { m_Buffer.resize(sizeof(SceneFileHeader)); }
+
+            // Fixed-size column: `write(index, out)` fills one element of `elementSize` bytes.
+            template <typename Write>
+            void AddColumn(uint32_t column, uint32_t version, uint32_t elementSize,
+                           std::span<const uint32_t> entities, bool dense, Write&& write) {
+                for (size_t first = 0; first < entities.size(); first += k_SceneChunkEntities) {
+                    const uint32_t count = static_cast<uint32_t>(std::min<size_t>(k_SceneChunkEntities, entities.size() - first));
+                    SceneChunkHeader& chunk = BeginChunk(column, version, elementSize, count, entities, first, dense);
+
+                    std::byte* out = Grow(static_cast<size_t>(count) * elementSize);
+                    for (uint32_t i = 0; i < count; ++i)
+                        write(first + i, out + static_cast<size_t>(i) * elementSize);
+
+                    EndChunk(chunk);
+                }
+            }
+
+            // Variable-size column: `get(index)` returns a string_view of the element bytes.
+            template <typename Get>
+            void AddVariableColumn(uint32_t column, uint32_t version, std::span<const uint32_t> entities, bool dense, Get&& get) {
+                for (size_t first = 0; first < entities.size(); first += k_SceneChunkEntities) {
+                    const uint32_t count = static_cast<uint32_t>(std::min<size_t>(k_SceneChunkEntities, entities.size() - first));
+                    SceneChunkHeader& chunk = BeginChunk(column, version, 0, count, entities, first, dense);
+
+                    const size_t offsetsAt = Grow((count + 1) * sizeof(uint32_t)) - m_Buffer.data();
+                    uint32_t offset = 0;
+                    for (uint32_t i = 0; i <= count; ++i) {
+                        std::memcpy(m_Buffer.data() + offsetsAt + i * sizeof(uint32_t), &offset, sizeof(uint32_t));
+                        if (i == count)
+                            break;
+
+                        const std::string_view bytes = get(first + i);
+                        std::memcpy(Grow(bytes.size()), bytes.data(), bytes.size());
+                        offset += static_cast<uint32_t>(bytes.size());
+                    }
+
+                    EndChunk(chunk);
+                }
+            }
+
+            std::span<const std::byte> Finish(uint32_t entityCount) {
+                Align();
+
+                SceneFileHeader header{};
+                header.m_EntityCount = entityCount;
+                header.m_ChunkCount = static_cast<uint32_t>(m_Chunks.size());
+                header.m_ChunkTableOffset = m_Buffer.size();
+
+                const size_t tableSize = m_Chunks.size() * sizeof(SceneChunkHeader);
+                std::memcpy(Grow(tableSize), m_Chunks.data(), tableSize);
+                std::memcpy(m_Buffer.data(), &header, sizeof(header));
+                return m_Buffer;
+            }
+
+            uint32_t GetChunkCount() const { return static_cast<uint32_t>(m_Chunks.size()); }
+
+        private:
+            std::byte* Grow(size_t size) {
+                const size_t at = m_Buffer.size();
+                m_Buffer.resize(at + size);
+                return m_Buffer.data() + at;
+            }
+
+            void Align() {
+                m_Buffer.resize((m_Buffer.size() + k_SceneChunkAlignment - 1) & ~static_cast<size_t>(k_SceneChunkAlignment - 1));
+            }
+
+            SceneChunkHeader& BeginChunk(uint32_t column, uint32_t version, uint32_t elementSize, uint32_t count,
+                                         std::span<const uint32_t> entities, size_t first, bool dense) {
+                Align();
+
+                SceneChunkHeader& chunk = m_Chunks.emplace_back();
+                chunk.m_Column = column;
+                chunk.m_ColumnVersion = version;
+                chunk.m_ElementSize = elementSize;
+                chunk.m_Count = count;
+                chunk.m_FirstEntity = entities.empty() ? 0 : entities[first];
+                chunk.m_Flags = dense ? SceneChunkHeader::k_Dense : 0;
+                chunk.m_Offset = m_Buffer.size();
+
+                if (!dense)
+                    std::memcpy(Grow(count * sizeof(uint32_t)), entities.data() + first, count * sizeof(uint32_t));
+                return chunk;
+            }
+
+            void EndChunk(SceneChunkHeader& chunk) {
+                chunk.m_Size = m_Buffer.size() - chunk.m_Offset;
+            }
+
+            std::vector<std::byte> m_Buffer;
+            std::vector<SceneChunkHeader> m_Chunks;
+        };
+
+        // File numbers for entities, indexed by entt::to_entity.
+        class EntityNumbering {
+        public:
+            uint32_t Add(entt::entity entity) {
+                const size_t slot = entt::to_entity(entity);
+                if (slot >= m_Numbers.size())
+                    m_Numbers.resize(slot + 1, k_NoIndex);
+                if (m_Numbers[slot] == k_NoIndex) {
+                    m_Numbers[slot] = static_cast<uint32_t>(m_Entities.size());
+                    m_Entities.push_back(entity);
+                }
+                return m_Numbers[slot];
+            }
+
+            uint32_t Find(entt::entity entity) const {
+                if (entity == entt::null)
+                    return k_NoIndex;
+                const size_t slot = entt::to_entity(entity);
+                return slot < m_Numbers.size() ? m_Numbers[slot] : k_NoIndex;
+            }
+
+            uint32_t Size() const { return static_cast<uint32_t>(m_Entities.size()); }
+
+        private:
+            std::vector<uint32_t> m_Numbers;
+            std::vector<entt::entity> m_Entities;
+        };
+
+        template <typename Component>
+        void CollectColumn(const entt::registry& registry, EntityNumbering& numbering,
+                           std::vector<entt::entity>& entities, std::vector<uint32_t>& numbers) {
+            auto view = registry.view<const Component>();
+            entities.assign(view.begin(), view.end());
+            for (const entt::entity entity : entities)
+                numbering.Add(entity);
+
+            // In file order: the reader rejects a column whose numbers do not strictly increase.
+            std::sort(entities.begin(), entities.end(), [&](entt::entity a, entt::entity b) { return numbering.Find(a) < numbering.Find(b); });
+            numbers.resize(entities.size());
+            for (size_t i = 0; i < entities.size(); ++i)
+                numbers[i] = numbering.Find(entities[i]);
+        }
+
+        // Contiguous 0..n-1 numbers: the chunk can omit its entity list.
+        bool IsDense(std::span<const uint32_t> numbers) {
+            for (size_t i = 0; i < numbers.size(); ++i)
+                if (numbers[i] != i)
+                    return false;
+            return true;
+        }
+
+        bool WriteFile(const std::filesystem::path& path, std::span<const std::byte> bytes) {
+            std::error_code error;
+            if (path.has_parent_path())
+                std::filesystem::create_directories(path.parent_path(), error);
+
+            // Written under a temporary name and renamed, so a crash never leaves a truncated scene.
+            std::filesystem::path temporaryPath = path;
+            temporaryPath += ".tmp";
+            {
+                std::ofstream file(temporaryPath, std::ios::binary | std::ios::trunc);
+                if (!file)
+                    return false;
+                file.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+                if (!file)
+                    return false;
+            }
+
+            std::filesystem::rename(temporaryPath, path, error);
+            if (error) {
+                std::filesystem::remove(temporaryPath, error);
+                return false;
+            }
+            return true;
+        }
+
+        // ---- Reading ----
+
+        struct ChunkView {
+            const SceneChunkHeader* m_Header{ nullptr };
+            const std::byte* m_Entities{ nullptr };   // null for dense chunks
+            const std::byte* m_Elements{ nullptr };
+            size_t m_ElementsSize{ 0 };
+
+            uint32_t EntityAt(uint32_t i) const {
+                return m_Entities ? ReadRecord<uint32_t>(m_Entities + i * sizeof(uint32_t)) : m_Header->m_FirstEntity + i;
+            }
+        };
+
+        // Bounds-checks a chunk against the file and its own layout.
+        bool ResolveChunk(std::span<const std::byte> file, const SceneChunkHeader& header, bool hasEntities, ChunkView& view) {
+            if (header.m_Offset > file.size() || header.m_Size > file.size() - header.m_Offset)
+                return false;
+
+            const std::byte* data = file.data() + header.m_Offset;
+            size_t size = header.m_Size;
+
+            view.m_Header = &header;
+            view.m_Entities = nullptr;
+            if (hasEntities && !(header.m_Flags & SceneChunkHeader::k_Dense)) {
+                const size_t entitiesSize = static_cast<size_t>(header.m_Count) * sizeof(uint32_t);
+                if (entitiesSize > size)
+                    return false;
+                view.m_Entities = data;
+                data += entitiesSize;
+                size -= entitiesSize;
+            }
+
+            if (header.m_ElementSize > 0) {
+                if (static_cast<uint64_t>(header.m_Count) * header.m_ElementSize > size)
+                    return false;
+            }
+            else if ((static_cast<size_t>(header.m_Count) + 1) * sizeof(uint32_t) > size) {
+                return false;
+            }
+
+            view.m_Elements = data;
+            view.m_ElementsSize = size;
+            return true;
+        }
+
+        // A column lists each entity once, in ascending order across its chunks; `last` carries over
+        // from the column's previous chunk. Anything else would hand the bulk insert a duplicate.
+        bool EntitiesAscending(const ChunkView& chunk, int64_t& last) {
+            for (uint32_t i = 0; i < chunk.m_Header->m_Count; ++i) {
+                const int64_t number = chunk.EntityAt(i);
+                if (number <= last)
+                    return false;
+                last = number;
+            }
+            return true;
+        }
+
+        // Element `i` of a variable-size chunk; empty when the offsets are out of range.
+        std::string_view VariableElement(const ChunkView& chunk, uint32_t i) {
+            const size_t tableSize = (static_cast<size_t>(chunk.m_Header->m_Count) + 1) * sizeof(uint32_t);
+            const uint32_t begin = ReadRecord<uint32_t>(chunk.m_Elements + i * sizeof(uint32_t));
+            const uint32_t end = ReadRecord<uint32_t>(chunk.m_Elements + (i + 1) * sizeof(uint32_t));
+            if (begin > end || tableSize + end > chunk.m_ElementsSize)
+                return {};
+            return { reinterpret_cast<const char*>(chunk.m_Elements + tableSize + begin), end - begin };
+        }
+
+        // One decoded chunk, ready for a bulk insert.
+        struct DecodedChunk {
+            uint32_t m_Column{ 0 };
+            std::vector<entt::entity> m_Targets;
+
+            std::vector<TransformComponent>    m_Transforms;
+            std::vector<HierarchyComponent>    m_Hierarchy;
+            std::vector<MeshRendererComponent> m_Meshes;
+            std::vector<NameComponent>         m_Names;
+        };
+
+        void DecodeChunk(const ChunkView& chunk, std::span<const entt::entity> created,
+                         std::span<const MeshRef> assets, DecodedChunk& out) {
+            const SceneChunkHeader& header = *chunk.m_Header;
+            out.m_Column = header.m_Column;
+            out.m_Targets.reserve(header.m_Count);
+
+            auto target = [&](uint32_t i) { return ToEntity(created, chunk.EntityAt(i)); };
+
+            switch (header.m_Column) {
+                case k_TransformColumn:
+                    out.m_Transforms.reserve(header.m_Count);
+                    for (uint32_t i = 0; i < header.m_Count; ++i) {
+                        const entt::entity entity = target(i);
+                        if (entity == entt::null)
+                            continue;
+                        const auto record = ReadRecord<TransformRecord>(chunk.m_Elements + i * sizeof(TransformRecord));
+                        out.m_Targets.push_back(entity);
+                        out.m_Transforms.push_back(TransformComponent{ LoadVec3(record.m_Position), LoadVec3(record.m_Rotation), LoadVec3(record.m_Scale) });
+                    }
+                    break;
+
+                case k_HierarchyColumn:
+                    out.m_Hierarchy.reserve(header.m_Count);
+                    for (uint32_t i = 0; i < header.m_Count; ++i) {
+                        const entt::entity entity = target(i);
+                        if (entity == entt::null)
+                            continue;
+                        const uint32_t parent = ReadRecord<uint32_t>(chunk.m_Elements + i * sizeof(uint32_t));
+                        out.m_Targets.push_back(entity);
+                        out.m_Hierarchy.push_back({ ToEntity(created, parent) });
+                    }
+                    break;
+
+                case k_MeshColumn: {
+                    const bool full = header.m_ColumnVersion == k_MeshColumnVersion;
+                    out.m_Meshes.reserve(header.m_Count);
+                    for (uint32_t i = 0; i < header.m_Count; ++i) {
+                        const entt::entity entity = target(i);
+                        if (entity == entt::null)
+                            continue;
+
+                        const std::byte* element = chunk.m_Elements + static_cast<size_t>(i) * header.m_ElementSize;
+                        const auto record = ReadRecord<MeshRecord>(element);
+
+                        Material material{};
+                        if (full)
+                            material = LoadMaterial(ReadRecord<MaterialRecord>(element + sizeof(MeshRecord)));
+                        else
+                            material.baseColor = LoadVec3(record.m_BaseColor);
+
+                        out.m_Targets.push_back(entity);
+                        out.m_Meshes.push_back(MeshRendererComponent{ record.m_Asset < assets.size() ? assets[record.m_Asset] : MeshRef{}, material });
+                    }
+                    break;
+                }
+
+                case k_NameColumn:
+                    out.m_Names.reserve(header.m_Count);
+                    for (uint32_t i = 0; i < header.m_Count; ++i) {
+                        const entt::entity entity = target(i);
+                        if (entity == entt::null)
+                            continue;
+                        out.m_Targets.push_back(entity);
+                        out.m_Names.push_back({ std::string(VariableElement(chunk, i)) });
+                    }
+                    break;
+            }
+        }
+
+        template <typename Component>
+        void InsertCameras(entt::registry& registry, const ChunkView& chunk, std::span<const entt::entity> created) {
+            if constexpr (CameraComponentAccess<Component>) {
+                using CameraType = std::remove_cvref_t<decltype(*std::declval<const Component&>().m_Camera)>;
+
+                const SceneChunkHeader& header = *chunk.m_Header;
+                for (uint32_t i = 0; i < header.m_Count; ++i) {
+                    const uint32_t number = chunk.EntityAt(i);
+                    if (number >= created.size())
+                        continue;
+
+                    const auto record = ReadRecord<CameraRecord>(chunk.m_Elements + i * sizeof(CameraRecord));
+                    auto camera = std::make_shared<CameraType>(
+                        LoadVec3(record.m_LookFrom), LoadVec3(record.m_LookAt), LoadVec3(record.m_Up),
+                        record.m_FOV, record.m_AspectRatio, record.m_NearPlane, record.m_FarPlane, record.m_Perspective != 0);
+                    registry.emplace<Component>(created[number], camera, record.m_Primary != 0);
+                }
+            }
+        }
+
+        template <typename Component>
+        void WriteCameras(const entt::registry& registry, SceneWriter& writer, EntityNumbering& numbering) {
+            if constexpr (CameraComponentAccess<Component>) {
+                std::vector<entt::entity> entities;
+                std::vector<uint32_t> numbers;
+                CollectColumn<Component>(registry, numbering, entities, numbers);
+
+                writer.AddColumn(k_CameraColumn, 1, sizeof(CameraRecord), numbers, false, [&](size_t i, std::byte* out) {
+                    const auto& component = registry.get<Component>(entities[i]);
+                    const auto& camera = *component.m_Camera;
+
+                    CameraRecord record{};
+                    StoreVec3(record.m_LookFrom, camera.m_LookFrom);
+                    StoreVec3(record.m_LookAt, camera.m_LookAt);
+                    StoreVec3(record.m_Up, camera.m_Up);
+                    record.m_FOV = camera.m_FOV;
+                    record.m_AspectRatio = camera.m_AspectRatio;
+                    record.m_NearPlane = camera.m_NearPlane;
+                    record.m_FarPlane = camera.m_FarPlane;
+                    record.m_Perspective = camera.m_IsPerspective ? 1u : 0u;
+                    record.m_Primary = component.m_IsPrimary ? 1u : 0u;
+                    std::memcpy(out, &record, sizeof(record));
+                });
+            }
+            else {
+                NV_LOG_INFO("SaveScene: CameraComponent layout not recognized, cameras are not saved.");
+            }
+        }
+
+    } // namespace
+
+    bool ProbeSceneFile(const std::filesystem::path& path) {
+        std::ifstream file(path, std::ios::binary);
+        SceneFileHeader header;
+        if (!file.read(reinterpret_cast<char*>(&header), sizeof(header)))
+            return false;
+        return header.m_Magic == SceneFileHeader::k_Magic && header.m_Version == SceneFileHeader::k_Version;
+    }
+
+    bool SaveScene(const entt::registry& registry, const std::filesystem::path& path, SceneIOStats* stats) {
+        const auto start = Clock::now();
+
+        SceneWriter writer;
+        EntityNumbering numbering;
+        std::vector<entt::entity> entities;
+        std::vector<uint32_t> numbers;
+
+        // Transforms first: every transformed entity gets its number here, so the column is dense.
+        CollectColumn<TransformComponent>(registry, numbering, entities, numbers);
+        writer.AddColumn(k_TransformColumn, 1, sizeof(TransformRecord), numbers, IsDense(numbers), [&](size_t i, std::byte* out) {
+            const auto& transform = registry.get<TransformComponent>(entities[i]);
+            TransformRecord record{};
+            StoreVec3(record.m_Position, transform.m_Position);
+            StoreVec3(record.m_Rotation, transform.m_Rotation);
+            StoreVec3(record.m_Scale, transform.m_Scale);
+            std::memcpy(out, &record, sizeof(record));
+        });
+
+        // Mesh renderers, with asset references turned into asset table indices.
+        std::vector<std::string> assetPaths;
+        std::unordered_map<std::string, uint32_t> assetIndices;
+        auto& streamer = Streaming::AssetStreamer::Get();
+
+        CollectColumn<MeshRendererComponent>(registry, numbering, entities, numbers);
+        writer.AddColumn(k_MeshColumn, k_MeshColumnVersion, sizeof(MeshRecord) + sizeof(MaterialRecord), numbers, IsDense(numbers), [&](size_t i, std::byte* out) {
+            const auto& renderer = registry.get<MeshRendererComponent>(entities[i]);
+
+            MeshRecord record{ k_NoIndex, {} };
+            if (const std::string* assetPath = streamer.FindAssetPath(renderer.m_MeshAsset)) {
+                auto [it, inserted] = assetIndices.try_emplace(*assetPath, static_cast<uint32_t>(assetPaths.size()));
+                if (inserted)
+                    assetPaths.push_back(*assetPath);
+                record.m_Asset = it->second;
+            }
+            StoreVec3(record.m_BaseColor, renderer.m_Material.baseColor);
+            std::memcpy(out, &record, sizeof(record));
+
+            const MaterialRecord material = StoreMaterial(renderer.m_Material);
+            std::memcpy(out + sizeof(record), &material, sizeof(material));
+        });
+
+        WriteCameras<CameraComponent>(registry, writer, numbering);
+
+        CollectColumn<NameComponent>(registry, numbering, entities, numbers);
+        writer.AddVariableColumn(k_NameColumn, 1, numbers, IsDense(numbers), [&](size_t i) -> std::string_view {
+            return registry.get<NameComponent>(entities[i]).m_Name;
+        });
+
+        // Last: parents may be entities that only have a hierarchy link.
+        CollectColumn<HierarchyComponent>(registry, numbering, entities, numbers);
+        for (const entt::entity entity : entities)
+            if (const entt::entity parent = registry.get<HierarchyComponent>(entity).m_Parent; parent != entt::null && registry.valid(parent))
+                numbering.Add(parent);
+        writer.AddColumn(k_HierarchyColumn, 1, sizeof(uint32_t), numbers, IsDense(numbers), [&](size_t i, std::byte* out) {
+            const uint32_t parent = numbering.Find(registry.get<HierarchyComponent>(entities[i]).m_Parent);
+            std::memcpy(out, &parent, sizeof(parent));
+        });
+
+        // The asset table is not per entity: dense "numbers" only give it its element count.
+        numbers.resize(assetPaths.size());
+        std::iota(numbers.begin(), numbers.end(), 0u);
+        writer.AddVariableColumn(k_AssetColumn, 1, numbers, true, [&](size_t i) -> std::string_view { return assetPaths[i]; });
+
+        const auto bytes = writer.Finish(numbering.Size());
+        const bool written = WriteFile(path, bytes);
+        if (!written)
+            NV_LOG_ERROR(std::format("Failed to write scene '{}'", path.string()));
+
+        if (stats) {
+            *stats = {};
+            stats->m_Entities = numbering.Size();
+            stats->m_Chunks = writer.GetChunkCount();
+            stats->m_Bytes = bytes.size();
+            stats->m_TotalMs = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+        }
+        return written;
+    }
+
+    bool LoadScene(entt::registry& registry, const std::filesystem::path& path, const SceneLoadOptions& options, SceneIOStats* stats) {
+        const auto start = Clock::now();
+
+        Streaming::MappedFile file;
+        if (!file.Open(path.string())) {
+            NV_LOG_ERROR(std::format("Cannot open scene '{}'", path.string()));
+            return false;
+        }
+
+        const auto data = file.GetData();
+        if (data.size() < sizeof(SceneFileHeader)) {
+            NV_LOG_ERROR(std::format("Scene '{}' is truncated", path.string()));
+            return false;
+        }
+
+        const auto header = ReadRecord<SceneFileHeader>(data.data());
+        if (header.m_Magic != SceneFileHeader::k_Magic || header.m_Version != SceneFileHeader::k_Version) {
+            NV_LOG_ERROR(std::format("Scene '{}' has an unsupported format (version {})", path.string(), header.m_Version));
+            return false;
+        }
+
+        // Every entity takes at least four bytes in some column, which bounds the count of a corrupt header.
+        const uint64_t tableSize = static_cast<uint64_t>(header.m_ChunkCount) * sizeof(SceneChunkHeader);
+        if (header.m_ChunkTableOffset > data.size() || tableSize > data.size() - header.m_ChunkTableOffset
+            || static_cast<uint64_t>(header.m_EntityCount) * sizeof(uint32_t) > data.size()) {
+            NV_LOG_ERROR(std::format("Scene '{}' has a corrupt chunk table", path.string()));
+            return false;
+        }
+
+        std::vector<SceneChunkHeader> table(header.m_ChunkCount);
+        std::memcpy(table.data(), data.data() + header.m_ChunkTableOffset, tableSize);
+
+        SceneIOStats local;
+        local.m_Entities = header.m_EntityCount;
+        local.m_Chunks = header.m_ChunkCount;
+        local.m_Bytes = data.size();
+
+        // Sort the chunks into what this reader understands. A known chunk that does not fit the file
+        // fails the whole load, before anything is created.
+        std::vector<ChunkView> decodable;
+        std::vector<ChunkView> cameras;
+        std::vector<ChunkView> assetTables;
+        std::unordered_map<uint32_t, int64_t> lastNumbers;
+        for (const SceneChunkHeader& chunk : table) {
+            uint32_t expectedSize = 0;
+            bool known = chunk.m_ColumnVersion == 1;
+            switch (chunk.m_Column) {
+                case k_TransformColumn: expectedSize = sizeof(TransformRecord); break;
+                case k_HierarchyColumn: expectedSize = sizeof(uint32_t); break;
+                case k_CameraColumn:    expectedSize = sizeof(CameraRecord); break;
+                case k_NameColumn:
+                case k_AssetColumn:     expectedSize = 0; break;
+                case k_MeshColumn:
+                    if (chunk.m_ColumnVersion == k_MeshColumnVersion) {
+                        known = true;
+                        expectedSize = sizeof(MeshRecord) + sizeof(MaterialRecord);
+                    }
+                    else {
+                        // Version 1: the raw material tail depended on the writer's build; the record prefix is enough.
+                        known = known && chunk.m_ElementSize >= sizeof(MeshRecord);
+                        expectedSize = chunk.m_ElementSize;
+                    }
+                    break;
+                default:                known = false; break;
+            }
+
+            if (!known || chunk.m_ElementSize != expectedSize) {
+                ++local.m_SkippedChunks;
+                continue;
+            }
+
+            ChunkView view;
+            const bool hasEntities = chunk.m_Column != k_AssetColumn;
+            if (!ResolveChunk(data, chunk, hasEntities, view)
+                || (hasEntities && !EntitiesAscending(view, lastNumbers.try_emplace(chunk.m_Column, -1).first->second))) {
+                NV_LOG_ERROR(std::format("Scene '{}' has a corrupt chunk", path.string()));
+                return false;
+            }
+
+            if (chunk.m_Column == k_AssetColumn)
+                assetTables.push_back(view);
+            else if (chunk.m_Column == k_CameraColumn)
+                cameras.push_back(view);
+            else
+                decodable.push_back(view);
+        }
+
+        if (local.m_SkippedChunks > 0)
+            NV_LOG_INFO(std::format("LoadScene: skipped {} chunk(s) of unknown columns or layouts in '{}'", local.m_SkippedChunks, path.string()));
+
+        if (options.m_BeforeInsert)
+            options.m_BeforeInsert();
+
+        // Asset references: acquired once per path, streamed in after the load.
+        std::vector<MeshRef> assets;
+        auto& streamer = Streaming::AssetStreamer::Get();
+        for (const ChunkView& chunk : assetTables)
+            for (uint32_t i = 0; i < chunk.m_Header->m_Count; ++i)
+                assets.push_back(streamer.Acquire<MeshAsset>(std::string(VariableElement(chunk, i))).GetAssetRef());
+
+        // All entities in one call.
+        const auto insertStart = Clock::now();
+        std::vector<entt::entity> created(header.m_EntityCount);
+        registry.create(created.begin(), created.end());
+        local.m_InsertMs += std::chrono::duration<double, std::milli>(Clock::now() - insertStart).count();
+
+        // Decode every chunk into its own buffers; nothing touches the registry here.
+        const auto decodeStart = Clock::now();
+        std::vector<DecodedChunk> decoded(decodable.size());
+        auto decode = [&](uint32_t begin, uint32_t end) {
+            for (uint32_t i = begin; i < end; ++i)
+                DecodeChunk(decodable[i], created, assets, decoded[i]);
+        };
+
+        auto& jobs = Jobs::JobSystem::Get();
+        if (options.m_ParallelDecode && jobs.IsInitialized())
+            jobs.ParallelFor(static_cast<uint32_t>(decodable.size()), 1, decode);
+        else
+            decode(0, static_cast<uint32_t>(decodable.size()));
+        local.m_DecodeMs = std::chrono::duration<double, std::milli>(Clock::now() - decodeStart).count();
+
+        // Bulk inserts, transforms before hierarchy links so parents resolve in one TransformCache rebuild.
+        const auto bulkStart = Clock::now();
+        for (const uint32_t column : { k_TransformColumn, k_MeshColumn, k_NameColumn, k_HierarchyColumn }) {
+            for (DecodedChunk& chunk : decoded) {
+                if (chunk.m_Column != column)
+                    continue;
+
+                switch (column) {
+                    case k_TransformColumn: registry.insert<TransformComponent>(chunk.m_Targets.begin(), chunk.m_Targets.end(), chunk.m_Transforms.begin()); break;
+                    case k_MeshColumn:      registry.insert<MeshRendererComponent>(chunk.m_Targets.begin(), chunk.m_Targets.end(), chunk.m_Meshes.begin()); break;
+                    case k_NameColumn:      registry.insert<NameComponent>(chunk.m_Targets.begin(), chunk.m_Targets.end(), chunk.m_Names.begin()); break;
+                    case k_HierarchyColumn: registry.insert<HierarchyComponent>(chunk.m_Targets.begin(), chunk.m_Targets.end(), chunk.m_Hierarchy.begin()); break;
+                }
+                chunk = {};
+            }
+        }
+
+        for (const ChunkView& chunk : cameras)
+            InsertCameras<CameraComponent>(registry, chunk, created);
+        local.m_InsertMs += std::chrono::duration<double, std::milli>(Clock::now() - bulkStart).count();
+
+        if (options.m_CreatedEntities)
+            *options.m_CreatedEntities = std::move(created);
+
+        local.m_TotalMs = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+        if (stats)
+            *stats = local;
+        return true;
+    }
+
+} // namespace Nova::App::World
@@ -0,0 +1,93 @@
+#ifndef SCENESERIALIZER_H
+#define SCENESERIALIZER_H
+
+#include <vector>
+#include <cstdint>
+#include <functional>
+#include <filesystem>
+#include <type_traits>
+
+#include <entt/entt.hpp>
+
+namespace Nova::App::World {
+
+    // Scene file (.nova): a header, then column chunks, then a chunk table at the end.
+    //
+    // Entities are numbered 0..N-1 in the file. Each component type is stored as one column,
+    // split into chunks of up to k_SceneChunkEntities elements so the chunks can be decoded
+    // in parallel. A chunk holds the entity numbers it covers (omitted for dense chunks that
+    // cover a contiguous range) followed by the packed elements.
+    //
+    // Every column has its own version and element size. A reader skips columns it does not
+    // know, or whose version or element size differ from its own. Mesh references point into
+    // an asset table (column 'ASST') by index, so each path is stored once.
+    struct SceneFileHeader {
+        static constexpr uint32_t k_Magic = 0x4E43534E;   // "NSCN"
+        static constexpr uint32_t k_Version = 1;
+
+        uint32_t m_Magic{ k_Magic };
+        uint32_t m_Version{ k_Version };
+        uint32_t m_EntityCount{ 0 };
+        uint32_t m_ChunkCount{ 0 };
+        uint64_t m_ChunkTableOffset{ 0 };
+        uint64_t m_Reserved{ 0 };
+    };
+    static_assert(std::is_trivially_copyable_v<SceneFileHeader>);
+    static_assert(sizeof(SceneFileHeader) == 32);
+
+    struct SceneChunkHeader {
+        static constexpr uint32_t k_Dense = 1u << 0;   // covers entities m_FirstEntity .. m_FirstEntity + m_Count - 1
+
+        uint32_t m_Column{ 0 };          // four-character code
+        uint32_t m_ColumnVersion{ 0 };
+        uint32_t m_ElementSize{ 0 };     // 0 for variable-size columns (offset table + bytes)
+        uint32_t m_Count{ 0 };
+        uint32_t m_FirstEntity{ 0 };
+        uint32_t m_Flags{ 0 };
+        uint64_t m_Offset{ 0 };
+        uint64_t m_Size{ 0 };
+    };
+    static_assert(std::is_trivially_copyable_v<SceneChunkHeader>);
+    static_assert(sizeof(SceneChunkHeader) == 40);
+
+    inline constexpr uint32_t k_SceneChunkEntities = 64 * 1024;
+    inline constexpr uint32_t k_SceneChunkAlignment = 16;
+
+    struct SceneIOStats {
+        uint32_t m_Entities{ 0 };
+        uint32_t m_Chunks{ 0 };
+        uint32_t m_SkippedChunks{ 0 };   // unknown column, version or layout
+        uint64_t m_Bytes{ 0 };
+        double   m_TotalMs{ 0.0 };
+        double   m_DecodeMs{ 0.0 };      // load: chunk decode (parallel when enabled)
+        double   m_InsertMs{ 0.0 };      // load: registry create + insert
+    };
+
+    struct SceneLoadOptions {
+        bool m_ParallelDecode{ true };
+        // Created entities in file order; optional.
+        std::vector<entt::entity>* m_CreatedEntities{ nullptr };
+        // Called once the whole file has been checked, right before the registry is first modified
+        // (e.g. to clear the scene being replaced). Not called when the load fails.
+        std::function<void()> m_BeforeInsert;
+    };
+
+    // True when `path` starts with a scene header this build can read. Cheap: only the header is read.
+    bool ProbeSceneFile(const std::filesystem::path& path);
+
+    // Writes every entity that has at least one serialized component (transform, hierarchy, mesh
+    // renderer, camera, name). Mesh assets are stored by the path they were acquired with through
+    // the AssetStreamer. Written to a temporary file and renamed.
+    bool SaveScene(const entt::registry& registry, const std::filesystem::path& path, SceneIOStats* stats = nullptr);
+
+    // Adds the file's entities to `registry`: all entities are created at once, each column is
+    // decoded chunk by chunk (on the job system when enabled) and inserted in bulk. Mesh assets are
+    // acquired through the AssetStreamer, so they stream in after the call returns. The header,
+    // chunk table and every chunk of a known column are validated first: on failure the registry
+    // has not been touched.
+    bool LoadScene(entt::registry& registry, const std::filesystem::path& path,
+                   const SceneLoadOptions& options = {}, SceneIOStats* stats = nullptr);
+
+} // namespace Nova::App::World
+
+#endif // SCENESERIALIZER_H
@@ -0,0 +1,283 @@
+#include "World/SceneSnapshot.h"
+
+#include <chrono>
+#include <cstring>
+#include <optional>
+#include <algorithm>
+#include <type_traits>
+
+#include "Scene/ECS/Components/TransformComponent.h"
+#include "Scene/ECS/Components/MeshRendererComponent.h"
+#include "Scene/ECS/Components/CameraComponent.h"
+
+#include "World/HierarchyComponent.h"
+#include "World/NameComponent.h"
+
+namespace Nova::App::World {
+
+    using Nova::Core::Scene::ECS::Components::TransformComponent;
+    using Nova::Core::Scene::ECS::Components::MeshRendererComponent;
+    using Nova::Core::Scene::ECS::Components::CameraComponent;
+
+    namespace {
+
+        using Clock = std::chrono::steady_clock;
+
+        // Pools whose component pages can be reached directly (entt::basic_storage::raw()).
+        template <typename T>
+        concept PagedStorage = requires(entt::registry& registry) {
+            registry.storage<T>().raw();
+            registry.storage<T>().data();
+            entt::component_traits<T>::page_size;
+        };
+
+        template <typename T>
+        constexpr bool k_MemcpyColumn = std::is_trivially_copyable_v<T> && std::is_default_constructible_v<T> && PagedStorage<T>;
+
+        // Components that point at state shared with the rest of the editor (the Camera behind a CameraComponent).
+        template <typename T>
+        concept PointsAtCamera = requires(T& component) { *component.m_Camera = *component.m_Camera; };
+
+        template <typename T>
+        struct PointeeCopies {
+            void Capture(const std::vector<T>&) {}
+            void Restore(const std::vector<T>&) const {}
+            uint64_t GetBytes() const { return 0; }
+        };
+
+        template <PointsAtCamera T>
+        struct PointeeCopies<T> {
+            using Pointee = std::remove_cvref_t<decltype(*std::declval<T&>().m_Camera)>;
+
+            void Capture(const std::vector<T>& components) {
+                m_Values.clear();
+                m_Values.reserve(components.size());
+                for (const T& component : components)
+                    m_Values.push_back(component.m_Camera ? std::optional<Pointee>(*component.m_Camera) : std::nullopt);
+            }
+
+            void Restore(const std::vector<T>& components) const {
+                for (size_t i = 0; i < components.size(); ++i)
+                    if (components[i].m_Camera && m_Values[i])
+                        *components[i].m_Camera = *m_Values[i];
+            }
+
+            uint64_t GetBytes() const { return m_Values.size() * sizeof(std::optional<Pointee>); }
+
+            std::vector<std::optional<Pointee>> m_Values;
+        };
+
+        template <typename T>
+        class ComponentColumn final : public SceneSnapshot::Column {
+        public:
+            void Capture(entt::registry& registry) override {
+                auto& storage = registry.storage<T>();
+                const size_t count = storage.size();
+
+                // Packed order: entity i of the pool owns component i.
+                m_Entities.assign(storage.data(), storage.data() + count);
+
+                if constexpr (k_MemcpyColumn<T>) {
+                    m_Components.resize(count);
+                    CopyPages<false>(storage);
+                }
+                else {
+                    m_Components.clear();
+                    m_Components.reserve(count);
+                    for (const entt::entity entity : m_Entities)
+                        m_Components.push_back(storage.get(entity));
+                }
+                m_Pointees.Capture(m_Components);
+
+                m_Touched = false;
+                registry.on_construct<T>().template connect<&ComponentColumn::OnChanged>(*this);
+                registry.on_update<T>().template connect<&ComponentColumn::OnChanged>(*this);
+                registry.on_destroy<T>().template connect<&ComponentColumn::OnChanged>(*this);
+            }
+
+            bool Restore(entt::registry& registry) override {
+                Disconnect(registry);
+
+                auto& storage = registry.storage<T>();
+                const bool inPlace = !m_Touched && storage.size() == m_Entities.size()
+                    && std::equal(m_Entities.begin(), m_Entities.end(), storage.data());
+
+                if (inPlace) {
+                    // Same entities in the same slots: only values written without signals can differ.
+                    if constexpr (k_MemcpyColumn<T>) {
+                        CopyPages<true>(storage);
+                    }
+                    else {
+                        for (size_t i = 0; i < m_Entities.size(); ++i)
+                            storage.get(m_Entities[i]) = m_Components[i];
+                    }
+                }
+                else {
+                    registry.clear<T>();
+                    registry.insert<T>(m_Entities.begin(), m_Entities.end(), m_Components.begin());
+                }
+                m_Pointees.Restore(m_Components);
+
+                Free();
+                return inPlace;
+            }
+
+            void Release(entt::registry& registry) override {
+                Disconnect(registry);
+                Free();
+            }
+
+            uint32_t GetCount() const override { return static_cast<uint32_t>(m_Entities.size()); }
+
+            uint64_t GetBytes() const override {
+                return m_Entities.size() * sizeof(entt::entity) + m_Components.size() * sizeof(T) + m_Pointees.GetBytes();
+            }
+
+        private:
+            void OnChanged(entt::registry&, entt::entity) { m_Touched = true; }
+
+            void Disconnect(entt::registry& registry) {
+                registry.on_construct<T>().disconnect(this);
+                registry.on_update<T>().disconnect(this);
+                registry.on_destroy<T>().disconnect(this);
+            }
+
+            void Free() {
+                m_Entities = {};
+                m_Components = {};
+                m_Pointees = {};
+            }
+
+            // One memcpy per pool page.
+            template <bool ToStorage, typename Storage>
+            void CopyPages(Storage& storage) {
+                constexpr size_t k_PageSize = entt::component_traits<T>::page_size;
+                const auto pages = storage.raw();
+                const size_t count = m_Components.size();
+
+                for (size_t first = 0; first < count; first += k_PageSize) {
+                    T* page = pages[first / k_PageSize];
+                    const size_t bytes = std::min(k_PageSize, count - first) * sizeof(T);
+                    if constexpr (ToStorage)
+                        std::memcpy(page, m_Components.data() + first, bytes);
+                    else
+                        std::memcpy(m_Components.data() + first, page, bytes);
+                }
+            }
+
+            std::vector<entt::entity> m_Entities;
+            std::vector<T>            m_Components;
+            PointeeCopies<T>          m_Pointees;
+            bool m_Touched{ false };
+        };
+
+        // Every alive entity, whichever entt version provides the entity pool.
+        template <typename Registry, typename Function>
+        void ForEachEntity(Registry& registry, Function&& function) {
+            if constexpr (requires { registry.each(function); }) {
+                registry.each(function);
+            }
+            else {
+                for (const auto [entity] : registry.template storage<entt::entity>().each())
+                    function(entity);
+            }
+        }
+
+    } // namespace
+
+    SceneSnapshot::SceneSnapshot() {
+        m_Columns.push_back(std::make_unique<ComponentColumn<TransformComponent>>());
+        m_Columns.push_back(std::make_unique<ComponentColumn<HierarchyComponent>>());
+        m_Columns.push_back(std::make_unique<ComponentColumn<MeshRendererComponent>>());
+        m_Columns.push_back(std::make_unique<ComponentColumn<CameraComponent>>());
+        m_Columns.push_back(std::make_unique<ComponentColumn<NameComponent>>());
+    }
+
+    SceneSnapshot::~SceneSnapshot() {
+        Reset();
+    }
+
+    void SceneSnapshot::Reset() {
+        if (m_Registry) {
+            for (auto& column : m_Columns)
+                column->Release(*m_Registry);
+        }
+        m_Registry = nullptr;
+        m_Entities = {};
+    }
+
+    void SceneSnapshot::Capture(entt::registry& registry) {
+        Reset();
+
+        const auto start = Clock::now();
+        m_Registry = &registry;
+        m_Stats = {};
+
+        ForEachEntity(registry, [this](entt::entity entity) { m_Entities.push_back(entity); });
+
+        uint64_t bytes = m_Entities.size() * sizeof(entt::entity);
+        uint32_t components = 0;
+        for (auto& column : m_Columns) {
+            column->Capture(registry);
+            bytes += column->GetBytes();
+            components += column->GetCount();
+        }
+
+        m_Stats.m_Entities = static_cast<uint32_t>(m_Entities.size());
+        m_Stats.m_Components = components;
+        m_Stats.m_Bytes = bytes;
+        m_Stats.m_CaptureMs = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    }
+
+    void SceneSnapshot::Restore(entt::registry& registry) {
+        if (m_Registry != &registry)
+            return;
+
+        const auto start = Clock::now();
+
+        // Snapshot entity of each entity index, to tell play-time entities from captured ones.
+        std::vector<entt::entity> captured;
+        for (const entt::entity entity : m_Entities) {
+            const size_t index = static_cast<size_t>(entt::to_entity(entity));
+            if (index >= captured.size())
+                captured.resize(index + 1, entt::null);
+            captured[index] = entity;
+        }
+
+        std::vector<entt::entity> created;
+        ForEachEntity(registry, [&](entt::entity entity) {
+            const size_t index = static_cast<size_t>(entt::to_entity(entity));
+            if (index >= captured.size() || captured[index] != entity)
+                created.push_back(entity);
+        });
+        registry.destroy(created.begin(), created.end());
+
+        // A released identifier is handed back as is, so references between entities stay valid.
+        uint32_t recreated = 0;
+        for (const entt::entity entity : m_Entities) {
+            if (!registry.valid(entity)) {
+                registry.create(entity);
+                ++recreated;
+            }
+        }
+
+        uint32_t copied = 0;
+        uint32_t reinserted = 0;
+        for (auto& column : m_Columns) {
+            if (column->Restore(registry))
+                ++copied;
+            else
+                ++reinserted;
+        }
+
+        m_Registry = nullptr;
+        m_Entities = {};
+
+        m_Stats.m_EntitiesDestroyed = static_cast<uint32_t>(created.size());
+        m_Stats.m_EntitiesRecreated = recreated;
+        m_Stats.m_ColumnsCopied = copied;
+        m_Stats.m_ColumnsReinserted = reinserted;
+        m_Stats.m_RestoreMs = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    }
+
+} // namespace Nova::App::World
@@ -0,0 +1,78 @@
+#ifndef SCENESNAPSHOT_H
+#define SCENESNAPSHOT_H
+
+#include <memory>
+#include <vector>
+#include <cstdint>
+
+#include <entt/entt.hpp>
+
+namespace Nova::App::World {
+
+    struct SceneSnapshotStats {
+        uint32_t m_Entities{ 0 };
+        uint32_t m_Components{ 0 };
+        uint64_t m_Bytes{ 0 };
+        double   m_CaptureMs{ 0.0 };
+
+        // Restore
+        double   m_RestoreMs{ 0.0 };
+        uint32_t m_EntitiesDestroyed{ 0 };   // created during play
+        uint32_t m_EntitiesRecreated{ 0 };   // destroyed during play
+        uint32_t m_ColumnsCopied{ 0 };       // restored in place, no signals
+        uint32_t m_ColumnsReinserted{ 0 };   // cleared and bulk inserted
+    };
+
+    // Edit-mode state of the scene, taken when entering Play and put back on Stop.
+    //
+    // Each snapshotted component type is one column: the pool's packed entity array plus a copy
+    // of its components in the same order, copied page by page with memcpy for trivially copyable
+    // components. Cameras also keep a copy of the Camera they point to, since play mode moves it
+    // through the shared pointer.
+    //
+    // Columns watch their pool's signals while playing. On restore, a column that saw no
+    // construct/update/destroy and still holds the same entities is copied back in place, without
+    // signals; any other column is cleared and bulk inserted, so listeners such as TransformCache
+    // and HierarchyIndex see the change. Entities created during play are destroyed and entities
+    // destroyed during play are recreated with the same identifier; components of types that are
+    // not snapshotted are not brought back for the latter.
+    class SceneSnapshot {
+    public:
+        SceneSnapshot();
+        ~SceneSnapshot();
+
+        SceneSnapshot(const SceneSnapshot&) = delete;
+        SceneSnapshot& operator=(const SceneSnapshot&) = delete;
+
+        void Capture(entt::registry& registry);
+        // Restores the captured state and releases the snapshot.
+        void Restore(entt::registry& registry);
+        void Reset();
+
+        bool IsCaptured() const { return m_Registry != nullptr; }
+        const SceneSnapshotStats& GetStats() const { return m_Stats; }
+
+        // Type-erased column; defined in SceneSnapshot.cpp.
+        class Column {
+        public:
+            virtual ~Column() = default;
+
+            virtual void Capture(entt::registry& registry) = 0;
+            // Returns true when the column was copied in place, false when it was reinserted.
+            virtual bool Restore(entt::registry& registry) = 0;
+            virtual void Release(entt::registry& registry) = 0;
+
+            virtual uint32_t GetCount() const = 0;
+            virtual uint64_t GetBytes() const = 0;
+        };
+
+    private:
+        entt::registry* m_Registry{ nullptr };
+        std::vector<entt::entity> m_Entities;   // every entity alive at capture
+        std::vector<std::unique_ptr<Column>> m_Columns;
+        SceneSnapshotStats m_Stats;
+    };
+
+} // namespace Nova::App::World
+
+#endif // SCENESNAPSHOT_H
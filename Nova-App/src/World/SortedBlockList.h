@@ -0,0 +1,192 @@
+#ifndef SORTEDBLOCKLIST_H
+#define SORTEDBLOCKLIST_H
+
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <algorithm>
+
+namespace Nova::App::World {
+
+    // Sorted sequence stored as a list of small sorted blocks: a single insert or erase moves at most
+    // one block instead of the whole array, while lookups stay a binary search over the blocks and
+    // then inside one. Random access goes through the running block offsets, which edits only mark
+    // stale from the first block they touched: a frame of edits re-sums them once, on the next access.
+    //
+    // Large batches go through the flat paths (MergeSorted, EraseIf), which re-block everything in O(n).
+    template <typename T>
+    class SortedBlockList {
+    public:
+        static constexpr size_t k_BlockSize = 512;
+
+        struct Position {
+            size_t m_Block{ 0 };
+            size_t m_Offset{ 0 };
+        };
+
+        size_t Size() const { return m_Size; }
+        bool Empty() const { return m_Size == 0; }
+
+        void Clear() {
+            m_Blocks.clear();
+            m_Starts.clear();
+            m_Size = 0;
+            m_StaleFrom = 0;
+        }
+
+        const T& operator[](size_t index) const {
+            UpdateStarts();
+            const size_t block = static_cast<size_t>(std::upper_bound(m_Starts.begin(), m_Starts.end(), index) - m_Starts.begin()) - 1;
+            return m_Blocks[block][index - m_Starts[block]];
+        }
+
+        // ---- Single elements ----
+
+        template <typename Less>
+        void Insert(const T& value, Less less) {
+            ++m_Size;
+            if (m_Blocks.empty()) {
+                m_Blocks.emplace_back().push_back(value);
+                MarkStale(0);
+                return;
+            }
+
+            // First block whose last element is not less than `value`; past the end, the last block.
+            size_t block = static_cast<size_t>(std::partition_point(m_Blocks.begin(), m_Blocks.end(),
+                [&](const std::vector<T>& b) { return less(b.back(), value); }) - m_Blocks.begin());
+            block = std::min(block, m_Blocks.size() - 1);
+
+            std::vector<T>& target = m_Blocks[block];
+            target.insert(std::lower_bound(target.begin(), target.end(), value, less), value);
+
+            if (target.size() >= 2 * k_BlockSize) {
+                std::vector<T> upper(target.begin() + k_BlockSize, target.end());
+                target.resize(k_BlockSize);
+                m_Blocks.insert(m_Blocks.begin() + block + 1, std::move(upper));
+            }
+            MarkStale(block);
+        }
+
+        // Removes the element equivalent to `value`; false when there is none.
+        template <typename Less>
+        bool Erase(const T& value, Less less) {
+            const Position position = LowerBound(value, less);
+            if (position.m_Block >= m_Blocks.size())
+                return false;
+
+            std::vector<T>& block = m_Blocks[position.m_Block];
+            if (less(value, block[position.m_Offset]))
+                return false;
+
+            block.erase(block.begin() + position.m_Offset);
+            if (block.empty())
+                m_Blocks.erase(m_Blocks.begin() + position.m_Block);
+            --m_Size;
+            MarkStale(position.m_Block);
+            return true;
+        }
+
+        // ---- Batches ----
+
+        // Merges an already sorted batch in.
+        template <typename Less>
+        void MergeSorted(const std::vector<T>& sorted, Less less) {
+            std::vector<T> all = Flatten();
+            const size_t middle = all.size();
+            all.insert(all.end(), sorted.begin(), sorted.end());
+            std::inplace_merge(all.begin(), all.begin() + middle, all.end(), less);
+            Assign(all);
+        }
+
+        template <typename Predicate>
+        void EraseIf(Predicate predicate) {
+            for (std::vector<T>& block : m_Blocks)
+                std::erase_if(block, predicate);
+            std::erase_if(m_Blocks, [](const std::vector<T>& block) { return block.empty(); });
+            m_Size = 0;
+            for (const std::vector<T>& block : m_Blocks)
+                m_Size += block.size();
+            MarkStale(0);
+        }
+
+        // ---- Traversal ----
+
+        template <typename Less>
+        Position LowerBound(const T& value, Less less) const {
+            return PartitionPoint([&](const T& element) { return less(element, value); });
+        }
+
+        // First position for which `predicate` is false; the sequence must be partitioned by it.
+        template <typename Predicate>
+        Position PartitionPoint(Predicate predicate) const {
+            const size_t block = static_cast<size_t>(std::partition_point(m_Blocks.begin(), m_Blocks.end(),
+                [&](const std::vector<T>& b) { return predicate(b.back()); }) - m_Blocks.begin());
+            if (block == m_Blocks.size())
+                return { block, 0 };
+
+            const std::vector<T>& b = m_Blocks[block];
+            return { block, static_cast<size_t>(std::partition_point(b.begin(), b.end(), predicate) - b.begin()) };
+        }
+
+        // Calls `visit(element)` from `position` on while it returns true.
+        template <typename Visit>
+        void VisitFrom(Position position, Visit visit) const {
+            for (size_t block = position.m_Block; block < m_Blocks.size(); ++block) {
+                const std::vector<T>& b = m_Blocks[block];
+                for (size_t i = (block == position.m_Block) ? position.m_Offset : 0; i < b.size(); ++i)
+                    if (!visit(b[i]))
+                        return;
+            }
+        }
+
+        template <typename Visit>
+        void ForEach(Visit visit) const {
+            for (const std::vector<T>& block : m_Blocks)
+                for (const T& element : block)
+                    visit(element);
+        }
+
+    private:
+        std::vector<T> Flatten() const {
+            std::vector<T> all;
+            all.reserve(m_Size);
+            for (const std::vector<T>& block : m_Blocks)
+                all.insert(all.end(), block.begin(), block.end());
+            return all;
+        }
+
+        void Assign(const std::vector<T>& sorted) {
+            m_Blocks.clear();
+            for (size_t first = 0; first < sorted.size(); first += k_BlockSize)
+                m_Blocks.emplace_back(sorted.begin() + first, sorted.begin() + std::min(sorted.size(), first + k_BlockSize));
+            m_Size = sorted.size();
+            MarkStale(0);
+        }
+
+        void MarkStale(size_t fromBlock) {
+            m_StaleFrom = std::min(m_StaleFrom, fromBlock);
+        }
+
+        void UpdateStarts() const {
+            if (m_StaleFrom >= m_Blocks.size() && m_Starts.size() == m_Blocks.size())
+                return;
+
+            const size_t fromBlock = std::min(m_StaleFrom, m_Blocks.size());
+            m_Starts.resize(m_Blocks.size());
+            size_t start = fromBlock > 0 ? m_Starts[fromBlock - 1] + m_Blocks[fromBlock - 1].size() : 0;
+            for (size_t block = fromBlock; block < m_Blocks.size(); ++block) {
+                m_Starts[block] = start;
+                start += m_Blocks[block].size();
+            }
+            m_StaleFrom = SIZE_MAX;
+        }
+
+        std::vector<std::vector<T>> m_Blocks;
+        mutable std::vector<size_t> m_Starts;   // index of each block's first element, valid before m_StaleFrom
+        mutable size_t m_StaleFrom{ 0 };
+        size_t m_Size{ 0 };
+    };
+
+} // namespace Nova::App::World
+
+#endif // SORTEDBLOCKLIST_H
@@ -0,0 +1,269 @@
+#include "World/TransformCache.h"
+
+#include <algorithm>
+
+#include "Scene/ECS/Components/TransformComponent.h"
+
+#include "World/HierarchyComponent.h"
+#include "World/TransformMath.h"
+#include "Jobs/JobSystem.h"
+
+namespace Nova::App::World {
+
+    using Nova::Core::Scene::ECS::Components::TransformComponent;
+
+    void TransformCache::Connect(entt::registry& registry) {
+        Disconnect();
+        m_Registry = &registry;
+
+        registry.on_construct<TransformComponent>().connect<&TransformCache::OnTransformConstruct>(*this);
+        registry.on_update<TransformComponent>().connect<&TransformCache::OnTransformUpdate>(*this);
+        registry.on_destroy<TransformComponent>().connect<&TransformCache::OnTransformDestroy>(*this);
+
+        registry.on_construct<HierarchyComponent>().connect<&TransformCache::OnHierarchyChanged>(*this);
+        registry.on_update<HierarchyComponent>().connect<&TransformCache::OnHierarchyChanged>(*this);
+        registry.on_destroy<HierarchyComponent>().connect<&TransformCache::OnHierarchyChanged>(*this);
+
+        // Pick up whatever already exists in the registry.
+        m_NeedsRebuild = true;
+    }
+
+    void TransformCache::Disconnect() {
+        if (!m_Registry)
+            return;
+
+        m_Registry->on_construct<TransformComponent>().disconnect(this);
+        m_Registry->on_update<TransformComponent>().disconnect(this);
+        m_Registry->on_destroy<TransformComponent>().disconnect(this);
+        m_Registry->on_construct<HierarchyComponent>().disconnect(this);
+        m_Registry->on_update<HierarchyComponent>().disconnect(this);
+        m_Registry->on_destroy<HierarchyComponent>().disconnect(this);
+        m_Registry = nullptr;
+
+        m_Entities.clear();
+        m_Parents.clear();
+        m_Local.clear();
+        m_World.clear();
+        m_LocalDirty.clear();
+        m_WorldChanged.clear();
+        m_DirtySlots.clear();
+        m_SlotOfEntity.clear();
+        m_Tombstones = 0;
+        m_ParentedSlots = 0;
+        m_NeedsRebuild = false;
+    }
+
+    // ---- Slots ----
+
+    uint32_t TransformCache::SlotOf(entt::entity entity) const {
+        const auto index = static_cast<size_t>(entt::to_entity(entity));
+        if (entity == entt::null || index >= m_SlotOfEntity.size())
+            return k_InvalidSlot;
+
+        const uint32_t slot = m_SlotOfEntity[index];
+        return (slot != k_InvalidSlot && m_Entities[slot] == entity) ? slot : k_InvalidSlot;
+    }
+
+    void TransformCache::SetSlotOf(entt::entity entity, uint32_t slot) {
+        const auto index = static_cast<size_t>(entt::to_entity(entity));
+        if (index >= m_SlotOfEntity.size())
+            m_SlotOfEntity.resize(std::max(index + 1, m_SlotOfEntity.size() * 2), k_InvalidSlot);
+        m_SlotOfEntity[index] = slot;
+    }
+
+    uint32_t TransformCache::ParentSlotOf(entt::entity entity) const {
+        const auto* hierarchy = m_Registry->try_get<HierarchyComponent>(entity);
+        if (!hierarchy || hierarchy->m_Parent == entt::null)
+            return k_InvalidSlot;
+        return SlotOf(hierarchy->m_Parent);
+    }
+
+    uint32_t TransformCache::AppendSlot(entt::entity entity, uint32_t parentSlot) {
+        const uint32_t slot = static_cast<uint32_t>(m_Entities.size());
+
+        m_Entities.push_back(entity);
+        m_Parents.push_back(parentSlot);
+        m_Local.emplace_back(1.0f);
+        m_World.emplace_back(1.0f);
+        m_LocalDirty.push_back(1);
+        m_WorldChanged.push_back(0);
+        m_DirtySlots.push_back(slot);
+
+        if (parentSlot != k_InvalidSlot)
+            ++m_ParentedSlots;
+
+        SetSlotOf(entity, slot);
+        return slot;
+    }
+
+    void TransformCache::Rebuild() {
+        m_NeedsRebuild = false;
+
+        std::vector<entt::entity> entities;
+        for (auto entity : m_Registry->view<TransformComponent>())
+            entities.push_back(entity);
+
+        // Depth of each entity in the hierarchy (roots = 0), bounded to survive accidental cycles.
+        const size_t maxDepth = entities.size();
+        auto depthOf = [&](entt::entity entity) {
+            uint32_t depth = 0;
+            const HierarchyComponent* hierarchy = m_Registry->try_get<HierarchyComponent>(entity);
+            while (hierarchy && hierarchy->m_Parent != entt::null && m_Registry->valid(hierarchy->m_Parent) && depth < maxDepth) {
+                ++depth;
+                hierarchy = m_Registry->try_get<HierarchyComponent>(hierarchy->m_Parent);
+            }
+            return depth;
+        };
+
+        std::vector<std::pair<uint32_t, entt::entity>> ordered;
+        ordered.reserve(entities.size());
+        for (auto entity : entities)
+            ordered.emplace_back(depthOf(entity), entity);
+        std::stable_sort(ordered.begin(), ordered.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+
+        m_Entities.clear();
+        m_Parents.clear();
+        m_Local.clear();
+        m_World.clear();
+        m_LocalDirty.clear();
+        m_WorldChanged.clear();
+        m_DirtySlots.clear();
+        std::fill(m_SlotOfEntity.begin(), m_SlotOfEntity.end(), k_InvalidSlot);
+        m_Tombstones = 0;
+        m_ParentedSlots = 0;
+
+        m_Entities.reserve(ordered.size());
+        m_Local.reserve(ordered.size());
+        m_World.reserve(ordered.size());
+
+        // Parents have a smaller depth, so their slot already exists when the child is appended.
+        for (const auto& [depth, entity] : ordered)
+            AppendSlot(entity, ParentSlotOf(entity));
+    }
+
+    // ---- Signals ----
+
+    void TransformCache::OnTransformConstruct(entt::registry&, entt::entity entity) {
+        if (m_NeedsRebuild)
+            return;
+
+        const auto* hierarchy = m_Registry->try_get<HierarchyComponent>(entity);
+        const uint32_t parentSlot = ParentSlotOf(entity);
+
+        // Appending keeps the parent-before-child order only if the parent is already cached.
+        if (hierarchy && hierarchy->m_Parent != entt::null && parentSlot == k_InvalidSlot) {
+            m_NeedsRebuild = true;
+            return;
+        }
+
+        AppendSlot(entity, parentSlot);
+    }
+
+    void TransformCache::OnTransformUpdate(entt::registry&, entt::entity entity) {
+        MarkDirty(entity);
+    }
+
+    void TransformCache::OnTransformDestroy(entt::registry&, entt::entity entity) {
+        const uint32_t slot = SlotOf(entity);
+        if (slot == k_InvalidSlot)
+            return;
+
+        m_Entities[slot] = entt::null;
+        m_LocalDirty[slot] = 0;
+        SetSlotOf(entity, k_InvalidSlot);
+        ++m_Tombstones;
+
+        // Children of the destroyed entity become roots: their parent slot must be refreshed.
+        if (m_ParentedSlots > 0)
+            m_NeedsRebuild = true;
+    }
+
+    void TransformCache::OnHierarchyChanged(entt::registry&, entt::entity) {
+        m_NeedsRebuild = true;
+    }
+
+    void TransformCache::MarkDirty(entt::entity entity) {
+        const uint32_t slot = SlotOf(entity);
+        if (slot == k_InvalidSlot || m_LocalDirty[slot])
+            return;
+
+        m_LocalDirty[slot] = 1;
+        m_DirtySlots.push_back(slot);
+    }
+
+    // ---- Update ----
+
+    void TransformCache::ComposeDirtyLocals() {
+        // Dirty slots may point at tombstones destroyed after being flagged.
+        std::erase_if(m_DirtySlots, [this](uint32_t slot) { return m_Entities[slot] == entt::null; });
+
+        // Chunks only read the registry and write disjoint local slots, so they can run on the job system.
+        constexpr uint32_t k_ChunkSize = 4096;
+
+        auto view = m_Registry->view<TransformComponent>();
+        Jobs::JobSystem::Get().ParallelFor(static_cast<uint32_t>(m_DirtySlots.size()), k_ChunkSize, [&](uint32_t begin, uint32_t end) {
+            static thread_local std::vector<TRS> s_Staging;
+            s_Staging.clear();
+            s_Staging.reserve(end - begin);
+
+            for (uint32_t i = begin; i < end; ++i) {
+                const auto& tc = view.get<TransformComponent>(m_Entities[m_DirtySlots[i]]);
+                s_Staging.push_back({ tc.m_Position, tc.m_Rotation, tc.m_Scale });
+            }
+
+            ComposeTRS(s_Staging, m_Local.data(), m_DirtySlots.data() + begin);
+        });
+    }
+
+    void TransformCache::Update() {
+        m_LastUpdated = 0;
+        if (!m_Registry)
+            return;
+
+        // Compact once a quarter of the slots are dead.
+        if (m_NeedsRebuild || (m_Tombstones > 0 && m_Tombstones * 4 > m_Entities.size()))
+            Rebuild();
+
+        if (m_DirtySlots.empty())
+            return;
+
+        ComposeDirtyLocals();
+
+        if (m_ParentedSlots == 0) {
+            // Flat scene: world == local, only the dirty slots change.
+            for (uint32_t slot : m_DirtySlots) {
+                m_World[slot] = m_Local[slot];
+                m_LocalDirty[slot] = 0;
+            }
+            m_LastUpdated = static_cast<uint32_t>(m_DirtySlots.size());
+            m_DirtySlots.clear();
+            return;
+        }
+
+        // Forward pass in slot order: parents are always visited before their children,
+        // so a changed parent has its new world matrix ready when its children read it.
+        const uint32_t first = *std::min_element(m_DirtySlots.begin(), m_DirtySlots.end());
+        const uint32_t count = static_cast<uint32_t>(m_Entities.size());
+
+        for (uint32_t slot = first; slot < count; ++slot) {
+            const uint32_t parent = m_Parents[slot];
+            const bool parentChanged = parent != k_InvalidSlot && parent >= first && m_WorldChanged[parent];
+            const bool changed = m_LocalDirty[slot] || parentChanged;
+
+            m_WorldChanged[slot] = changed;
+            if (!changed)
+                continue;
+
+            if (parent != k_InvalidSlot)
+                MultiplyMat4(m_World[parent], m_Local[slot], m_World[slot]);
+            else
+                m_World[slot] = m_Local[slot];
+
+            m_LocalDirty[slot] = 0;
+            ++m_LastUpdated;
+        }
+
+        m_DirtySlots.clear();
+    }
+
+} // namespace Nova::App::World
@@ -0,0 +1,77 @@
+#ifndef TRANSFORMCACHE_H
+#define TRANSFORMCACHE_H
+
+#include <vector>
+#include <cstdint>
+
+#include <glm/glm.hpp>
+#include <entt/entt.hpp>
+
+namespace Nova::App::World {
+
+    // Contiguous cache of local and world matrices for every entity with a TransformComponent.
+    //
+    // Slots are laid out so that a parent always precedes its children (depth order after a rebuild,
+    // append order in between), which lets a single forward pass propagate world matrices.
+    // Registry signals on TransformComponent / HierarchyComponent mark slots dirty; Update()
+    // recomposes only the dirty local matrices (4 at a time with SSE) and the world matrices of
+    // their descendants. Transforms must therefore be modified through registry.patch/replace,
+    // or flagged with MarkDirty.
+    class TransformCache {
+    public:
+        TransformCache() = default;
+        ~TransformCache() { Disconnect(); }
+
+        TransformCache(const TransformCache&) = delete;
+        TransformCache& operator=(const TransformCache&) = delete;
+
+        void Connect(entt::registry& registry);
+        void Disconnect();
+
+        void MarkDirty(entt::entity entity);
+        void Update();
+
+        bool Contains(entt::entity entity) const { return SlotOf(entity) != k_InvalidSlot; }
+        const glm::mat4& GetWorldMatrix(entt::entity entity) const { return m_World[SlotOf(entity)]; }
+
+        size_t Size() const { return m_Entities.size() - m_Tombstones; }
+        uint32_t GetUpdatedCount() const { return m_LastUpdated; }
+
+    private:
+        static constexpr uint32_t k_InvalidSlot = 0xFFFFFFFFu;
+
+        void OnTransformConstruct(entt::registry& registry, entt::entity entity);
+        void OnTransformUpdate(entt::registry& registry, entt::entity entity);
+        void OnTransformDestroy(entt::registry& registry, entt::entity entity);
+        void OnHierarchyChanged(entt::registry& registry, entt::entity entity);
+
+        void Rebuild();
+        uint32_t AppendSlot(entt::entity entity, uint32_t parentSlot);
+        uint32_t SlotOf(entt::entity entity) const;
+        void SetSlotOf(entt::entity entity, uint32_t slot);
+        uint32_t ParentSlotOf(entt::entity entity) const;
+
+        void ComposeDirtyLocals();
+
+        entt::registry* m_Registry{ nullptr };
+
+        // ---- Per-slot data ----
+        std::vector<entt::entity> m_Entities;   // entt::null marks a destroyed slot (tombstone)
+        std::vector<uint32_t>     m_Parents;    // parent slot, k_InvalidSlot for roots
+        std::vector<glm::mat4>    m_Local;
+        std::vector<glm::mat4>    m_World;
+        std::vector<uint8_t>      m_LocalDirty;
+        std::vector<uint8_t>      m_WorldChanged;
+
+        std::vector<uint32_t> m_DirtySlots;     // slots whose m_LocalDirty flag is set
+        std::vector<uint32_t> m_SlotOfEntity;   // indexed by entt::to_entity
+
+        uint32_t m_Tombstones{ 0 };
+        uint32_t m_ParentedSlots{ 0 };
+        uint32_t m_LastUpdated{ 0 };
+        bool     m_NeedsRebuild{ false };
+    };
+
+} // namespace Nova::App::World
+
+#endif // TRANSFORMCACHE_H
@@ -0,0 +1,134 @@
+#include "World/TransformMath.h"
+
+#include <cmath>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define NV_TRANSFORM_SSE 1
+    #include <immintrin.h>
+#endif
+
+namespace Nova::App::World {
+
+    namespace {
+
+        struct Quat {
+            float x, y, z, w;
+        };
+
+        // glm::quat(eulerAngles) convention: pitch = x, yaw = y, roll = z.
+        Quat QuatFromEuler(const glm::vec3& euler) {
+            const float cx = std::cos(euler.x * 0.5f), sx = std::sin(euler.x * 0.5f);
+            const float cy = std::cos(euler.y * 0.5f), sy = std::sin(euler.y * 0.5f);
+            const float cz = std::cos(euler.z * 0.5f), sz = std::sin(euler.z * 0.5f);
+
+            Quat q;
+            q.w = cx * cy * cz + sx * sy * sz;
+            q.x = sx * cy * cz - cx * sy * sz;
+            q.y = cx * sy * cz + sx * cy * sz;
+            q.z = cx * cy * sz - sx * sy * cz;
+            return q;
+        }
+
+    } // namespace
+
+    glm::mat4 ComposeTRS(const TRS& trs) {
+        const Quat q = QuatFromEuler(trs.m_Rotation);
+        const float xx = q.x * q.x, yy = q.y * q.y, zz = q.z * q.z;
+        const float xy = q.x * q.y, xz = q.x * q.z, yz = q.y * q.z;
+        const float wx = q.w * q.x, wy = q.w * q.y, wz = q.w * q.z;
+
+        const glm::vec3& s = trs.m_Scale;
+
+        glm::mat4 m(1.0f);
+        m[0] = glm::vec4((1.0f - 2.0f * (yy + zz)) * s.x, 2.0f * (xy + wz) * s.x, 2.0f * (xz - wy) * s.x, 0.0f);
+        m[1] = glm::vec4(2.0f * (xy - wz) * s.y, (1.0f - 2.0f * (xx + zz)) * s.y, 2.0f * (yz + wx) * s.y, 0.0f);
+        m[2] = glm::vec4(2.0f * (xz + wy) * s.z, 2.0f * (yz - wx) * s.z, (1.0f - 2.0f * (xx + yy)) * s.z, 0.0f);
+        m[3] = glm::vec4(trs.m_Position, 1.0f);
+        return m;
+    }
+
+    void ComposeTRS(std::span<const TRS> input, glm::mat4* output, const uint32_t* outputSlots) {
+        size_t i = 0;
+
+#if defined(NV_TRANSFORM_SSE)
+        const __m128 one = _mm_set1_ps(1.0f);
+        const __m128 two = _mm_set1_ps(2.0f);
+
+        for (; i + 4 <= input.size(); i += 4) {
+            // SoA gather of the 4 transforms.
+            alignas(16) float qx[4], qy[4], qz[4], qw[4];
+            alignas(16) float sx[4], sy[4], sz[4];
+            alignas(16) float px[4], py[4], pz[4];
+            for (int lane = 0; lane < 4; ++lane) {
+                const TRS& trs = input[i + lane];
+                const Quat q = QuatFromEuler(trs.m_Rotation);
+                qx[lane] = q.x; qy[lane] = q.y; qz[lane] = q.z; qw[lane] = q.w;
+                sx[lane] = trs.m_Scale.x; sy[lane] = trs.m_Scale.y; sz[lane] = trs.m_Scale.z;
+                px[lane] = trs.m_Position.x; py[lane] = trs.m_Position.y; pz[lane] = trs.m_Position.z;
+            }
+
+            const __m128 x = _mm_load_ps(qx), y = _mm_load_ps(qy), z = _mm_load_ps(qz), w = _mm_load_ps(qw);
+            const __m128 xx = _mm_mul_ps(x, x), yy = _mm_mul_ps(y, y), zz = _mm_mul_ps(z, z);
+            const __m128 xy = _mm_mul_ps(x, y), xz = _mm_mul_ps(x, z), yz = _mm_mul_ps(y, z);
+            const __m128 wx = _mm_mul_ps(w, x), wy = _mm_mul_ps(w, y), wz = _mm_mul_ps(w, z);
+
+            const __m128 scaleX = _mm_load_ps(sx), scaleY = _mm_load_ps(sy), scaleZ = _mm_load_ps(sz);
+
+            // rows[column][row], each register holding that element for the 4 transforms.
+            __m128 rows[4][4];
+            rows[0][0] = _mm_mul_ps(_mm_sub_ps(one, _mm_mul_ps(two, _mm_add_ps(yy, zz))), scaleX);
+            rows[0][1] = _mm_mul_ps(_mm_mul_ps(two, _mm_add_ps(xy, wz)), scaleX);
+            rows[0][2] = _mm_mul_ps(_mm_mul_ps(two, _mm_sub_ps(xz, wy)), scaleX);
+            rows[0][3] = _mm_setzero_ps();
+
+            rows[1][0] = _mm_mul_ps(_mm_mul_ps(two, _mm_sub_ps(xy, wz)), scaleY);
+            rows[1][1] = _mm_mul_ps(_mm_sub_ps(one, _mm_mul_ps(two, _mm_add_ps(xx, zz))), scaleY);
+            rows[1][2] = _mm_mul_ps(_mm_mul_ps(two, _mm_add_ps(yz, wx)), scaleY);
+            rows[1][3] = _mm_setzero_ps();
+
+            rows[2][0] = _mm_mul_ps(_mm_mul_ps(two, _mm_add_ps(xz, wy)), scaleZ);
+            rows[2][1] = _mm_mul_ps(_mm_mul_ps(two, _mm_sub_ps(yz, wx)), scaleZ);
+            rows[2][2] = _mm_mul_ps(_mm_sub_ps(one, _mm_mul_ps(two, _mm_add_ps(xx, yy))), scaleZ);
+            rows[2][3] = _mm_setzero_ps();
+
+            rows[3][0] = _mm_load_ps(px);
+            rows[3][1] = _mm_load_ps(py);
+            rows[3][2] = _mm_load_ps(pz);
+            rows[3][3] = one;
+
+            // Transpose each column block from SoA to one column per transform, then store.
+            for (int column = 0; column < 4; ++column) {
+                __m128 c0 = rows[column][0], c1 = rows[column][1], c2 = rows[column][2], c3 = rows[column][3];
+                _MM_TRANSPOSE4_PS(c0, c1, c2, c3);
+                _mm_storeu_ps(&output[outputSlots[i + 0]][column][0], c0);
+                _mm_storeu_ps(&output[outputSlots[i + 1]][column][0], c1);
+                _mm_storeu_ps(&output[outputSlots[i + 2]][column][0], c2);
+                _mm_storeu_ps(&output[outputSlots[i + 3]][column][0], c3);
+            }
+        }
+#endif
+
+        for (; i < input.size(); ++i)
+            output[outputSlots[i]] = ComposeTRS(input[i]);
+    }
+
+    void MultiplyMat4(const glm::mat4& a, const glm::mat4& b, glm::mat4& out) {
+#if defined(NV_TRANSFORM_SSE)
+        const __m128 a0 = _mm_loadu_ps(&a[0][0]);
+        const __m128 a1 = _mm_loadu_ps(&a[1][0]);
+        const __m128 a2 = _mm_loadu_ps(&a[2][0]);
+        const __m128 a3 = _mm_loadu_ps(&a[3][0]);
+
+        for (int column = 0; column < 4; ++column) {
+            __m128 r = _mm_mul_ps(a0, _mm_set1_ps(b[column][0]));
+            r = _mm_add_ps(r, _mm_mul_ps(a1, _mm_set1_ps(b[column][1])));
+            r = _mm_add_ps(r, _mm_mul_ps(a2, _mm_set1_ps(b[column][2])));
+            r = _mm_add_ps(r, _mm_mul_ps(a3, _mm_set1_ps(b[column][3])));
+            _mm_storeu_ps(&out[column][0], r);
+        }
+#else
+        out = a * b;
+#endif
+    }
+
+} // namespace Nova::App::World
@@ -0,0 +1,30 @@
+#ifndef TRANSFORMMATH_H
+#define TRANSFORMMATH_H
+
+#include <span>
+#include <cstdint>
+
+#include <glm/glm.hpp>
+
+namespace Nova::App::World {
+
+    // Decomposed local transform, as stored in TransformComponent (rotation in radians, XYZ Euler).
+    struct TRS {
+        glm::vec3 m_Position{ 0.0f };
+        glm::vec3 m_Rotation{ 0.0f };
+        glm::vec3 m_Scale{ 1.0f };
+    };
+
+    // Same composition as TransformComponent::GetTransform(): translate * rotate(quat(euler)) * scale.
+    glm::mat4 ComposeTRS(const TRS& trs);
+
+    // Batched composition: output[outputSlots[i]] = ComposeTRS(input[i]).
+    // Quaternions are built per transform, the matrices are assembled 4 transforms per SSE lane.
+    void ComposeTRS(std::span<const TRS> input, glm::mat4* output, const uint32_t* outputSlots);
+
+    // out = a * b (out may not alias a or b).
+    void MultiplyMat4(const glm::mat4& a, const glm::mat4& b, glm::mat4& out);
+
+} // namespace Nova::App::World
+
+#endif // TRANSFORMMATH_H
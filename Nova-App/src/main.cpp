@@ -3,25 +3,86 @@
 
 #include "App/AppLayer.h"
 #include "App/EditorLayer.h"
+#include "App/HeadlessBenchmarkLayer.h"
+
+#include "Jobs/JobSystem.h"
+#include "Profiling/Profiler.h"
 
 #include "Core/Log.h"
 
-int main() {
+#include <string>
+#include <format>
+#include <cstdlib>
+
+int main(int argc, char** argv) {
 
     NV_LOG_INFO("Starting Nova Engine");
 
+    // --benchmark: offscreen, VSync off, fixed frame count, JSON report (see Bench/HeadlessBenchmark.h).
+    Nova::App::Bench::HeadlessBenchmarkDesc benchmarkDesc;
+    std::string argsError;
+    const bool benchmark = Nova::App::Bench::ParseHeadlessBenchmarkArgs(argc, argv, benchmarkDesc, argsError);
+    if (!argsError.empty()) {
+        NV_LOG_ERROR(argsError);
+        if (benchmark)
+            return 2;
+    }
+
+#if NV_PROFILER_ENABLED
+    Nova::App::Profiling::Profiler::Get().SetThreadName("Main");
+#endif
+
+    // NOVA_JOB_THREADS=1 runs every job on the main thread, in a fixed order.
+    Nova::App::Jobs::JobSystemDesc jobDesc;
+    if (const char* threads = std::getenv("NOVA_JOB_THREADS"))
+        jobDesc.m_ThreadCount = static_cast<uint32_t>(std::strtoul(threads, nullptr, 10));
+    Nova::App::Jobs::JobSystem::Get().Init(jobDesc);
+
     Nova::Core::Window::WindowDesc windowDesc;
     windowDesc.m_Title = "Nova Engine";
     windowDesc.m_Width = 1500;
     windowDesc.m_Height = 900;
     windowDesc.m_Resizable = true;
-    windowDesc.m_VSync = true;
     windowDesc.m_GraphicsAPI = GraphicsAPI::Vulkan;
 
+    // NOVA_PRESENT_MODE=fifo|mailbox|immediate, NOVA_FRAMES_IN_FLIGHT=1..3, NOVA_LOW_LATENCY=1.
+    // Also switchable in the editor (Tools > Presentation) when the renderer supports it.
+    Nova::App::Rendering::FramePacingSettings framePacing;
+    if (const char* mode = std::getenv("NOVA_PRESENT_MODE"); mode && !Nova::App::Rendering::ParsePresentMode(mode, framePacing.m_PresentMode))
+        NV_LOG_ERROR(std::format("Unknown NOVA_PRESENT_MODE '{}', using fifo.", mode));
+    if (const char* frames = std::getenv("NOVA_FRAMES_IN_FLIGHT"))
+        framePacing.m_FramesInFlight = static_cast<uint32_t>(std::strtoul(frames, nullptr, 10));
+    if (const char* lowLatency = std::getenv("NOVA_LOW_LATENCY"))
+        framePacing.m_LowLatency = std::string(lowLatency) == "1";
+    windowDesc.m_VSync = framePacing.m_PresentMode != Nova::App::Rendering::PresentMode::Immediate;
+
+    if (benchmark) {
+        Nova::App::Bench::UseOffscreenVideoDriver();
+        Nova::App::Bench::ApplyHeadlessWindowDesc(benchmarkDesc, windowDesc);
+        framePacing.m_PresentMode = Nova::App::Rendering::PresentMode::Immediate;
+        if (benchmarkDesc.m_GraphicsAPI == "opengl")
+            windowDesc.m_GraphicsAPI = GraphicsAPI::OpenGL;
+        Nova::App::HeadlessBenchmarkLayer::Configure(benchmarkDesc);
+    }
+
+    Nova::App::AppLayer::ConfigureFramePacing(framePacing);
+
     NV_LOG_INFO("Creating Nova Application");
-    Nova::Core::Application windowedApp(windowDesc);
-    windowedApp.GetLayerStack().PushOverlay<Nova::App::AppLayer>();
-    windowedApp.GetLayerStack().PushLayer<Nova::App::EditorLayer>();
-    windowedApp.Run();
-    NV_LOG_INFO("Deleting Nova Application");
+    int exitCode = 0;
+    {
+        Nova::Core::Application windowedApp(windowDesc);
+        windowedApp.GetLayerStack().PushOverlay<Nova::App::AppLayer>();
+        if (benchmark)
+            windowedApp.GetLayerStack().PushLayer<Nova::App::HeadlessBenchmarkLayer>();
+        else
+            windowedApp.GetLayerStack().PushLayer<Nova::App::EditorLayer>();
+        windowedApp.Run();
+
+        if (benchmark)
+            exitCode = Nova::App::HeadlessBenchmarkLayer::GetExitCode();
+        NV_LOG_INFO("Deleting Nova Application");
+    }
+
+    Nova::App::Jobs::JobSystem::Get().Shutdown();
+    return exitCode;
 }
\ No newline at end of file